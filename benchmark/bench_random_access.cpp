@@ -4,6 +4,7 @@
 // benchmark/bench_random_access.cpp
 // ────────────────────────────────────────────────────────
 #include "benchmarker.hpp"
+#include <random>
 
 using namespace fastlanes; // NOLINT
 
@@ -15,12 +16,23 @@ public:
 
 	double bench_random_access(const path& dir_path) const {
 		Connection conn;
-		auto       fls_reader            = conn.reset().read_fls(dir_path / "data.fls");
-		auto       first_rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		auto       fls_reader = conn.reset().read_fls(dir_path / "data.fls");
+		const auto n_tuples   = fls_reader->get_n_tuples();
+		const auto n_cols     = fls_reader->get_rowgroup_reader(0)->m_expressions.size();
+
+		// the same pseudo-random rows every run, so the results stay comparable across versions.
+		std::mt19937_64                    generator {42};
+		std::uniform_int_distribution<n_t> row_distribution {0, n_tuples - 1};
+		vector<n_t>                        row_ids(n_repetitions);
+		for (auto& row_id : row_ids) {
+			row_id = row_distribution(generator);
+		}
 
 		auto start = std::chrono::high_resolution_clock::now();
-		for (n_t repetition_idx {0}; repetition_idx < n_repetitions; repetition_idx++) {
-			[[maybe_unused]] auto& expressions = first_rowgroup_reader->get_chunk(0);
+		for (const auto row_id : row_ids) {
+			for (n_t col_idx {0}; col_idx < n_cols; ++col_idx) {
+				[[maybe_unused]] const auto value = fls_reader->get_value(row_id, col_idx);
+			}
 		}
 		const auto                                      end     = std::chrono::high_resolution_clock::now();
 		const std::chrono::duration<double, std::milli> elapsed = end - start; // in milliseconds
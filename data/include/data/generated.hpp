@@ -36,6 +36,12 @@ public:
 	                                                       "/data/generated/single_columns/fls_str"};
 	static constexpr std::string_view SINGLE_COLUMN_U08PT {FLS_CMAKE_SOURCE_DIR
 	                                                       "/data/generated/single_columns/fls_u08"};
+	static constexpr std::string_view SINGLE_COLUMN_U16PT {FLS_CMAKE_SOURCE_DIR
+	                                                       "/data/generated/single_columns/fls_u16"};
+	static constexpr std::string_view SINGLE_COLUMN_U32PT {FLS_CMAKE_SOURCE_DIR
+	                                                       "/data/generated/single_columns/fls_u32"};
+	static constexpr std::string_view SINGLE_COLUMN_U64PT {FLS_CMAKE_SOURCE_DIR
+	                                                       "/data/generated/single_columns/fls_u64"};
 	static constexpr std::string_view SINGLE_COLUMN_DECIMAL {FLS_CMAKE_SOURCE_DIR
 	                                                         "/data/generated/single_columns/decimal"};
 	static constexpr std::string_view SINGLE_COLUMN_FLOAT {FLS_CMAKE_SOURCE_DIR "/data/generated/single_columns/float"};
@@ -88,6 +94,7 @@ public:
 	                                                     "/data/generated/encodings/cross_rle_str"};
 	static constexpr std::string_view EXP_ALP_FLT {FLS_CMAKE_SOURCE_DIR "/data/generated/encodings/alp_flt"};
 	static constexpr std::string_view EXP_ALP_DBL {FLS_CMAKE_SOURCE_DIR "/data/generated/encodings/alp_dbl"};
+	static constexpr std::string_view EXP_ALP_RD_DBL {FLS_CMAKE_SOURCE_DIR "/data/generated/encodings/alp_rd_dbl"};
 
 	//
 	static constexpr std::string_view NUMBER_STRINGS {FLS_CMAKE_SOURCE_DIR "/data/generated/whitebox/number_strings"};
@@ -100,6 +107,37 @@ public:
 	static constexpr std::string_view ANY_VALUE_COUNT_I64_52422 {FLS_CMAKE_SOURCE_DIR
 	                                                             "/data/generated/any_value_count/25570"};
 
+	// PARTIAL VECTOR: 24 full vectors and a last one of 994 values
+	static constexpr std::string_view PARTIAL_VECTOR_I64 {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_i64"};
+	static constexpr std::string_view PARTIAL_VECTOR_I32 {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_i32"};
+	static constexpr std::string_view PARTIAL_VECTOR_I16 {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_i16"};
+	static constexpr std::string_view PARTIAL_VECTOR_U16 {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_u16"};
+	static constexpr std::string_view PARTIAL_VECTOR_U32 {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_u32"};
+	static constexpr std::string_view PARTIAL_VECTOR_U64 {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_u64"};
+	static constexpr std::string_view PARTIAL_VECTOR_STR {FLS_CMAKE_SOURCE_DIR
+	                                                      "/data/generated/partial_vector/fls_str"};
+	static constexpr std::string_view PARTIAL_VECTOR_BOOLEAN {FLS_CMAKE_SOURCE_DIR
+	                                                          "/data/generated/partial_vector/fls_boolean"};
+	static constexpr std::string_view PARTIAL_VECTOR_BOOLEAN_TRUE_TAIL {
+	    FLS_CMAKE_SOURCE_DIR "/data/generated/partial_vector/fls_boolean_true_tail"};
+
+	// ONE TO ONE UNSIGNED: column 1 maps column 0 through an 8-bit index, column 3 maps column 2 through a 16-bit one
+	static constexpr std::string_view ONE_TO_ONE_U16 {FLS_CMAKE_SOURCE_DIR
+	                                                  "/data/generated/one_to_one_unsigned/fls_u16"};
+	static constexpr std::string_view ONE_TO_ONE_U32 {FLS_CMAKE_SOURCE_DIR
+	                                                  "/data/generated/one_to_one_unsigned/fls_u32"};
+	static constexpr std::string_view ONE_TO_ONE_U64 {FLS_CMAKE_SOURCE_DIR
+	                                                  "/data/generated/one_to_one_unsigned/fls_u64"};
+	// column 1 maps column 0 through a 32-bit index, in a rowgroup of CFG::RowGroup::MAX_N_VECTORS vectors
+	static constexpr std::string_view ONE_TO_ONE_U32_INDEX {FLS_CMAKE_SOURCE_DIR
+	                                                        "/data/generated/one_to_one_unsigned/fls_u32_index"};
+
 	// SUBNORMAL
 	static constexpr std::string_view SUBNORMALS {FLS_CMAKE_SOURCE_DIR "/data/generated/subnormals"};
 };
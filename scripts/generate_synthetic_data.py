@@ -5,6 +5,7 @@
 # ────────────────────────────────────────────────────────
 # scripts/generate_helpers/main_generators.py
 
+import math
 import random
 from faker.providers import BaseProvider
 from pathlib import Path
@@ -23,6 +24,8 @@ from generator_helpers.jpeg_generator import *
 from generator_helpers.boolean_generator import *
 from generator_helpers.i08_generator import *
 from generator_helpers.u08_generator import *
+from generator_helpers.unsigned_generator import *
+from generator_helpers.partial_vector_generator import *
 from generator_helpers.galp_generator import *
 
 
@@ -299,6 +302,11 @@ def generate_alp_dbl_func(faker, row_id):
     return [row_id + 0.1]
 
 
+# full-precision doubles in [1, 2): no decimal exponent encodes them, but they all share their sign and exponent.
+def generate_alp_rd_dbl_func(faker, row_id):
+    return [1.0 + math.sin(row_id) ** 2]
+
+
 def generate_example_one(faker, row_id):
     NAMES = ["Azim", "Amir", "Ali", "Omid"]
 
@@ -513,6 +521,11 @@ def generate_alp_dbl():
     write_csv(file, generate_alp_dbl_func, ROW_GROUP_SIZE)
 
 
+def generate_alp_rd_dbl():
+    file = Path.cwd() / 'data' / 'generated' / 'encodings' / 'alp_rd_dbl'
+    write_csv(file, generate_alp_rd_dbl_func, ROW_GROUP_SIZE)
+
+
 def generate_specific_number_of_values(count):
     # one rowgroup
     write_csv(
@@ -552,6 +565,7 @@ def generate_single_column():
     fls_i32()
     fls_i08()
     fls_u08()
+    fls_unsigned()
     fls_str()
     generate_fls_dbl()
     generate_fls_decimal()
@@ -581,6 +595,7 @@ def generate_expression_data():
     generate_cross_rle_str()
     generate_alp_flt()
     generate_alp_dbl()
+    generate_alp_rd_dbl()
 
 
 def equality():
@@ -626,6 +641,7 @@ def main():
     generate_expression_data()
     generate_irregular_data()
     generate_any_value_count()
+    partial_vector()
     generate_subnormals()
     generate_fsst_test()
     fls_galp()
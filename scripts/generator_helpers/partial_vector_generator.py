@@ -0,0 +1,117 @@
+# ────────────────────────────────────────────────────────
+# |                      FastLanes                       |
+# ────────────────────────────────────────────────────────
+# scripts/generator_helpers/partial_vector_generator.py
+# ────────────────────────────────────────────────────────
+from pathlib import Path
+from typing import Callable, List, Any
+
+from .write_helpers import write_csv, write_schema
+from .common import VEC_SIZE
+
+# ----------------------------------------------------------------------
+# Config
+# ----------------------------------------------------------------------
+# 24 full vectors and a last one of 994 values.
+PARTIAL_VECTOR_SIZE = 24 * VEC_SIZE + 994
+
+
+# ----------------------------------------------------------------------
+# Row-value generators
+# ----------------------------------------------------------------------
+# runs of four values that cross zero, small enough for every signed width.
+
+def generate_partial_vector_signed(_faker: Any, row_id: int) -> List[int]:
+    """Return a single signed integer in [-3000, 3393)."""
+    return [row_id // 4 - 3000]
+
+
+# runs of four values out of 200, above the signed maximum of each width; few enough for a dictionary with an 8-bit
+# index.
+
+def generate_partial_vector_u16(_faker: Any, row_id: int) -> List[int]:
+    """Return a single unsigned 16-bit integer in [40000, 40200)."""
+    return [40000 + row_id // 4 % 200]
+
+
+def generate_partial_vector_u32(_faker: Any, row_id: int) -> List[int]:
+    """Return a single unsigned 32-bit integer in [3000000000, 3000000200)."""
+    return [3_000_000_000 + row_id // 4 % 200]
+
+
+def generate_partial_vector_u64(_faker: Any, row_id: int) -> List[int]:
+    """Return a single unsigned 64-bit integer in [2^63, 2^63 + 200)."""
+    return [2 ** 63 + row_id // 4 % 200]
+
+
+# runs of four strings out of 200, so the last value of the last vector, which its padding repeats, also occurs
+# elsewhere.
+
+def generate_partial_vector_str(_faker: Any, row_id: int) -> List[str]:
+    """Return a single string out of 200 distinct ones."""
+    return [f"partial_vector_value_{row_id // 4 % 200:03d}"]
+
+
+# two true values out of three, ending on a true one, so the padding of the last vector repeats true. in the second
+# dataset the whole last vector is true.
+
+def generate_partial_vector_boolean(_faker: Any, row_id: int) -> List[bool]:
+    """Return a single boolean, false every third row."""
+    return [row_id % 3 != 1]
+
+
+def generate_partial_vector_boolean_true_tail(_faker: Any, row_id: int) -> List[bool]:
+    """Return a single boolean, false every third row of the full vectors and true in the last one."""
+    return [row_id >= 24 * VEC_SIZE or row_id % 3 != 1]
+
+
+# ----------------------------------------------------------------------
+# CSV + schema writer helper
+# ----------------------------------------------------------------------
+
+def write_partial_vector_to_file(
+        sub_path: str,
+        generator: Callable[[Any, int], List[int]],
+        name: str,
+        type_name: str,
+) -> None:
+    """Write PARTIAL_VECTOR_SIZE rows to *data/generated/<sub_path>/generated.csv* plus *schema.json*."""
+    dir_path = Path.cwd() / "data" / "generated" / sub_path
+
+    write_csv(dir_path, generator, PARTIAL_VECTOR_SIZE)
+
+    schema = {
+        "columns": [
+            {
+                "name": name,
+                "type": type_name
+            }
+        ]
+    }
+    write_schema(dir_path, schema)
+
+
+# ----------------------------------------------------------------------
+# Public entry point used by scripts/generate_synthetic_data.py
+# ----------------------------------------------------------------------
+
+def partial_vector() -> None:
+    """Generate the single-column datasets whose last vector is partial."""
+    write_partial_vector_to_file("partial_vector/fls_i64", generate_partial_vector_signed,
+                                 "SYNTHETIC_DATA_I64", "FLS_I64")
+    write_partial_vector_to_file("partial_vector/fls_i32", generate_partial_vector_signed,
+                                 "SYNTHETIC_DATA_I32", "FLS_I32")
+    write_partial_vector_to_file("partial_vector/fls_i16", generate_partial_vector_signed,
+                                 "SYNTHETIC_DATA_I16", "FLS_I16")
+    write_partial_vector_to_file("partial_vector/fls_u16", generate_partial_vector_u16,
+                                 "SYNTHETIC_DATA_U16", "USMALLINT")
+    write_partial_vector_to_file("partial_vector/fls_u32", generate_partial_vector_u32,
+                                 "SYNTHETIC_DATA_U32", "UINTEGER")
+    write_partial_vector_to_file("partial_vector/fls_u64", generate_partial_vector_u64,
+                                 "SYNTHETIC_DATA_U64", "UBIGINT")
+    write_partial_vector_to_file("partial_vector/fls_str", generate_partial_vector_str,
+                                 "SYNTHETIC_DATA_STR", "FLS_STR")
+    write_partial_vector_to_file("partial_vector/fls_boolean", generate_partial_vector_boolean,
+                                 "SYNTHETIC_DATA_BOOLEAN", "BOOLEAN")
+    write_partial_vector_to_file("partial_vector/fls_boolean_true_tail", generate_partial_vector_boolean_true_tail,
+                                 "SYNTHETIC_DATA_BOOLEAN", "BOOLEAN")
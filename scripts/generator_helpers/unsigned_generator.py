@@ -0,0 +1,139 @@
+# ────────────────────────────────────────────────────────
+# |                      FastLanes                       |
+# ────────────────────────────────────────────────────────
+# scripts/generator_helpers/unsigned_generator.py
+# ────────────────────────────────────────────────────────
+from pathlib import Path
+from typing import Callable, List, Any
+
+from .write_helpers import write_csv, write_schema
+from .common import ROW_GROUP_SIZE, VEC_SIZE
+
+# ----------------------------------------------------------------------
+# Config
+# ----------------------------------------------------------------------
+# the largest rowgroup a byte budget allows (CFG::RowGroup::MAX_N_VECTORS vectors) and a partial one after it.
+ONE_TO_ONE_U32_INDEX_SIZE = 1024 * VEC_SIZE + 994
+
+
+# ----------------------------------------------------------------------
+# Row-value generators
+# ----------------------------------------------------------------------
+# every value is above the signed maximum of its width, so the columns stay unsigned instead of being narrowed to a
+# signed type.
+
+def generate_fls_u16(_faker: Any, row_id: int) -> List[int]:
+    """Return a single **unsigned** 16-bit integer in [40000, 40000 + 1000)."""
+    return [40000 + row_id % 1000]
+
+
+def generate_fls_u32(_faker: Any, row_id: int) -> List[int]:
+    """Return a single **unsigned** 32-bit integer in [3000000000, 3000000000 + 100000)."""
+    return [3_000_000_000 + row_id % 100_000]
+
+
+def generate_fls_u64(_faker: Any, row_id: int) -> List[int]:
+    """Return a single **unsigned** 64-bit integer that grows by 7 per row, starting at 2^63."""
+    return [2 ** 63 + row_id * 7]
+
+
+# two 1:1 mapped pairs per width: the first with 200 distinct values, mapped through an 8-bit dictionary index, the
+# second with 5000, mapped through a 16-bit one.
+
+def one_to_one_unsigned(base: int) -> Callable[[Any, int], List[int]]:
+    """Return a generator of four columns above *base*, where column 1 maps column 0 and column 3 maps column 2."""
+
+    def generate(_faker: Any, row_id: int) -> List[int]:
+        return [
+            base + row_id % 200,
+            base + 1000 + row_id % 200,
+            base + row_id % 5000,
+            base + 10000 + row_id % 5000,
+        ]
+
+    return generate
+
+
+# a 1:1 mapped pair with 70000 distinct values: a rowgroup of the default size holds at most 65536 of them, but one of
+# CFG::RowGroup::MAX_N_VECTORS vectors needs a 32-bit dictionary index.
+
+def generate_one_to_one_u32_index(_faker: Any, row_id: int) -> List[int]:
+    """Return two unsigned 32-bit integers, where the second maps the first."""
+    return [3_000_000_000 + row_id % 70_000, 3_000_100_000 + row_id % 70_000]
+
+
+# ----------------------------------------------------------------------
+# CSV + schema writer helper
+# ----------------------------------------------------------------------
+
+def write_unsigned_to_file(
+        sub_path: str,
+        generator: Callable[[Any, int], List[int]],
+        size: int,
+        name: str,
+        type_name: str,
+) -> None:
+    """Write *size* rows to *data/generated/<sub_path>/generated.csv* plus *schema.json*."""
+    dir_path = Path.cwd() / "data" / "generated" / sub_path
+
+    write_csv(dir_path, generator, size)
+
+    schema = {
+        "columns": [
+            {
+                "name": name,
+                "type": type_name
+            }
+        ]
+    }
+    write_schema(dir_path, schema)
+
+
+def write_one_to_one_unsigned_to_file(sub_path: str, base: int, type_name: str) -> None:
+    """Write ROW_GROUP_SIZE rows of the two mapped pairs to *data/generated/<sub_path>/* plus *schema.json*."""
+    dir_path = Path.cwd() / "data" / "generated" / sub_path
+
+    write_csv(dir_path, one_to_one_unsigned(base), ROW_GROUP_SIZE)
+
+    schema = {
+        "columns": [
+            {"name": "COLUMN_0", "type": type_name},
+            {"name": "COLUMN_0_MAPPED", "type": type_name},
+            {"name": "COLUMN_2", "type": type_name},
+            {"name": "COLUMN_2_MAPPED", "type": type_name},
+        ]
+    }
+    write_schema(dir_path, schema)
+
+
+def write_one_to_one_u32_index_to_file(sub_path: str) -> None:
+    """Write ONE_TO_ONE_U32_INDEX_SIZE rows of the mapped pair to *data/generated/<sub_path>/* plus *schema.json*."""
+    dir_path = Path.cwd() / "data" / "generated" / sub_path
+
+    write_csv(dir_path, generate_one_to_one_u32_index, ONE_TO_ONE_U32_INDEX_SIZE)
+
+    schema = {
+        "columns": [
+            {"name": "COLUMN_0", "type": "UINTEGER"},
+            {"name": "COLUMN_0_MAPPED", "type": "UINTEGER"},
+        ]
+    }
+    write_schema(dir_path, schema)
+
+
+# ----------------------------------------------------------------------
+# Public entry point used by scripts/generate_synthetic_data.py
+# ----------------------------------------------------------------------
+
+def fls_unsigned() -> None:
+    """Generate the row-group (ROW_GROUP_SIZE) U16, U32 and U64 datasets, single and 1:1 mapped."""
+    write_unsigned_to_file("single_columns/fls_u16", generate_fls_u16, ROW_GROUP_SIZE,
+                           "SYNTHETIC_DATA_U16", "USMALLINT")
+    write_unsigned_to_file("single_columns/fls_u32", generate_fls_u32, ROW_GROUP_SIZE,
+                           "SYNTHETIC_DATA_U32", "UINTEGER")
+    write_unsigned_to_file("single_columns/fls_u64", generate_fls_u64, ROW_GROUP_SIZE,
+                           "SYNTHETIC_DATA_U64", "UBIGINT")
+    write_one_to_one_unsigned_to_file("one_to_one_unsigned/fls_u16", 40000, "USMALLINT")
+    write_one_to_one_unsigned_to_file("one_to_one_unsigned/fls_u32", 3_000_000_000, "UINTEGER")
+    write_one_to_one_unsigned_to_file("one_to_one_unsigned/fls_u64", 2 ** 63, "UBIGINT")
+    write_one_to_one_u32_index_to_file("one_to_one_unsigned/fls_u32_index")
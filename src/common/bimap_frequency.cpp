@@ -96,6 +96,12 @@ bool BiMapFrequency<PT>::empty() const {
 	return key_to_value.empty();
 }
 
+template <typename PT>
+void BiMapFrequency<PT>::reserve(n_t n_values) {
+	key_to_value.reserve(n_values);
+	value_to_key.reserve(n_values);
+}
+
 template class BiMapFrequency<u64_pt>;
 template class BiMapFrequency<u32_pt>;
 template class BiMapFrequency<u16_pt>;
@@ -0,0 +1,86 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/common/hyperloglog.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/common/hyperloglog.hpp"
+#include <algorithm> // std::max
+#include <bit>       // std::countl_zero
+#include <cmath>     // std::log, std::ldexp, std::llround
+#include <cstring>   // std::memcpy
+
+namespace fastlanes {
+
+HyperLogLog::HyperLogLog()
+    : m_registers(N_REGISTERS, 0) {
+}
+
+void HyperLogLog::Add(const uint64_t hash) {
+	// the first PRECISION bits pick the register, the rank of the first set bit of the rest is what it remembers.
+	const auto    register_idx = static_cast<n_t>(hash >> (64 - PRECISION));
+	const auto    remainder    = hash << PRECISION;
+	const uint8_t rank         = remainder == 0 ? static_cast<uint8_t>(64 - PRECISION + 1)
+	                                            : static_cast<uint8_t>(std::countl_zero(remainder) + 1);
+
+	m_registers[register_idx] = std::max(m_registers[register_idx], rank);
+}
+
+n_t HyperLogLog::Estimate() const {
+	constexpr double M     = static_cast<double>(N_REGISTERS);
+	constexpr double ALPHA = 0.7213 / (1.0 + 1.079 / M);
+
+	double sum {0};
+	n_t    n_zero_registers {0};
+	for (const auto rank : m_registers) {
+		sum += std::ldexp(1.0, -static_cast<int>(rank));
+		n_zero_registers += rank == 0;
+	}
+
+	const double raw_estimate = ALPHA * M * M / sum;
+	// small cardinalities leave registers empty; counting those is the more accurate estimate there.
+	if (raw_estimate <= 2.5 * M && n_zero_registers != 0) {
+		return static_cast<n_t>(std::llround(M * std::log(M / static_cast<double>(n_zero_registers))));
+	}
+	return static_cast<n_t>(std::llround(raw_estimate));
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+	for (n_t register_idx {0}; register_idx < N_REGISTERS; ++register_idx) {
+		m_registers[register_idx] = std::max(m_registers[register_idx], other.m_registers[register_idx]);
+	}
+}
+
+bool HyperLogLog::IsEmpty() const {
+	return std::all_of(m_registers.begin(), m_registers.end(), [](const uint8_t rank) { return rank == 0; });
+}
+
+uint64_t HyperLogLog::Hash(const uint8_t* data, const n_t size) {
+	uint64_t hash = 0x9E3779B97F4A7C15ULL ^ size;
+	n_t      idx {0};
+	for (; idx + sizeof(uint64_t) <= size; idx += sizeof(uint64_t)) {
+		uint64_t word;
+		std::memcpy(&word, data + idx, sizeof(uint64_t));
+		hash = Mix(hash ^ word);
+	}
+	uint64_t tail {0};
+	if (idx < size) {
+		std::memcpy(&tail, data + idx, size - idx);
+	}
+	return Mix(hash ^ tail);
+}
+
+uint64_t HyperLogLog::Hash(const string& value) {
+	return Hash(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+}
+
+// the finalizer of MurmurHash3: every input bit affects every output bit.
+uint64_t HyperLogLog::Mix(uint64_t bits) {
+	bits ^= bits >> 33;
+	bits *= 0xFF51AFD7ED558CCDULL;
+	bits ^= bits >> 33;
+	bits *= 0xC4CEB9FE1A85EC53ULL;
+	bits ^= bits >> 33;
+	return bits;
+}
+
+} // namespace fastlanes
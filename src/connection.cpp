@@ -11,16 +11,19 @@
 #include "fls/file/file_footer.hpp" // for FileFooter
 #include "fls/file/file_header.hpp" // for FileHeader
 #include "fls/flatbuffers/flatbuffers.hpp"
+#include "fls/footer/footer_cache.hpp" // for FooterCache
 #include "fls/footer/operator_token_generated.h"
 #include "fls/info.hpp"
 #include "fls/json/fls_json.hpp"       // for JSON
 #include "fls/reader/csv_reader.hpp"   // for CSVReader
 #include "fls/reader/json_reader.hpp"  // for JSONReader
+#include "fls/reader/rowgroup_cache.hpp" // for RowgroupCache
 #include "fls/reader/table_reader.hpp" // for TableReader
 #include "fls/std/filesystem.hpp"      // for std::filesystem::directory_iterator, begin, path
 #include "fls/std/string.hpp"          // for std::string
 #include "fls/std/vector.hpp"          // for fastlanes::vector
 #include "fls/table/rowgroup.hpp"      // for Rowgroup
+#include "fls/table/sorter.hpp"        // for RowgroupSorter
 #include "fls/table/table.hpp"         // for Table
 #include "fls/wizard/wizard.hpp"       // for Wizard
 #include <algorithm>                   // for std::ranges::none_of
@@ -32,11 +35,19 @@
 namespace fastlanes {
 
 Connection::Connection() {
-	m_config = make_unique<Config>();
+	m_config         = make_unique<Config>();
+	m_memory_tracker = make_unique<MemoryTracker>(m_config->memory_budget);
+	if (m_config->enable_schema_cache) {
+		m_schema_cache = make_unique<SchemaCache>();
+	}
 }
 
 Connection::Connection(const Config& config) {
-	m_config = make_unique<Config>(config);
+	m_config         = make_unique<Config>(config);
+	m_memory_tracker = make_unique<MemoryTracker>(m_config->memory_budget);
+	if (m_config->enable_schema_cache) {
+		m_schema_cache = make_unique<SchemaCache>();
+	}
 }
 
 Connection& Connection::read_csv(const path& dir_path) {
@@ -68,8 +79,11 @@ void prepare_rowgroup(Rowgroup& rowgroup, const Config& config) {
 		rowgroup.Cast();
 	}
 
+	// clustered on the sort keys before the dictionaries are built, in order of first appearance.
+	RowgroupSorter::Sort(rowgroup, config.sort_key_idxs, config.sort_order, config.n_scan_threads);
+
+	// the statistics were kept while ingesting; one more pass builds the dictionaries.
 	rowgroup.Finalize();
-	rowgroup.GetStatistics();
 }
 
 void Connection::prepare_table() const {
@@ -216,6 +230,20 @@ Connection& Connection::set_n_vectors_per_rowgroup(n_t n_vector_per_rowgroup) {
 	return *this;
 }
 
+Connection& Connection::set_rowgroup_byte_budget(const n_t n_bytes) {
+	if (n_bytes != 0 && n_bytes < CFG::RowGroup::MIN_BYTE_BUDGET) {
+		throw std::runtime_error("A rowgroup byte budget is either 0 or at least " +
+		                         std::to_string(CFG::RowGroup::MIN_BYTE_BUDGET) + " bytes.");
+	}
+	m_config->rowgroup_byte_budget = n_bytes;
+
+	return *this;
+}
+
+n_t Connection::get_rowgroup_byte_budget() const {
+	return m_config->rowgroup_byte_budget;
+}
+
 Connection& Connection::set_sample_size(n_t n_vecs) {
 	m_config->sample_size = n_vecs;
 	return *this;
@@ -246,6 +274,138 @@ Connection& Connection::inline_footer() {
 	return *this;
 }
 
+Connection& Connection::enable_bloom_filter() {
+	m_config->enable_bloom_filter = true;
+
+	return *this;
+}
+
+Connection& Connection::set_memory_budget(const n_t n_bytes) {
+	m_config->memory_budget = n_bytes;
+	m_memory_tracker->SetBudget(n_bytes);
+
+	return *this;
+}
+
+n_t Connection::get_memory_usage() const {
+	return m_memory_tracker->Used();
+}
+
+n_t Connection::get_peak_memory_usage() const {
+	return m_memory_tracker->Peak();
+}
+
+MemoryTracker& Connection::get_memory_tracker() const {
+	return *m_memory_tracker;
+}
+
+Connection& Connection::enable_rowgroup_cache() {
+	m_config->enable_rowgroup_cache = true;
+
+	return *this;
+}
+
+RowgroupCache* Connection::get_rowgroup_cache() const {
+	return m_config->enable_rowgroup_cache ? &RowgroupCache::Global() : nullptr;
+}
+
+Connection& Connection::enable_footer_cache() {
+	m_config->enable_footer_cache = true;
+
+	return *this;
+}
+
+FooterCache* Connection::get_footer_cache() const {
+	return m_config->enable_footer_cache ? &FooterCache::Global() : nullptr;
+}
+
+Connection& Connection::enable_huge_pages() {
+	m_config->enable_huge_pages = true;
+
+	return *this;
+}
+
+bool Connection::is_huge_pages_enabled() const {
+	return m_config->enable_huge_pages;
+}
+
+Connection& Connection::set_n_scan_threads(const n_t n_threads) {
+	if (n_threads == 0) {
+		throw std::runtime_error("A scan needs at least one thread.");
+	}
+	m_config->n_scan_threads = n_threads;
+
+	return *this;
+}
+
+n_t Connection::get_n_scan_threads() const {
+	return m_config->n_scan_threads;
+}
+
+Connection& Connection::optimize_for(const OptimizeFor target) {
+	m_config->optimize_for = target;
+
+	return *this;
+}
+
+OptimizeFor Connection::get_optimize_for() const {
+	return m_config->optimize_for;
+}
+
+Connection& Connection::enable_schema_cache() {
+	m_config->enable_schema_cache = true;
+	if (m_schema_cache == nullptr) {
+		m_schema_cache = make_unique<SchemaCache>();
+	}
+
+	return *this;
+}
+
+Connection& Connection::reuse_schema(const path& file_path) {
+	FileSystem::check_if_file_exists(file_path);
+
+	enable_schema_cache();
+	const auto table_descriptor = FooterCache::Load(file_path).Unpack();
+	m_schema_cache->Seed(*table_descriptor);
+
+	return *this;
+}
+
+SchemaCache* Connection::get_schema_cache() const {
+	return m_schema_cache.get();
+}
+
+Connection& Connection::enable_global_dictionaries() {
+	m_config->enable_global_dictionaries = true;
+
+	return *this;
+}
+
+bool Connection::is_global_dictionaries_enabled() const {
+	return m_config->enable_global_dictionaries;
+}
+
+Connection& Connection::enable_shared_symbol_tables() {
+	m_config->enable_shared_symbol_tables = true;
+
+	return *this;
+}
+
+bool Connection::is_shared_symbol_tables_enabled() const {
+	return m_config->enable_shared_symbol_tables;
+}
+
+Connection& Connection::sort_by(const vector<idx_t>& col_idxs, const SortOrder order) {
+	m_config->sort_key_idxs = col_idxs;
+	m_config->sort_order    = order;
+
+	return *this;
+}
+
+const vector<idx_t>& Connection::get_sort_keys() const {
+	return m_config->sort_key_idxs;
+}
+
 string_view Connection::get_version() const {
 	return Info::get_version();
 }
@@ -259,8 +419,20 @@ Config::Config()
     , is_forced_schema(false)
     , sample_size(CFG::SAMPLER::SAMPLE_SIZE)
     , n_vector_per_rowgroup(CFG::RowGroup::N_VECTORS_PER_ROWGROUP)
+    , rowgroup_byte_budget(CFG::RowGroup::BYTE_BUDGET)
     , inline_footer(CFG::Footer::IS_INLINED)
-    , enable_verbose(CFG::Defaults::ENABLE_VERBOSE) {
+    , enable_verbose(CFG::Defaults::ENABLE_VERBOSE)
+    , enable_bloom_filter(CFG::BloomFilter::IS_ENABLED)
+    , memory_budget(CFG::Memory::BUDGET)
+    , enable_rowgroup_cache(CFG::RowgroupCache::IS_ENABLED)
+    , enable_footer_cache(CFG::FooterCache::IS_ENABLED)
+    , enable_huge_pages(CFG::BufPool::HUGE_PAGES)
+    , n_scan_threads(CFG::Scan::N_THREADS)
+    , optimize_for(CFG::CostModel::OPTIMIZE_FOR)
+    , enable_schema_cache(CFG::SchemaCache::IS_ENABLED)
+    , enable_global_dictionaries(CFG::GlobalDictionary::IS_ENABLED)
+    , enable_shared_symbol_tables(CFG::SharedSymbolTable::IS_ENABLED)
+    , sort_order(CFG::Sort::ORDER) {
 }
 
 } // namespace fastlanes
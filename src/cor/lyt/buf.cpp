@@ -6,27 +6,31 @@
 #include "fls/cor/lyt/buf.hpp"
 #include "fls/common/alias.hpp"
 #include "fls/common/assert.hpp"
+#include "fls/cor/lyt/buf_pool.hpp"
+#include "fls/cor/lyt/memory_tracker.hpp"
 #include "fls/io/external_memory.hpp"
 #include "fls/std/span.hpp"
-#include <cstddef> // for std::byte
+#include <algorithm> // for std::max
+#include <cstddef>   // for std::byte
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
 
 namespace fastlanes {
-static constexpr uint64_t BUF_SZ = 64ULL * 8 * 256 * 1024;
-
 void Buf::init() {
-	m_owned_p = new uint8_t[m_capacity];
+	m_owned_p = Acquire(m_capacity);
 	// by default, the owned buffer is the active one
 	m_active_p = m_owned_p;
 }
 
 Buf::Buf()
-    : m_capacity {BUF_SZ}
+    : m_capacity {DEFAULT_CAPACITY}
     , m_off {0}
     , m_owned_p(nullptr)
-    , m_active_p(nullptr) {
+    , m_active_p(nullptr)
+    , m_memory_tracker(nullptr)
+    , m_huge_pages(false)
+    , m_pool(&BufPool::Local()) {
 	init();
 }
 
@@ -34,7 +38,32 @@ Buf::Buf(const sz_t capacity)
     : m_capacity {capacity}
     , m_off {0}
     , m_owned_p(nullptr)
-    , m_active_p(nullptr) {
+    , m_active_p(nullptr)
+    , m_memory_tracker(nullptr)
+    , m_huge_pages(false)
+    , m_pool(&BufPool::Local()) {
+	init();
+}
+
+Buf::Buf(const sz_t capacity, const bool huge_pages)
+    : m_capacity {capacity}
+    , m_off {0}
+    , m_owned_p(nullptr)
+    , m_active_p(nullptr)
+    , m_memory_tracker(nullptr)
+    , m_huge_pages(huge_pages)
+    , m_pool(&BufPool::Local()) {
+	init();
+}
+
+Buf::Buf(const sz_t capacity, MemoryTracker& memory_tracker, const bool huge_pages)
+    : m_capacity {capacity}
+    , m_off {0}
+    , m_owned_p(nullptr)
+    , m_active_p(nullptr)
+    , m_memory_tracker(&memory_tracker)
+    , m_huge_pages(huge_pages)
+    , m_pool(&BufPool::Local()) {
 	init();
 }
 
@@ -81,7 +110,7 @@ template <typename PT>
 PT* Buf::GetFixedSizeArray(const n_t size) {
 	FLS_ASSERT_CORRECT_SZ(size)
 
-	FLS_ASSERT_LE(m_off + size, m_capacity)
+	Grow(m_off + size);
 	m_off += size;
 
 	return reinterpret_cast<PT*>(m_active_p);
@@ -101,12 +130,8 @@ const PT* Buf::data() {
 void Buf::Append(const void* data_p, const n_t sz) {
 	/**/
 	FLS_ASSERT_NOT_NULL_POINTER(data_p)
-	FLS_ASSERT_LE(m_off + sz, m_capacity)
-
-	if (m_off + sz > m_capacity) {
-		FLS_ABORT("NOT ENOUGH SPACE!")
-	}
 
+	Grow(m_off + sz);
 	std::memcpy(m_active_p + m_off, data_p, sz);
 	m_off += sz;
 }
@@ -146,7 +171,10 @@ Buf::~Buf() {
 	/**/
 	FLS_ASSERT_NOT_NULL_POINTER(m_owned_p)
 
-	delete[] m_owned_p;
+	m_pool->Release(m_owned_p, m_capacity, m_huge_pages);
+	if (m_memory_tracker != nullptr) {
+		m_memory_tracker->Release(m_capacity);
+	}
 }
 
 uint8_t* Buf::data_at(const n_t a_off) const {
@@ -186,11 +214,42 @@ void Buf::Resize(const sz_t new_sz) {
 		return;
 	}
 
-	auto* tmp_p = new uint8_t[new_sz];
-	ExternalMemory::Copy(tmp_p, m_owned_p, m_capacity);
+	// both blocks are alive during the copy.
+	n_t   new_capacity = new_sz;
+	auto* tmp_p        = Acquire(new_capacity);
+	ExternalMemory::Copy(tmp_p, m_owned_p, m_off);
+
+	m_pool->Release(m_owned_p, m_capacity, m_huge_pages);
+	if (m_memory_tracker != nullptr) {
+		m_memory_tracker->Release(m_capacity);
+	}
+	m_owned_p  = tmp_p;
+	m_active_p = m_owned_p;
+	m_capacity = new_capacity;
+}
+
+uint8_t* Buf::Acquire(n_t& capacity) const {
+	if (m_memory_tracker == nullptr) {
+		return m_pool->Acquire(capacity, m_huge_pages);
+	}
+
+	const n_t size_class = BufPool::SizeClass(capacity);
+	m_memory_tracker->Reserve(size_class);
+	try {
+		return m_pool->Acquire(capacity, m_huge_pages);
+	} catch (...) {
+		// the block never came, so neither may its reservation stay.
+		m_memory_tracker->Release(size_class);
+		throw;
+	}
+}
 
-	delete[] m_owned_p;
-	m_owned_p = tmp_p;
+void Buf::Grow(const n_t min_capacity) {
+	if (min_capacity <= m_capacity) {
+		return;
+	}
+	// doubling keeps the copies of a buffer that is appended to piece by piece linear in its size.
+	Resize(std::max(min_capacity, 2 * m_capacity));
 }
 
 sz_t Buf::Size() const {
@@ -0,0 +1,170 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/cor/lyt/buf_pool.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cor/lyt/buf_pool.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/common/assert.hpp"
+#include <bit>     // std::bit_ceil
+#include <cstdint> // uintptr_t
+#include <new>     // std::bad_alloc
+#if defined(__linux__)
+#include <sys/mman.h> // mmap, munmap, madvise
+#endif
+
+namespace fastlanes {
+
+BufPool::BufPool(const n_t max_retained_bytes)
+    : m_max_retained_bytes(max_retained_bytes)
+    , m_retained_bytes(0) {
+}
+
+BufPool::~BufPool() {
+	Trim();
+}
+
+uint8_t* BufPool::Acquire(n_t& capacity, const bool huge_pages) {
+	capacity           = SizeClass(capacity);
+	const bool is_huge = IsHuge(capacity, huge_pages);
+	{
+		const std::lock_guard lock(m_mutex);
+
+		auto& free_blocks = is_huge ? m_free_huge_blocks : m_free_blocks;
+		auto  it          = free_blocks.find(capacity);
+		if (it != free_blocks.end() && !it->second.empty()) {
+			uint8_t* block = it->second.back();
+			it->second.pop_back();
+			m_retained_bytes -= capacity;
+			return block;
+		}
+	}
+
+	return is_huge ? AllocateHuge(capacity) : new uint8_t[capacity];
+}
+
+void BufPool::Release(uint8_t* block, const n_t capacity, const bool huge_pages) {
+	FLS_ASSERT_NOT_NULL_POINTER(block)
+	FLS_ASSERT_E(capacity, SizeClass(capacity))
+
+	const bool is_huge = IsHuge(capacity, huge_pages);
+	{
+		const std::lock_guard lock(m_mutex);
+
+		if (m_retained_bytes + capacity <= m_max_retained_bytes) {
+			(is_huge ? m_free_huge_blocks : m_free_blocks)[capacity].push_back(block);
+			m_retained_bytes += capacity;
+			return;
+		}
+	}
+
+	if (is_huge) {
+		FreeHuge(block, capacity);
+	} else {
+		delete[] block;
+	}
+}
+
+void BufPool::Trim() {
+	const std::lock_guard lock(m_mutex);
+
+	for (auto& [capacity, blocks] : m_free_blocks) {
+		for (auto* block : blocks) {
+			delete[] block;
+		}
+	}
+	for (auto& [capacity, blocks] : m_free_huge_blocks) {
+		for (auto* block : blocks) {
+			FreeHuge(block, capacity);
+		}
+	}
+	m_free_blocks.clear();
+	m_free_huge_blocks.clear();
+	m_retained_bytes = 0;
+}
+
+n_t BufPool::RetainedBytes() const {
+	const std::lock_guard lock(m_mutex);
+	return m_retained_bytes;
+}
+
+n_t BufPool::SizeClass(const n_t capacity) {
+	return capacity <= MIN_BLOCK_SIZE ? MIN_BLOCK_SIZE : std::bit_ceil(capacity);
+}
+
+bool BufPool::IsHuge(const n_t capacity, const bool huge_pages) {
+	return huge_pages && capacity >= HUGE_PAGE_SIZE;
+}
+
+uint8_t* BufPool::AllocateHuge(const n_t capacity) {
+#if defined(__linux__)
+	// explicit huge pages only exist if the administrator reserved them.
+	auto* block = static_cast<uint8_t*>(
+	    mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0));
+	if (block == MAP_FAILED) {
+		// transparent huge pages need a 2 MiB aligned range: over-map by one huge page and trim both ends.
+		const n_t mapped_size = capacity + HUGE_PAGE_SIZE;
+		void*     mapped      = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapped == MAP_FAILED) {
+			throw std::bad_alloc();
+		}
+		const auto mapped_begin = reinterpret_cast<uintptr_t>(mapped);
+		const auto begin        = (mapped_begin + HUGE_PAGE_SIZE - 1) & ~(uintptr_t {HUGE_PAGE_SIZE} - 1);
+		if (begin != mapped_begin) {
+			munmap(mapped, begin - mapped_begin);
+		}
+		if (const n_t tail_size = mapped_begin + mapped_size - (begin + capacity); tail_size != 0) {
+			munmap(reinterpret_cast<void*>(begin + capacity), tail_size);
+		}
+		block = reinterpret_cast<uint8_t*>(begin);
+		madvise(block, capacity, MADV_HUGEPAGE);
+	}
+
+	// fault the pages in now; once pooled, the block is reused without faulting again.
+	for (n_t offset {0}; offset < capacity; offset += MIN_BLOCK_SIZE) {
+		block[offset] = 0;
+	}
+	return block;
+#else
+	return new uint8_t[capacity];
+#endif
+}
+
+void BufPool::FreeHuge(uint8_t* block, const n_t capacity) {
+#if defined(__linux__)
+	munmap(block, capacity);
+#else
+	static_cast<void>(capacity);
+	delete[] block;
+#endif
+}
+
+BufPool& BufPool::Global() {
+	// never destroyed, so buffers released during static destruction still find it.
+	static auto* pool = new BufPool {CFG::BufPool::MAX_RETAINED_BYTES};
+	return *pool;
+}
+
+BufPool& BufPool::ForNode(const n_t node) {
+	static std::mutex              mutex;
+	static std::map<n_t, BufPool*> pools;
+	const std::lock_guard          lock(mutex);
+	auto&                          pool = pools[node];
+	if (pool == nullptr) {
+		// never destroyed, like Global().
+		pool = new BufPool {CFG::BufPool::MAX_RETAINED_BYTES};
+	}
+	return *pool;
+}
+
+static thread_local BufPool* local_pool {nullptr};
+
+BufPool& BufPool::Local() {
+	return local_pool != nullptr ? *local_pool : Global();
+}
+
+void BufPool::SetLocal(BufPool* pool) {
+	local_pool = pool;
+}
+
+} // namespace fastlanes
@@ -0,0 +1,68 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/cor/lyt/memory_tracker.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cor/lyt/memory_tracker.hpp"
+#include "fls/common/assert.hpp"
+#include <string>
+
+namespace fastlanes {
+
+MemoryTracker::MemoryTracker(const n_t budget)
+    : m_used {0}
+    , m_peak {0}
+    , m_budget {budget} {
+}
+
+void MemoryTracker::Reserve(const n_t n_bytes) {
+	if (!TryReserve(n_bytes)) {
+		throw MemoryBudgetException("Memory budget of " + std::to_string(Budget()) + " bytes exceeded: " +
+		                            std::to_string(Used()) + " bytes are in use and " + std::to_string(n_bytes) +
+		                            " more were requested.");
+	}
+}
+
+bool MemoryTracker::TryReserve(const n_t n_bytes) {
+	n_t used = m_used.load(std::memory_order_relaxed);
+	do {
+		const n_t budget = m_budget.load(std::memory_order_relaxed);
+		if (budget != 0 && used + n_bytes > budget) {
+			return false;
+		}
+	} while (!m_used.compare_exchange_weak(used, used + n_bytes, std::memory_order_relaxed));
+
+	n_t peak = m_peak.load(std::memory_order_relaxed);
+	while (used + n_bytes > peak &&
+	       !m_peak.compare_exchange_weak(peak, used + n_bytes, std::memory_order_relaxed)) {
+	}
+	return true;
+}
+
+void MemoryTracker::Release(const n_t n_bytes) {
+	[[maybe_unused]] const n_t used = m_used.fetch_sub(n_bytes, std::memory_order_relaxed);
+	FLS_ASSERT_LE(n_bytes, used)
+}
+
+bool MemoryTracker::Fits(const n_t n_bytes) const {
+	const n_t budget = m_budget.load(std::memory_order_relaxed);
+	return budget == 0 || m_used.load(std::memory_order_relaxed) + n_bytes <= budget;
+}
+
+n_t MemoryTracker::Used() const {
+	return m_used.load(std::memory_order_relaxed);
+}
+
+n_t MemoryTracker::Peak() const {
+	return m_peak.load(std::memory_order_relaxed);
+}
+
+n_t MemoryTracker::Budget() const {
+	return m_budget.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::SetBudget(const n_t budget) {
+	m_budget.store(budget, std::memory_order_relaxed);
+}
+
+} // namespace fastlanes
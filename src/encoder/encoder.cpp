@@ -12,31 +12,55 @@
 #include "fls/expression/interpreter.hpp"         // for Interpreter
 #include "fls/expression/physical_expression.hpp" // for PhysicalExpr
 #include "fls/file/file_header.hpp"
+#include "fls/filter/bloom_filter.hpp" // for BloomFilter
 #include "fls/io/file.hpp" // for File
 #include "fls/std/filesystem.hpp"
-#include "fls/std/vector.hpp"     // for vector
-#include "fls/table/rowgroup.hpp" // for Rowgroup
+#include "fls/std/vector.hpp"                // for vector
+#include "fls/table/global_dictionary.hpp"   // for GlobalDictionary
+#include "fls/table/rowgroup.hpp"            // for Rowgroup
+#include "fls/table/shared_symbol_table.hpp" // for SharedSymbolTable
+#include "fls/table/table.hpp"               // for Table
 #include <cstdint>
 #include <fls/io/io.hpp>
 #include <memory> // for unique_ptr
 
 namespace fastlanes {
 
+// appends what the rowgroups share, ahead of the rowgroups themselves, and records the offset it was written at.
+template <typename SHARED_T>
+static void WriteShared(SHARED_T& shared, Buf& buf, io& file_io, n_t& cur_rowgroup_offset) {
+	shared.Write(buf);
+	shared.offset = cur_rowgroup_offset;
+	IO::append(file_io, buf);
+	cur_rowgroup_offset = cur_rowgroup_offset + buf.Size();
+	buf.Reset();
+}
+
 void Encoder::encode(const Connection& connection, const path& file_path) {
 	// init
-	Buf buf; // TODO[memory pool]
+	Buf buf {Buf::DEFAULT_CAPACITY, connection.m_config->enable_huge_pages}; // from BufPool::Global()
 
 	n_t cur_rowgroup_offset {sizeof(FileHeader)};
 	io  file_io = make_unique<File>(file_path); // TODO[io]
 
+	// what the rowgroups share goes first, so the rowgroups know where it is when they are encoded.
+	for (const auto& global_dictionary : GlobalDictionary::Collect(*connection.m_table)) {
+		WriteShared(*global_dictionary, buf, file_io, cur_rowgroup_offset);
+	}
+	for (const auto& symbol_table : SharedSymbolTable::Collect(*connection.m_table)) {
+		WriteShared(*symbol_table, buf, file_io, cur_rowgroup_offset);
+	}
+
 	for (n_t rowgroup_idx {0}; rowgroup_idx < connection.m_table->get_n_rowgroups(); ++rowgroup_idx) {
 		[[maybe_unused]] auto& rowgroup_descriptor =
 		    connection.m_table_descriptor->m_rowgroup_descriptors[rowgroup_idx];
 		[[maybe_unused]] const auto& rowgroup = *connection.m_table->m_rowgroups[rowgroup_idx];
 
+		// an entry point per vector: rowgroups sized by a byte budget can hold more than CFG::N_VEC_PER_RG vectors.
+		vector<uint8_t> helper_buffer(sizeof(entry_point_t) * rowgroup_descriptor->m_n_vec);
+
 		// write each column
 		for (auto& column_descriptor : rowgroup_descriptor->m_column_descriptors) {
-			uint8_t helper_buffer[sizeof(entry_point_t) * (CFG::N_VEC_PER_RG)]; // todo [fix me]
 
 			// interpret
 			InterpreterState state;
@@ -50,7 +74,12 @@ void Encoder::encode(const Connection& connection, const path& file_path) {
 			}
 
 			physical_expr_up->Finalize();
-			physical_expr_up->Flush(buf, *column_descriptor, helper_buffer);
+			physical_expr_up->Flush(buf, *column_descriptor, helper_buffer.data());
+
+			if (connection.m_config->enable_bloom_filter) {
+				column_descriptor->bloom_filter =
+				    BloomFilter::Build(rowgroup.internal_rowgroup[column_descriptor->idx]);
+			}
 		}
 
 		IO::append(file_io, buf);
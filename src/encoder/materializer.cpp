@@ -10,6 +10,7 @@
 #include "fls/common/common.hpp"
 #include "fls/common/string.hpp"
 #include "fls/expression/alp_expression.hpp"
+#include "fls/expression/boolean_operator.hpp"
 #include "fls/expression/cross_rle_operator.hpp"
 #include "fls/expression/decoding_operator.hpp"
 #include "fls/expression/dict_expression.hpp"
@@ -184,6 +185,9 @@ struct material_visitor {
 	void operator()(const sp<dec_validitymask_opr>& opr, up<TypedCol<uint8_t>>& typed_col) const {
 		opr->Materialize(vec_idx, *typed_col);
 	}
+	void operator()(const sp<dec_boolean_opr>& opr, up<TypedCol<uint8_t>>& typed_col) const {
+		opr->Materialize(vec_idx, *typed_col);
+	}
 	void operator()(const auto& opr, auto& col) const {
 		FLS_UNREACHABLE_WITH_TYPES(opr, col);
 	}
@@ -195,16 +199,19 @@ void Materializer::Materialize(const vector<sp<PhysicalExpr>>& expressions, n_t
 	FLS_ASSERT_E(expressions.size(), rowgroup.internal_rowgroup.size());
 
 	for (n_t col_idx {0}; col_idx < expressions.size(); ++col_idx) {
-		const auto& expr = expressions[col_idx];
-		auto&       col  = rowgroup.internal_rowgroup[col_idx];
-
-		FLS_ASSERT_NOT_EMPTY_VEC(expr->operators);
-
-		expr->PointTo(vec_idx);
-		visit(material_visitor {vec_idx}, expr->operators[expr->operators.size() - 1], col);
+		Materialize(expressions[col_idx], col_idx, vec_idx);
 	}
 
 	// rowgroup.n_tup = rowgroup.n_tup + CFG::VEC_SZ;
 }
 
+void Materializer::Materialize(const sp<PhysicalExpr>& expr, const n_t col_idx, const n_t vec_idx) const {
+	auto& col = rowgroup.internal_rowgroup[col_idx];
+
+	FLS_ASSERT_NOT_EMPTY_VEC(expr->operators);
+
+	expr->PointTo(vec_idx);
+	visit(material_visitor {vec_idx}, expr->operators[expr->operators.size() - 1], col);
+}
+
 } // namespace fastlanes
@@ -5,177 +5,291 @@
 // ────────────────────────────────────────────────────────
 #include "fls/encoder/random_accessor.hpp"
 #include "fls/cfg/cfg.hpp"
-#include "fls/cor/lyt/vec.hpp"
-#include "fls/expression/alp_expression.hpp"
-#include "fls/expression/cross_rle_operator.hpp"
-#include "fls/expression/data_type.hpp"
+#include "fls/common/assert.hpp"
+#include "fls/common/common.hpp"
 #include "fls/expression/decoding_operator.hpp"
 #include "fls/expression/dict_expression.hpp"
+#include "fls/expression/expression_executor.hpp"
 #include "fls/expression/frequency_operator.hpp"
 #include "fls/expression/fsst12_dict_operator.hpp"
-#include "fls/expression/fsst12_expression.hpp"
 #include "fls/expression/fsst_dict_operator.hpp"
-#include "fls/expression/fsst_expression.hpp"
-#include "fls/expression/null_operator.hpp"
 #include "fls/expression/physical_expression.hpp"
 #include "fls/expression/rle_expression.hpp"
-#include "fls/expression/slpatch_operator.hpp"
-#include "fls/expression/transpose_operator.hpp"
-#include "fls/primitive/copy/fls_copy.hpp"
-#include "fls/primitive/fls_memset/fls_memset.hpp"
-#include "fls/primitive/untranspose/untranspose.hpp"
-#include "fls/reader/segment.hpp"
+#include "fls/footer/rowgroup_descriptor.hpp"
+#include "fls/primitive/fsst/fsst.hpp"
+#include "fls/reader/rowgroup_reader.hpp"
+#include "fls/std/array.hpp"
 #include "fls/std/type_traits.hpp"
 #include "fls/table/rowgroup.hpp"
+#include "fls_gen/untranspose/untranspose.hpp"
 
 namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+// row `idx` of a vector is stored at position TransposedPositions()[idx] of its transposed form.
+static const array<uint16_t, CFG::VEC_SZ>& TransposedPositions() {
+	static const auto positions = [] {
+		array<uint16_t, CFG::VEC_SZ> iota {};
+		array<uint16_t, CFG::VEC_SZ> untransposed {};
+		for (n_t idx {0}; idx < CFG::VEC_SZ; ++idx) {
+			iota[idx] = static_cast<uint16_t>(idx);
+		}
+		generated::untranspose::fallback::scalar::untranspose_i(iota.data(), untransposed.data());
+		return untransposed;
+	}();
+	return positions;
+}
+
+template <typename PT>
+static void Emit(const PT* values, const n_t n_values, fls_value_t* out) {
+	for (n_t idx {0}; idx < n_values; ++idx) {
+		out[idx] = values[idx];
+	}
+}
 
-RandomAccessor::RandomAccessor() {
-	data_1_buf = make_unique<Buf>();
-	data_2_buf = make_unique<Buf>();
+// the fsst dictionaries keep one compressed string per entry; only the addressed entries are decompressed.
+template <typename DECODER_T, typename OPR>
+static void EmitFsstDictEntries(OPR& opr, DECODER_T& decoder, span<const uint64_t> entries, fls_value_t* out) {
+	auto* tmp_string = fsst_helper::decode_scratch().data();
+	for (n_t idx {0}; idx < entries.size(); ++idx) {
+		const auto  entry  = entries[idx];
+		const ofs_t offset = entry == 0 ? 0 : opr.Offsets()[entry - 1];
+		const len_t length = opr.Offsets()[entry] - offset;
+
+		n_t decoded_size {0};
+		if constexpr (std::is_same_v<DECODER_T, fsst_decoder_t>) {
+			decoded_size = fsst_decompress(&decoder,
+			                               length,
+			                               const_cast<uint8_t*>(opr.Bytes() + offset),
+			                               CFG::String::max_bytes_per_string,
+			                               tmp_string);
+		} else {
+			decoded_size = fsst12_decompress(&decoder,
+			                                 length,
+			                                 const_cast<uint8_t*>(opr.Bytes() + offset),
+			                                 CFG::String::max_bytes_per_string,
+			                                 tmp_string);
+		}
+		FLS_ASSERT_LE(decoded_size, CFG::String::max_bytes_per_string)
+		out[idx] = string(reinterpret_cast<const char*>(tmp_string), decoded_size);
+	}
 }
 
-// struct random_accessor_visitor {
-//	explicit random_accessor_visitor(n_t vec_idx,  RandomAccessor& random_accessor)
-//	    : vec_idx(vec_idx),
-//	    random_accessor(random_accessor){};
-//
-//	template <typename PT>
-//	void operator()(const sp<dec_uncompressed_opr<PT>>& opr) const {
-//		for (n_t idx {0}; idx < CFG::VEC_SZ; ++idx) {
-//			// fixme (reserve and memcopy);
-//			typed_col->data.push_back(opr->Data()[idx]);
-//		}
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_unffor_opr<PT>>& opr) const {
-//		copy<PT>(opr->Data(),reinterpret_cast<PT*>(random_accessor.data_1_buf->data()));
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_unffor_opr<PT>>& opr) const {
-//		copy<PT>(opr->Data(), reinterpret_cast<PT*>(random_accessor.data_1_buf->data()));
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_alp_opr<PT>>& opr) const {
-//		copy<PT>(opr->decoded_arr, reinterpret_cast<PT*>(random_accessor.data_1_buf->data()));
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_alp_rd_opr<PT>>& opr) const {
-//		copy<PT>(opr->glue_arr, reinterpret_cast<PT*>(random_accessor.data_1_buf->data()));
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_constant_opr<PT>>& opr) const {
-//		fls_memset<PT>(&opr->value, reinterpret_cast<PT*>(random_accessor.data_1_buf->data()));
-//	}
-//	void operator()(const sp<dec_constant_str_opr>& opr) const {
-//		const auto constant_value_size = static_cast<len_t>(opr->bytes.size());
-//		fls_memset<len_t>(&constant_value_size, reinterpret_cast<len_t*>(random_accessor.data_1_buf->data()));
-//		// optimize
-//		for (n_t idx {0}; idx < CFG::VEC_SZ; ++idx) {
-//			str_col->byte_arr.insert(str_col->byte_arr.end(), opr->bytes.begin(), opr->bytes.end());
-//		}
-//	}
-//	template <typename PT>
-//	void operator()(const sp<PhysicalExpr>& expr) const {
-//		auto visitor = [this, &typed_col](auto&& arg) {
-//			(*this)(std::forward<decltype(arg)>(arg), typed_col);
-//		};
-//		visit(visitor, expr->operators[expr->operators.size() - 1]);
-//	}
-//	void operator()(const sp<PhysicalExpr>& expr) const {
-//		auto visitor = [this, &typed_col](auto&& arg) {
-//			(*this)(std::forward<decltype(arg)>(arg), typed_col);
-//		};
-//		visit(visitor, expr->operators[0]);
-//	}
-//	void operator()(const sp<dec_struct_opr>& struct_expr) const {
-//	}
-//	void operator()(const sp<dec_fls_str_uncompressed_opr>& opr) const {
-//		for (n_t idx {0}; idx < CFG::VEC_SZ; ++idx) {
-//			str_col->length_arr.push_back(opr->Length()[idx]);
-//		}
-//		const size_t old_size = str_col->byte_arr.size(); // Save the current size
-//		str_col->byte_arr.resize(old_size + opr->byte_arr_segment.Size());
-//		std::memcpy(str_col->byte_arr.data() + old_size, opr->Data(), opr->byte_arr_segment.Size());
-//	}
-//	void operator()(const sp<dec_fsst_opr>& opr) const {
-//		opr->Decode(str_col->byte_arr, str_col->length_arr);
-//	}
-//	void operator()(const sp<dec_fsst12_opr>& opr) const {
-//		opr->Decode(str_col->byte_arr, str_col->length_arr);
-//	}
-//	// DICT
-//	template <typename KEY_PT, typename INDEX_PT>
-//	void operator()(const sp<dec_dict_opr<KEY_PT, INDEX_PT>>& dict_expr) const {
-//		const auto* key_p   = dict_expr->Keys();
-//		const auto* index_p = dict_expr->Index();
-//
-//		for (n_t idx {0}; idx < CFG::VEC_SZ; ++idx) {
-//			typed_col->data.push_back(key_p[index_p[idx]]);
-//		}
-//	}
-//	template <typename INDEX_PT>
-//	void operator()(const sp<dec_dict_opr<fls_string_t, INDEX_PT>>& opr) const {
-//		opr->Decode(str_col->byte_arr, str_col->length_arr);
-//	}
-//	template <typename INDEX_PT>
-//	void operator()(const sp<dec_fsst_dict_opr<INDEX_PT>>& opr) const {
-//		opr->Decode(str_col->byte_arr, str_col->length_arr);
-//	}
-//	template <typename INDEX_PT>
-//	void operator()(const sp<dec_fsst12_dict_opr<INDEX_PT>>& opr) const {
-//		opr->Decode(str_col->byte_arr, str_col->length_arr);
-//	}
-//	template <typename KEY_PT, typename INDEX_PT>
-//	void operator()(const sp<dec_rle_map_opr<KEY_PT, INDEX_PT>>& opr) const {
-//		opr->Decode(vec_idx, typed_col->data);
-//	}
-//	template <typename INDEX_PT>
-//	void operator()(const sp<dec_rle_map_opr<fls_string_t, INDEX_PT>>& opr) const {
-//		opr->Decode(vec_idx, typed_col->byte_arr, typed_col->length_arr);
-//	}
-//
-//	template <typename PT>
-//	void operator()(const sp<dec_null_opr<PT>>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_transpose_opr<PT>>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_slpatch_opr<PT>>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_frequency_opr<PT>>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	void operator()(const sp<dec_frequency_str_opr>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	template <typename PT>
-//	void operator()(const sp<dec_cross_rle_opr<PT>>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	void operator()(const sp<dec_cross_rle_opr<fls_string_t>>& opr) const {
-//		opr->Materialize(vec_idx, *typed_col);
-//	}
-//	void operator()(const auto& opr, auto& col) const { FLS_UNREACHABLE_WITH_TYPES(opr, col); }
-//	//
-//	n_t vec_idx;
-//	RandomAccessor& random_accessor;
-// };
-//
-// void RandomAccessor::RandomAccess(const vector<sp<PhysicalExpr>>& expressions, n_t val_idx) {
-//	FLS_ASSERT_E(expressions.size(), rowgroup.internal_rowgroup.size());
-//
-//	for (n_t col_idx {0}; col_idx < expressions.size(); ++col_idx) {
-//		const auto& expr = expressions[col_idx];
-//
-//		FLS_ASSERT_NOT_EMPTY_VEC(expr->operators);
-//
-//		visit(random_accessor_visitor {val_idx,*this}, expr->operators[expr->operators.size() - 1]);
-//	}
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * index_access_visitor
+\*--------------------------------------------------------------------------------------------------------------------*/
+// reads the dictionary index of the selected rows; false if the index is encoded in a way that needs the whole vector.
+template <typename INDEX_PT>
+struct index_access_visitor {
+	bool operator()(sp<dec_unffor_opr<INDEX_PT>>& opr) {
+		opr->Gather(vec_idx, idxs, out);
+		return true;
+	}
+	bool operator()(sp<dec_uncompressed_opr<INDEX_PT>>& opr) {
+		opr->Gather(vec_idx, idxs, out);
+		return true;
+	}
+	bool operator()(auto&) {
+		return false;
+	}
+
+	n_t                   vec_idx;
+	span<const vec_idx_t> idxs;
+	INDEX_PT*             out;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * random_access_visitor
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct random_access_visitor {
+	template <typename PT>
+	bool operator()(sp<dec_uncompressed_opr<PT>>& opr) {
+		if constexpr (std::is_same_v<PT, str_pt>) {
+			return false;
+		} else {
+			PT values[CFG::VEC_SZ];
+			opr->Gather(vec_idx, idxs, values);
+			Emit(values, idxs.size(), out);
+			return true;
+		}
+	}
+	bool operator()(sp<dec_fls_str_uncompressed_opr>& opr) {
+		opr->PointTo(vec_idx);
+		const auto* length_arr = opr->Length();
+		const auto* bytes      = reinterpret_cast<const char*>(opr->Data());
+
+		// the strings of a vector are stored back to back; walk the lengths up to the last selected row.
+		ofs_t     offset {0};
+		vec_idx_t row_idx {0};
+		for (n_t idx {0}; idx < idxs.size(); ++idx) {
+			for (; row_idx < idxs[idx]; ++row_idx) {
+				offset += length_arr[row_idx];
+			}
+			out[idx] = string(bytes + offset, length_arr[row_idx]);
+		}
+		return true;
+	}
+	template <typename PT>
+	bool operator()(sp<dec_unffor_opr<PT>>& opr) {
+		// ffor works on the unsigned type; signed columns are read back as such.
+		PT values[CFG::VEC_SZ];
+		opr->Gather(vec_idx, idxs, values);
+		if (is_signed) {
+			Emit(reinterpret_cast<const std::make_signed_t<PT>*>(values), idxs.size(), out);
+		} else {
+			Emit(values, idxs.size(), out);
+		}
+		return true;
+	}
+	template <typename PT>
+	bool operator()(sp<dec_constant_opr<PT>>& opr) {
+		if constexpr (std::is_same_v<PT, str_pt>) {
+			return false;
+		} else {
+			for (n_t idx {0}; idx < idxs.size(); ++idx) {
+				out[idx] = opr->value;
+			}
+			return true;
+		}
+	}
+	bool operator()(sp<dec_constant_str_opr>& opr) {
+		const string value {opr->bytes.begin(), opr->bytes.end()};
+		for (n_t idx {0}; idx < idxs.size(); ++idx) {
+			out[idx] = value;
+		}
+		return true;
+	}
+	template <typename PT>
+	bool operator()(sp<dec_frequency_opr<PT>>& opr) {
+		PT values[CFG::VEC_SZ];
+		opr->Gather(vec_idx, idxs, values);
+		Emit(values, idxs.size(), out);
+		return true;
+	}
+	template <typename KEY_PT, typename INDEX_PT>
+	bool operator()(sp<dec_dict_opr<KEY_PT, INDEX_PT>>& opr) {
+		if constexpr (std::is_same_v<KEY_PT, fls_string_t>) {
+			return false;
+		} else {
+			// a patched index needs the whole vector.
+			INDEX_PT index[CFG::VEC_SZ];
+			if (expr.operators.size() != 2 ||
+			    !visit(index_access_visitor<INDEX_PT> {vec_idx, idxs, index}, expr.operators[0])) {
+				return false;
+			}
+			KEY_PT values[CFG::VEC_SZ];
+			opr->Gather({index, idxs.size()}, values);
+			Emit(values, idxs.size(), out);
+			return true;
+		}
+	}
+	template <typename INDEX_PT>
+	bool operator()(sp<dec_fsst_dict_opr<INDEX_PT>>& opr) {
+		return FsstDict(*opr, opr->fsst_decoder);
+	}
+	template <typename INDEX_PT>
+	bool operator()(sp<dec_fsst12_dict_opr<INDEX_PT>>& opr) {
+		return FsstDict(*opr, opr->fsst12_decoder);
+	}
+	template <typename KEY_PT, typename INDEX_PT>
+	bool operator()(sp<dec_rle_map_opr<KEY_PT, INDEX_PT>>& opr) {
+		if constexpr (std::is_same_v<KEY_PT, fls_string_t>) {
+			return false;
+		} else {
+			// the run index of every row is a cheap integer decode; only the runs of the selected rows are read.
+			ExprExecutor::smart_execute(expr, vec_idx);
+			opr->PointTo(vec_idx);
+
+			const auto* rle_vals  = reinterpret_cast<const KEY_PT*>(opr->rle_vals_segment_view.data);
+			const auto& positions = TransposedPositions();
+			for (n_t idx {0}; idx < idxs.size(); ++idx) {
+				out[idx] = rle_vals[opr->idxs[positions[idxs[idx]]]];
+			}
+			return true;
+		}
+	}
+	bool operator()(auto&) {
+		return false;
+	}
+
+	template <typename OPR, typename DECODER_T>
+	bool FsstDict(OPR& opr, DECODER_T& decoder) {
+		using index_t = std::remove_cvref_t<decltype(*opr.index_arr)>;
+
+		index_t index[CFG::VEC_SZ];
+		if (expr.operators.size() != 2 ||
+		    !visit(index_access_visitor<index_t> {vec_idx, idxs, index}, expr.operators[0])) {
+			return false;
+		}
+		uint64_t entries[CFG::VEC_SZ];
+		for (n_t idx {0}; idx < idxs.size(); ++idx) {
+			entries[idx] = index[idx];
+		}
+		EmitFsstDictEntries(opr, decoder, {entries, idxs.size()}, out);
+		return true;
+	}
+
+	PhysicalExpr&         expr;
+	bool                  is_signed;
+	n_t                   vec_idx;
+	span<const vec_idx_t> idxs;
+	fls_value_t*          out;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RandomAccessor
+\*--------------------------------------------------------------------------------------------------------------------*/
+RandomAccessor::RandomAccessor(up<RowgroupReader> rowgroup_reader)
+    : m_rowgroup_reader(std::move(rowgroup_reader)) {
+}
+
+RandomAccessor::~RandomAccessor() = default;
+
+void RandomAccessor::RandomAccess(const n_t             col_idx,
+                                  const n_t             vec_idx,
+                                  span<const vec_idx_t> idxs,
+                                  fls_value_t*          out) {
+	FLS_ASSERT_L(col_idx, m_rowgroup_reader->m_expressions.size())
+	auto&       expr = *m_rowgroup_reader->m_expressions[col_idx];
+	const auto* column_descriptor =
+	    m_rowgroup_reader->get_descriptor().m_column_descriptors()->Get(static_cast<uint32_t>(col_idx));
+	const bool is_signed = IsSigned(column_descriptor->data_type());
+
+	if (!expr.operators.empty() && visit(random_access_visitor {expr, is_signed, vec_idx, idxs, out},
+	                                     expr.operators[expr.operators.size() - 1])) {
+		return;
+	}
+
+	for (n_t idx {0}; idx < idxs.size(); ++idx) {
+		out[idx] = MaterializedValue(col_idx, vec_idx * CFG::VEC_SZ + idxs[idx]);
+	}
+}
+
+fls_value_t RandomAccessor::MaterializedValue(const n_t col_idx, const n_t row_idx) {
+	if (m_materialized_rowgroup == nullptr) {
+		m_materialized_rowgroup = m_rowgroup_reader->materialize();
+		m_str_offsets.resize(m_materialized_rowgroup->internal_rowgroup.size());
+	}
+
+	auto& offsets = m_str_offsets[col_idx];
+	return visit(overloaded {
+	                 [&](const up<FLSStrColumn>& str_col) -> fls_value_t {
+		                 if (offsets.empty()) {
+			                 offsets.resize(str_col->length_arr.size() + 1, 0);
+			                 for (n_t idx {0}; idx < str_col->length_arr.size(); ++idx) {
+				                 offsets[idx + 1] = offsets[idx] + str_col->length_arr[idx];
+			                 }
+		                 }
+		                 const auto* bytes = reinterpret_cast<const char*>(str_col->byte_arr.data());
+		                 return string(bytes + offsets[row_idx], str_col->length_arr[row_idx]);
+	                 },
+	                 [&]<typename PT>(const up<TypedCol<PT>>& typed_col) -> fls_value_t {
+		                 return typed_col->data[row_idx];
+	                 },
+	                 [&](const auto& col) -> fls_value_t { FLS_UNREACHABLE_WITH_TYPE(col); },
+	             },
+	             m_materialized_rowgroup->internal_rowgroup[col_idx]);
+}
 
 } // namespace fastlanes
@@ -0,0 +1,157 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/expression/aggregate.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/expression/aggregate.hpp"
+#include "fls/common/common.hpp"
+#include <algorithm> // std::min, std::max
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+// integer sums wrap around, so they are added as unsigned to stay well defined.
+template <typename SUM_T>
+static SUM_T AddSum(const SUM_T left, const SUM_T right) {
+	if constexpr (std::is_floating_point_v<SUM_T>) {
+		return left + right;
+	} else {
+		return static_cast<SUM_T>(static_cast<u64_pt>(left) + static_cast<u64_pt>(right));
+	}
+}
+
+template <typename PT>
+static aggregate_sum_t<PT> MultiplySum(const PT value, const n_t n_repeats) {
+	using sum_t = aggregate_sum_t<PT>;
+	if constexpr (std::is_floating_point_v<PT>) {
+		return static_cast<sum_t>(value) * static_cast<sum_t>(n_repeats);
+	} else {
+		return static_cast<sum_t>(static_cast<u64_pt>(static_cast<sum_t>(value)) * static_cast<u64_pt>(n_repeats));
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Aggregate
+\*--------------------------------------------------------------------------------------------------------------------*/
+Aggregate::Aggregate(const AggregateT type)
+    : type(type) {
+}
+
+template <typename PT>
+void Aggregate::Update(const PT* values, const n_t n_values) {
+	if (n_values == 0) {
+		return;
+	}
+
+	switch (type) {
+	case AggregateT::SUM: {
+		aggregate_sum_t<PT> sum {0};
+		for (n_t idx {0}; idx < n_values; ++idx) {
+			sum = AddSum(sum, static_cast<aggregate_sum_t<PT>>(values[idx]));
+		}
+		UpdateSum<PT>(sum, n_values);
+		return;
+	}
+	case AggregateT::MIN:
+	case AggregateT::MAX: {
+		PT result = values[0];
+		for (n_t idx {1}; idx < n_values; ++idx) {
+			result = type == AggregateT::MIN ? std::min(result, values[idx]) : std::max(result, values[idx]);
+		}
+		Update<PT>(result, n_values);
+		return;
+	}
+	case AggregateT::COUNT:
+		UpdateCount(n_values);
+		return;
+	default:
+		FLS_UNREACHABLE()
+	}
+}
+
+template <typename PT>
+void Aggregate::Update(const PT value, const n_t n_repeats) {
+	if (n_repeats == 0) {
+		return;
+	}
+
+	switch (type) {
+	case AggregateT::SUM:
+		UpdateSum<PT>(MultiplySum(value, n_repeats), n_repeats);
+		return;
+	case AggregateT::MIN:
+	case AggregateT::MAX: {
+		m_count += n_repeats;
+		if (std::holds_alternative<std::monostate>(m_value)) {
+			m_value = value;
+			return;
+		}
+		auto& result = std::get<PT>(m_value);
+		result       = type == AggregateT::MIN ? std::min(result, value) : std::max(result, value);
+		return;
+	}
+	case AggregateT::COUNT:
+		UpdateCount(n_repeats);
+		return;
+	default:
+		FLS_UNREACHABLE()
+	}
+}
+
+template <typename PT>
+void Aggregate::UpdateSum(const aggregate_sum_t<PT> sum, const n_t n_values) {
+	m_count += n_values;
+	if (std::holds_alternative<std::monostate>(m_value)) {
+		m_value = sum;
+		return;
+	}
+	auto& result = std::get<aggregate_sum_t<PT>>(m_value);
+	result       = AddSum(result, sum);
+}
+
+void Aggregate::UpdateCount(const n_t n_values) {
+	m_count += n_values;
+}
+
+fls_value_t Aggregate::Result() const {
+	if (type == AggregateT::COUNT) {
+		return static_cast<u64_pt>(m_count);
+	}
+	return m_value;
+}
+
+template void Aggregate::Update<i08_pt>(const i08_pt* values, n_t n_values);
+template void Aggregate::Update<i16_pt>(const i16_pt* values, n_t n_values);
+template void Aggregate::Update<i32_pt>(const i32_pt* values, n_t n_values);
+template void Aggregate::Update<i64_pt>(const i64_pt* values, n_t n_values);
+template void Aggregate::Update<u08_pt>(const u08_pt* values, n_t n_values);
+template void Aggregate::Update<u16_pt>(const u16_pt* values, n_t n_values);
+template void Aggregate::Update<u32_pt>(const u32_pt* values, n_t n_values);
+template void Aggregate::Update<u64_pt>(const u64_pt* values, n_t n_values);
+template void Aggregate::Update<flt_pt>(const flt_pt* values, n_t n_values);
+template void Aggregate::Update<dbl_pt>(const dbl_pt* values, n_t n_values);
+
+template void Aggregate::Update<i08_pt>(i08_pt value, n_t n_repeats);
+template void Aggregate::Update<i16_pt>(i16_pt value, n_t n_repeats);
+template void Aggregate::Update<i32_pt>(i32_pt value, n_t n_repeats);
+template void Aggregate::Update<i64_pt>(i64_pt value, n_t n_repeats);
+template void Aggregate::Update<u08_pt>(u08_pt value, n_t n_repeats);
+template void Aggregate::Update<u16_pt>(u16_pt value, n_t n_repeats);
+template void Aggregate::Update<u32_pt>(u32_pt value, n_t n_repeats);
+template void Aggregate::Update<u64_pt>(u64_pt value, n_t n_repeats);
+template void Aggregate::Update<flt_pt>(flt_pt value, n_t n_repeats);
+template void Aggregate::Update<dbl_pt>(dbl_pt value, n_t n_repeats);
+
+template void Aggregate::UpdateSum<i08_pt>(aggregate_sum_t<i08_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<i16_pt>(aggregate_sum_t<i16_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<i32_pt>(aggregate_sum_t<i32_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<i64_pt>(aggregate_sum_t<i64_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<u08_pt>(aggregate_sum_t<u08_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<u16_pt>(aggregate_sum_t<u16_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<u32_pt>(aggregate_sum_t<u32_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<u64_pt>(aggregate_sum_t<u64_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<flt_pt>(aggregate_sum_t<flt_pt> sum, n_t n_values);
+template void Aggregate::UpdateSum<dbl_pt>(aggregate_sum_t<dbl_pt> sum, n_t n_values);
+
+} // namespace fastlanes
@@ -0,0 +1,181 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/expression/boolean_operator.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/expression/boolean_operator.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/common/alias.hpp"
+#include "fls/common/assert.hpp"
+#include "fls/expression/interpreter.hpp"
+#include "fls/expression/physical_expression.hpp"
+#include "fls/expression/selection_ds.hpp"
+#include "fls/reader/column_view.hpp"
+#include "fls/reader/segment.hpp"
+#include "fls/std/vector.hpp"
+#include "fls/table/rowgroup.hpp"
+#include <algorithm> // std::min
+#include <bit>       // std::popcount
+#include <cstdint>   // for uint8_t
+#include <cstring>   // std::memcpy, std::memset
+#include <utility>   // for std::move
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+static constexpr uint64_t ALL_SET_WORD {~uint64_t {0}};
+
+// spreads the 8 bits of `bits` over 8 bytes of 0 or 1, lowest bit first: the multiply copies the byte into every lane,
+// the mask keeps bit i in lane i, and the add carries every nonzero lane into its top bit.
+static uint64_t SpreadBits(const uint64_t bits) {
+	const uint64_t isolated = (bits * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+	return ((isolated + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * enc_boolean_opr
+\*--------------------------------------------------------------------------------------------------------------------*/
+enc_boolean_opr::enc_boolean_opr(const PhysicalExpr& /*physical_expr*/,
+                                 const col_pt&       column,
+                                 ColumnDescriptorT&  column_descriptor,
+                                 InterpreterState&   state)
+    : typed_column_view(column)
+    , bitmap {} {
+
+	bitmap_segment = make_unique<Segment>();
+
+	auto& [operator_tokens, operand_tokens] = *column_descriptor.encoding_rpn;
+	operand_tokens.emplace_back(state.cur_operand++);
+}
+
+void enc_boolean_opr::Encode() {
+	const auto* values = typed_column_view.Data();
+	FLS_ASSERT_NOT_NULL_POINTER(values)
+
+	uint64_t all_set {ALL_SET_WORD};
+	uint64_t any_set {0};
+	for (n_t word_idx {0}; word_idx < BooleanVector::N_WORDS; ++word_idx) {
+		uint64_t word {0};
+		for (n_t bit_idx {0}; bit_idx < 64; ++bit_idx) {
+			word |= static_cast<uint64_t>(values[word_idx * 64 + bit_idx] != 0) << bit_idx;
+		}
+		bitmap[word_idx] = word;
+		all_set &= word;
+		any_set |= word;
+	}
+
+	if (any_set == 0) {
+		bitmap_segment->Flush(bitmap, BooleanVector::ALL_FALSE_SIZE);
+		return;
+	}
+	if (all_set == ALL_SET_WORD) {
+		constexpr uint8_t ALL_TRUE {1};
+		bitmap_segment->Flush(&ALL_TRUE, BooleanVector::ALL_TRUE_SIZE);
+		return;
+	}
+	bitmap_segment->Flush(bitmap, BooleanVector::BITPACKED_SIZE);
+}
+
+void enc_boolean_opr::PointTo(const n_t vec_idx) {
+	typed_column_view.PointTo(vec_idx);
+}
+
+void enc_boolean_opr::MoveSegments(vector<up<Segment>>& segments) {
+	segments.push_back(std::move(bitmap_segment));
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * dec_boolean_opr
+\*--------------------------------------------------------------------------------------------------------------------*/
+dec_boolean_opr::dec_boolean_opr(const ColumnView& column_view, const n_t segment_idx)
+    : bitmap_segment_view(column_view.GetSegment(segment_idx))
+    , data {} {
+}
+
+void dec_boolean_opr::PointTo(const n_t vec_idx) {
+	bitmap_segment_view.PointTo(vec_idx);
+}
+
+uint64_t dec_boolean_opr::Word(const n_t word_idx) const {
+	switch (bitmap_segment_view.Size()) {
+	case BooleanVector::ALL_FALSE_SIZE:
+		return 0;
+	case BooleanVector::ALL_TRUE_SIZE:
+		return ALL_SET_WORD;
+	default: {
+		// a bitpacked vector may follow an all-true one, so its words are not necessarily aligned.
+		uint64_t word;
+		std::memcpy(&word, bitmap_segment_view.data + word_idx * sizeof(uint64_t), sizeof(uint64_t));
+		return word;
+	}
+	}
+}
+
+void dec_boolean_opr::Decode() {
+	const n_t size = bitmap_segment_view.Size();
+	if (size != BooleanVector::BITPACKED_SIZE) {
+		std::memset(data, size == BooleanVector::ALL_TRUE_SIZE ? 1 : 0, CFG::VEC_SZ);
+		return;
+	}
+
+	// eight values per multiply, no branch per value.
+	const auto* bitmap_bytes = reinterpret_cast<const uint8_t*>(bitmap_segment_view.data);
+	for (n_t byte_idx {0}; byte_idx < BooleanVector::BITPACKED_SIZE; ++byte_idx) {
+		const uint64_t values = SpreadBits(bitmap_bytes[byte_idx]);
+		std::memcpy(data + byte_idx * 8, &values, sizeof(uint64_t));
+	}
+}
+
+uint8_t* dec_boolean_opr::Data() {
+	return data;
+}
+
+void dec_boolean_opr::Materialize(const n_t vec_idx, TypedCol<uint8_t>& typed_col) {
+	typed_col.data.resize(typed_col.data.size() + CFG::VEC_SZ);
+	std::memcpy(typed_col.data.data() + vec_idx * CFG::VEC_SZ, data, CFG::VEC_SZ);
+}
+
+void dec_boolean_opr::Gather(const span<const vec_idx_t> idxs, uint8_t* out) const {
+	for (n_t idx {0}; idx < idxs.size(); ++idx) {
+		const n_t value_idx = idxs[idx];
+		out[idx]            = static_cast<uint8_t>((Word(value_idx / 64) >> (value_idx % 64)) & 1);
+	}
+}
+
+n_t dec_boolean_opr::CountTrue(const n_t n_values) const {
+	switch (bitmap_segment_view.Size()) {
+	case BooleanVector::ALL_FALSE_SIZE:
+		return 0;
+	case BooleanVector::ALL_TRUE_SIZE:
+		return n_values;
+	default:
+		break;
+	}
+
+	n_t n_true {0};
+	for (n_t word_idx {0}; word_idx < n_values / 64; ++word_idx) {
+		n_true += static_cast<n_t>(std::popcount(Word(word_idx)));
+	}
+	if (n_values % 64 != 0) {
+		const uint64_t mask = (uint64_t {1} << (n_values % 64)) - 1;
+		n_true += static_cast<n_t>(std::popcount(Word(n_values / 64) & mask));
+	}
+	return n_true;
+}
+
+void dec_boolean_opr::Select(const n_t n_values, SelectionDS& selection) const {
+	static_assert(BooleanVector::N_WORDS == std::tuple_size_v<decltype(selection.bitmap)>);
+
+	// the words past `n_values` hold the padding of the last vector, which is masked out.
+	for (n_t word_idx {0}; word_idx < BooleanVector::N_WORDS; ++word_idx) {
+		const n_t      first_value_idx = word_idx * 64;
+		const n_t      n_word_values   = n_values > first_value_idx ? std::min<n_t>(64, n_values - first_value_idx) : 0;
+		const uint64_t mask            = n_word_values == 64 ? ~uint64_t {0} : (uint64_t {1} << n_word_values) - 1;
+		selection.bitmap[word_idx]     = Word(word_idx) & mask;
+	}
+	selection.n_selected_values = static_cast<vec_idx_t>(CountTrue(n_values));
+	selection.use_bitmap        = true;
+}
+
+} // namespace fastlanes
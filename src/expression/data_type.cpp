@@ -76,6 +76,21 @@ uint64_t SizeOf(const DataType datatype) {
 	}
 }
 
+bool IsSigned(const DataType datatype) {
+	switch (datatype) {
+	case DataType::INT8:
+	case DataType::INT16:
+	case DataType::INT32:
+	case DataType::INT64:
+	case DataType::DECIMAL:
+	case DataType::DATE:
+	case DataType::TIMESTAMP:
+		return true;
+	default:
+		return false;
+	}
+}
+
 template <typename PT>
 DataType get_physical_type() {
 	if constexpr (std::is_same_v<PT, i64_pt>) {
@@ -88,6 +103,12 @@ DataType get_physical_type() {
 		return DataType::DOUBLE;
 	} else if constexpr (std::is_same_v<PT, u08_pt>) {
 		return DataType::UINT8;
+	} else if constexpr (std::is_same_v<PT, u16_pt>) {
+		return DataType::UINT16;
+	} else if constexpr (std::is_same_v<PT, u32_pt>) {
+		return DataType::UINT32;
+	} else if constexpr (std::is_same_v<PT, u64_pt>) {
+		return DataType::UINT64;
 	}
 	FLS_UNREACHABLE()
 };
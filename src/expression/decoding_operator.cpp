@@ -55,6 +55,42 @@ const PT* dec_unffor_opr<PT>::Data() {
 	return unffored_data;
 }
 
+template <typename PT>
+void dec_unffor_opr<PT>::Gather(n_t vec_idx, span<const vec_idx_t> idxs, PT* out) {
+	PointTo(vec_idx);
+
+	const uint8_t bw     = *reinterpret_cast<const bw_t*>(bw_segment_view.data);
+	const PT      base   = *reinterpret_cast<const PT*>(base_segment_view.data);
+	const auto*   in_p   = reinterpret_cast<const PT*>(bitpacked_segment_view.data);
+	const n_t     n_idxs = idxs.size();
+
+	if (bw == 0) {
+		for (n_t idx {0}; idx < n_idxs; ++idx) {
+			out[idx] = base;
+		}
+		return;
+	}
+
+	// value i lives in lane (i % N_LANES), at bit offset (i / N_LANES) * bw of that lane.
+	constexpr n_t N_BITS  = sizeof(PT) * 8;
+	constexpr n_t N_LANES = CFG::VEC_SZ / N_BITS;
+	const u64_pt  mask    = bw == 64 ? ~u64_pt {0} : (u64_pt {1} << bw) - 1;
+
+	for (n_t idx {0}; idx < n_idxs; ++idx) {
+		const n_t val_idx = idxs[idx];
+		const n_t lane    = val_idx % N_LANES;
+		const n_t bit     = (val_idx / N_LANES) * bw;
+		const n_t word    = bit / N_BITS;
+		const n_t shift   = bit % N_BITS;
+
+		u64_pt val = static_cast<u64_pt>(in_p[word * N_LANES + lane]) >> shift;
+		if (shift + bw > N_BITS) {
+			val |= static_cast<u64_pt>(in_p[(word + 1) * N_LANES + lane]) << (N_BITS - shift);
+		}
+		out[idx] = static_cast<PT>(static_cast<PT>(val & mask) + base);
+	}
+}
+
 template struct dec_unffor_opr<u64_pt>;
 template struct dec_unffor_opr<u32_pt>;
 template struct dec_unffor_opr<u16_pt>;
@@ -78,6 +114,16 @@ PT* dec_uncompressed_opr<PT>::Data() {
 	return reinterpret_cast<PT*>(data_segment.data);
 }
 
+template <typename PT>
+void dec_uncompressed_opr<PT>::Gather(const n_t vec_idx, span<const vec_idx_t> idxs, PT* out) {
+	PointTo(vec_idx);
+
+	const auto* data = Data();
+	for (n_t idx {0}; idx < idxs.size(); ++idx) {
+		out[idx] = data[idxs[idx]];
+	}
+}
+
 template struct dec_uncompressed_opr<i64_pt>;
 template struct dec_uncompressed_opr<i32_pt>;
 template struct dec_uncompressed_opr<i16_pt>;
@@ -99,6 +145,13 @@ dec_constant_opr<PT>::dec_constant_opr(const ColumnView& column_view) {
 	value = *reinterpret_cast<const PT*>(column_view.column_descriptor.max()->binary_data()->data());
 }
 
+template <typename PT>
+void dec_constant_opr<PT>::Gather(span<const vec_idx_t> idxs, PT* out) const {
+	for (n_t idx {0}; idx < idxs.size(); ++idx) {
+		out[idx] = value;
+	}
+}
+
 dec_constant_str_opr::dec_constant_str_opr(const ColumnView& column_view) {
 	bytes.resize(column_view.column_descriptor.max()->binary_data()->size());
 	memcpy(bytes.data(),
@@ -13,9 +13,12 @@
 #include "fls/expression/decoding_operator.hpp"
 #include "fls/expression/interpreter.hpp"
 #include "fls/expression/physical_expression.hpp"
+#include "fls/expression/selection_ds.hpp"
 #include "fls/reader/column_view.hpp"
+#include "fls/reader/global_dictionary_view.hpp"
 #include "fls/reader/segment.hpp"
 #include "fls/std/vector.hpp"
+#include "fls/table/global_dictionary.hpp"
 #include "fls/table/rowgroup.hpp"
 #include <cstdint>
 #include <utility> // for std::move
@@ -84,6 +87,9 @@ template struct enc_dict_opr<i08_pt>;
 template struct enc_dict_opr<dbl_pt>;
 template struct enc_dict_opr<flt_pt>;
 template struct enc_dict_opr<u08_pt>;
+template struct enc_dict_opr<u16_pt>;
+template struct enc_dict_opr<u32_pt>;
+template struct enc_dict_opr<u64_pt>;
 
 /*--------------------------------------------------------------------------------------------------------------------*\
  * enc_dict_opr
@@ -92,7 +98,8 @@ enc_dict_opr<fls_string_t>::enc_dict_opr(const PhysicalExpr& expr,
                                          const col_pt&       column,
                                          ColumnDescriptorT&  column_descriptor,
                                          InterpreterState&   state)
-    : col_view {column} {
+    : col_view {column}
+    , global_dictionary(nullptr) {
 	offset_segment = make_unique<Segment>();
 	bytes_segment  = make_unique<Segment>();
 
@@ -102,17 +109,39 @@ enc_dict_opr<fls_string_t>::enc_dict_opr(const PhysicalExpr& expr,
 	state.cur_operator++;
 }
 
+enc_dict_opr<fls_string_t>::enc_dict_opr(const PhysicalExpr&     expr,
+                                         const col_pt&           column,
+                                         ColumnDescriptorT&      column_descriptor,
+                                         InterpreterState&       state,
+                                         const GlobalDictionary& global_dictionary)
+    : col_view {column}
+    , global_dictionary(&global_dictionary) {
+
+	// where the dictionary is in the file, not segments of the rowgroup.
+	auto& [operator_tokens, operand_tokens] = *column_descriptor.encoding_rpn;
+	operand_tokens.emplace_back(global_dictionary.offset);
+	operand_tokens.emplace_back(global_dictionary.Size());
+	state.cur_operator++;
+}
+
 void enc_dict_opr<fls_string_t>::PointTo(n_t vec_idx) {
 }
 void enc_dict_opr<fls_string_t>::Encode() {
 }
 
 void enc_dict_opr<fls_string_t>::MoveSegments(vector<up<Segment>>& segments) {
+	if (global_dictionary != nullptr) {
+		return;
+	}
 	segments.push_back(std::move(offset_segment));
 	segments.push_back(std::move(bytes_segment));
 }
 
 void enc_dict_opr<fls_string_t>::Finalize() {
+	if (global_dictionary != nullptr) {
+		return;
+	}
+
 	auto length_buf = make_unique<Buf>();
 	auto bytes_buf  = make_unique<Buf>();
 	// init
@@ -160,6 +189,14 @@ const INDEX_PT* dec_dict_opr<KEY_PT, INDEX_PT>::Index() {
 	return index_arr;
 }
 
+template <typename KEY_PT, typename INDEX_PT>
+void dec_dict_opr<KEY_PT, INDEX_PT>::Gather(span<const INDEX_PT> gathered_index, KEY_PT* out) {
+	const auto* keys = Keys();
+	for (n_t idx {0}; idx < gathered_index.size(); ++idx) {
+		out[idx] = keys[gathered_index[idx]];
+	}
+}
+
 template struct dec_dict_opr<i64_pt, u32_pt>;
 template struct dec_dict_opr<i64_pt, u16_pt>;
 template struct dec_dict_opr<i64_pt, u08_pt>;
@@ -176,13 +213,39 @@ template struct dec_dict_opr<flt_pt, u32_pt>;
 template struct dec_dict_opr<flt_pt, u16_pt>;
 template struct dec_dict_opr<flt_pt, u08_pt>;
 template struct dec_dict_opr<u08_pt, u08_pt>;
+template struct dec_dict_opr<u16_pt, u16_pt>;
+template struct dec_dict_opr<u16_pt, u08_pt>;
+template struct dec_dict_opr<u32_pt, u32_pt>;
+template struct dec_dict_opr<u32_pt, u16_pt>;
+template struct dec_dict_opr<u32_pt, u08_pt>;
+template struct dec_dict_opr<u64_pt, u32_pt>;
+template struct dec_dict_opr<u64_pt, u16_pt>;
+template struct dec_dict_opr<u64_pt, u08_pt>;
 template <typename INDEX_PT>
 dec_dict_opr<fls_string_t, INDEX_PT>::dec_dict_opr(const PhysicalExpr& physical_expr,
                                                    const ColumnView&   column_view,
                                                    InterpreterState&   state)
-    : dict_offsets_segment(column_view.GetSegment(0))
-    , dict_bytes_segment(column_view.GetSegment(1))
-    , index_arr(nullptr) {
+    : index_arr(nullptr)
+    , global_dictionary(nullptr) {
+	const auto dict_offsets_segment = column_view.GetSegment(0);
+	const auto dict_bytes_segment   = column_view.GetSegment(1);
+	dict_offsets  = reinterpret_cast<const ofs_t*>(dict_offsets_segment.data_span.data());
+	dict_bytes    = reinterpret_cast<const uint8_t*>(dict_bytes_segment.data_span.data());
+	n_dict_values = dict_offsets_segment.data_span.size() / sizeof(ofs_t);
+
+	state.cur_operand = state.cur_operand - 1;
+	visit(DictExprVisitor<INDEX_PT> {index_arr}, physical_expr.operators[0]);
+}
+
+template <typename INDEX_PT>
+dec_dict_opr<fls_string_t, INDEX_PT>::dec_dict_opr(const PhysicalExpr&   physical_expr,
+                                                   GlobalDictionaryView& global_dictionary,
+                                                   InterpreterState&     state)
+    : dict_offsets(global_dictionary.Offsets())
+    , dict_bytes(global_dictionary.Bytes())
+    , n_dict_values(global_dictionary.Cardinality())
+    , index_arr(nullptr)
+    , global_dictionary(&global_dictionary) {
 
 	state.cur_operand = state.cur_operand - 1;
 	visit(DictExprVisitor<INDEX_PT> {index_arr}, physical_expr.operators[0]);
@@ -196,12 +259,12 @@ const INDEX_PT* dec_dict_opr<fls_string_t, INDEX_PT>::Index() {
 
 template <typename INDEX_PT>
 const ofs_t* dec_dict_opr<fls_string_t, INDEX_PT>::Offsets() {
-	return reinterpret_cast<ofs_t*>(dict_offsets_segment.data_span.data());
+	return dict_offsets;
 }
 
 template <typename INDEX_PT>
 const uint8_t* dec_dict_opr<fls_string_t, INDEX_PT>::Bytes() {
-	return reinterpret_cast<uint8_t*>(dict_bytes_segment.data_span.data());
+	return dict_bytes;
 };
 
 template <typename INDEX_PT>
@@ -233,6 +296,27 @@ void dec_dict_opr<fls_string_t, INDEX_PT>::Decode(vector<uint8_t>& byte_arr_vec,
 	}
 }
 
+template <typename INDEX_PT>
+void dec_dict_opr<fls_string_t, INDEX_PT>::Filter(const StrPredicate& predicate,
+                                                  const n_t           n_values,
+                                                  SelectionDS&        selection) {
+	// a shared dictionary keeps its matches across the rowgroups of the file.
+	const auto& entry_match_arr = global_dictionary != nullptr
+	                                  ? global_dictionary->Match(predicate)
+	                                  : matcher.Match(predicate, Offsets(), Bytes(), n_dict_values);
+
+	const auto* index = Index();
+	vec_idx_t   n_selected_values {0};
+	for (vec_idx_t idx {0}; idx < n_values; ++idx) {
+		if (entry_match_arr[index[idx]]) {
+			selection.idx_arr[n_selected_values++] = idx;
+		}
+	}
+
+	selection.n_selected_values = n_selected_values;
+	selection.use_bitmap        = false;
+}
+
 template struct dec_dict_opr<fls_string_t, u32_pt>;
 template struct dec_dict_opr<fls_string_t, u16_pt>;
 template struct dec_dict_opr<fls_string_t, u08_pt>;
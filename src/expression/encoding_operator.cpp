@@ -20,6 +20,7 @@
 #include "fls/std/type_traits.hpp"
 #include "fls/std/variant.hpp"
 #include "fls/std/vector.hpp"
+#include "fls/table/global_dictionary.hpp"
 #include "fls/table/rowgroup.hpp"
 #include <cstring>
 #include <stdexcept> // for std::runtime_error
@@ -108,13 +109,32 @@ template struct enc_dict_map_opr<dbl_pt, u08_pt>;
 template struct enc_dict_map_opr<flt_pt, u32_pt>;
 template struct enc_dict_map_opr<flt_pt, u16_pt>;
 template struct enc_dict_map_opr<flt_pt, u08_pt>;
+template struct enc_dict_map_opr<u16_pt, u16_pt>;
+template struct enc_dict_map_opr<u16_pt, u08_pt>;
+template struct enc_dict_map_opr<u32_pt, u32_pt>;
+template struct enc_dict_map_opr<u32_pt, u16_pt>;
+template struct enc_dict_map_opr<u32_pt, u08_pt>;
+template struct enc_dict_map_opr<u64_pt, u32_pt>;
+template struct enc_dict_map_opr<u64_pt, u16_pt>;
+template struct enc_dict_map_opr<u64_pt, u08_pt>;
 
 template <typename INDEX_PT>
 enc_dict_map_opr<fls_string_t, INDEX_PT>::enc_dict_map_opr(const PhysicalExpr& expr,
                                                            const col_pt&       column,
                                                            ColumnDescriptorT&  column_descriptor,
                                                            InterpreterState&   state)
-    : column_view(column) {
+    : column_view(column)
+    , bimap(&column_view.stats.bimap) {
+}
+
+template <typename INDEX_PT>
+enc_dict_map_opr<fls_string_t, INDEX_PT>::enc_dict_map_opr(const PhysicalExpr&     expr,
+                                                           const col_pt&           column,
+                                                           ColumnDescriptorT&      column_descriptor,
+                                                           InterpreterState&       state,
+                                                           const GlobalDictionary& global_dictionary)
+    : column_view(column)
+    , bimap(&global_dictionary.bimap) {
 }
 
 template <typename INDEX_PT>
@@ -124,8 +144,7 @@ void enc_dict_map_opr<fls_string_t, INDEX_PT>::PointTo(n_t vec_idx) {
 
 template <typename INDEX_PT>
 void enc_dict_map_opr<fls_string_t, INDEX_PT>::Map() {
-	[[maybe_unused]] const auto& dict =
-	    column_view.stats.bimap; // todo get bimap_frequency from bimap_frequency operator
+	[[maybe_unused]] const auto& dict = *bimap; // todo get bimap_frequency from bimap_frequency operator
 
 	const auto* string_p_arr = column_view.String_p();
 	const auto* lengths_arr  = column_view.Length();
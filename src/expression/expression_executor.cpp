@@ -7,13 +7,19 @@
 #include "fls/common/alias.hpp"
 #include "fls/common/assert.hpp"
 #include "fls/common/common.hpp"
+#include "fls/expression/aggregate.hpp"
 #include "fls/expression/alp_expression.hpp"
 #include "fls/expression/analyze_operator.hpp"
+#include "fls/expression/boolean_operator.hpp"
+#include "fls/expression/cross_rle_operator.hpp"
 #include "fls/expression/data_parallelize_patch_operator.hpp"
 #include "fls/expression/decoding_operator.hpp"
+#include "fls/expression/dict_expression.hpp"
 #include "fls/expression/encoding_operator.hpp"
 #include "fls/expression/frequency_operator.hpp"
+#include "fls/expression/fsst12_dict_operator.hpp"
 #include "fls/expression/fsst12_expression.hpp"
+#include "fls/expression/fsst_dict_operator.hpp"
 #include "fls/expression/fsst_expression.hpp"
 #include "fls/expression/null_operator.hpp"
 #include "fls/expression/physical_expression.hpp"
@@ -21,11 +27,17 @@
 #include "fls/expression/rle_expression.hpp"
 #include "fls/expression/rsum_operator.hpp"
 #include "fls/expression/scan_operator.hpp"
+#include "fls/expression/selection_ds.hpp"
 #include "fls/expression/slpatch_operator.hpp"
 #include "fls/expression/transpose_operator.hpp"
 #include "fls/expression/validitymask_operator.hpp"
+#include "fls/std/type_traits.hpp"
 #include "fls/std/variant.hpp"
-#include <variant> // for std::monostate
+#include "fls_gen/unffor/unffor.hpp"
+#include "fls_gen/untranspose/untranspose.hpp"
+#include <algorithm>     // std::lower_bound, std::min
+#include <unordered_set> // std::unordered_set
+#include <variant>       // for std::monostate
 
 namespace fastlanes {
 
@@ -229,6 +241,12 @@ struct operator_visitor {
 	void operator()(sp<enc_validitymask_opr>& opr) {
 		opr->to_validitymask();
 	}
+	void operator()(sp<enc_boolean_opr>& opr) {
+		opr->Encode();
+	}
+	void operator()(sp<dec_boolean_opr>& opr) {
+		opr->Decode();
+	}
 	//
 	template <typename PT>
 	void operator()(sp<enc_data_parallel_patch_opr<PT>>& opr) {
@@ -258,6 +276,411 @@ void ExprExecutor::smart_execute(PhysicalExpr& expr, n_t vec_idx) {
 	}
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * gather
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename INDEX_PT>
+struct dict_index_gather_visitor {
+	bool operator()(sp<dec_unffor_opr<INDEX_PT>>& opr) {
+		opr->Gather(vec_idx, idxs, out);
+		return true;
+	}
+	bool operator()(auto&) {
+		return false;
+	}
+
+	n_t                   vec_idx;
+	span<const vec_idx_t> idxs;
+	INDEX_PT*             out;
+};
+
+struct gather_visitor {
+	template <typename PT>
+	bool operator()(sp<dec_uncompressed_opr<PT>>& opr) {
+		if constexpr (std::is_same_v<PT, str_pt>) {
+			return false;
+		} else {
+			opr->Gather(vec_idx, idxs, reinterpret_cast<PT*>(out));
+			return true;
+		}
+	}
+	template <typename PT>
+	bool operator()(sp<dec_unffor_opr<PT>>& opr) {
+		opr->Gather(vec_idx, idxs, reinterpret_cast<PT*>(out));
+		return true;
+	}
+	template <typename PT>
+	bool operator()(sp<dec_constant_opr<PT>>& opr) {
+		if constexpr (std::is_same_v<PT, str_pt>) {
+			return false;
+		} else {
+			opr->Gather(idxs, reinterpret_cast<PT*>(out));
+			return true;
+		}
+	}
+	template <typename PT>
+	bool operator()(sp<dec_frequency_opr<PT>>& opr) {
+		opr->Gather(vec_idx, idxs, reinterpret_cast<PT*>(out));
+		return true;
+	}
+	template <typename KEY_PT, typename INDEX_PT>
+	bool operator()(sp<dec_dict_opr<KEY_PT, INDEX_PT>>& opr) {
+		if constexpr (std::is_same_v<KEY_PT, fls_string_t>) {
+			return false;
+		} else {
+			// only a plain FFOR-ed index can be gathered; patched indexes need the whole vector.
+			if (expr.operators.size() != 2) {
+				return false;
+			}
+			INDEX_PT gathered_index[CFG::VEC_SZ];
+			if (!visit(dict_index_gather_visitor<INDEX_PT> {vec_idx, idxs, gathered_index}, expr.operators[0])) {
+				return false;
+			}
+			opr->Gather({gathered_index, idxs.size()}, reinterpret_cast<KEY_PT*>(out));
+			return true;
+		}
+	}
+	bool operator()(sp<dec_boolean_opr>& opr) {
+		opr->PointTo(vec_idx);
+		opr->Gather(idxs, reinterpret_cast<uint8_t*>(out));
+		return true;
+	}
+	bool operator()(auto&) {
+		return false;
+	}
+
+	PhysicalExpr&         expr;
+	n_t                   vec_idx;
+	span<const vec_idx_t> idxs;
+	std::byte*            out;
+};
+
+bool ExprExecutor::gather(PhysicalExpr& expr, n_t vec_idx, span<const vec_idx_t> idxs, std::byte* out) {
+	if (expr.operators.empty()) {
+		return false;
+	}
+
+	return visit(gather_visitor {expr, vec_idx, idxs, out}, expr.operators.back());
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * filter
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct str_filter_visitor {
+	void operator()(sp<dec_fsst_opr>& opr) {
+		opr->Filter(predicate, n_values, selection);
+	}
+	void operator()(sp<dec_fsst12_opr>& opr) {
+		opr->Filter(predicate, n_values, selection);
+	}
+	template <typename INDEX_PT>
+	void operator()(sp<dec_fsst_dict_opr<INDEX_PT>>& opr) {
+		opr->Filter(predicate, n_values, selection);
+	}
+	template <typename INDEX_PT>
+	void operator()(sp<dec_fsst12_dict_opr<INDEX_PT>>& opr) {
+		opr->Filter(predicate, n_values, selection);
+	}
+	template <typename INDEX_PT>
+	void operator()(sp<dec_dict_opr<fls_string_t, INDEX_PT>>& opr) {
+		opr->Filter(predicate, n_values, selection);
+	}
+	void operator()(auto&) {
+		FLS_UNREACHABLE()
+	}
+
+	const StrPredicate& predicate;
+	n_t                 n_values;
+	SelectionDS&        selection;
+};
+
+struct str_filterable_visitor {
+	bool operator()(const sp<dec_fsst_opr>&) {
+		return true;
+	}
+	bool operator()(const sp<dec_fsst12_opr>&) {
+		return true;
+	}
+	template <typename INDEX_PT>
+	bool operator()(const sp<dec_fsst_dict_opr<INDEX_PT>>&) {
+		return true;
+	}
+	template <typename INDEX_PT>
+	bool operator()(const sp<dec_fsst12_dict_opr<INDEX_PT>>&) {
+		return true;
+	}
+	template <typename INDEX_PT>
+	bool operator()(const sp<dec_dict_opr<fls_string_t, INDEX_PT>>&) {
+		return true;
+	}
+	bool operator()(const auto&) {
+		return false;
+	}
+};
+
+bool ExprExecutor::filter(
+    PhysicalExpr& expr, n_t vec_idx, n_t n_values, const StrPredicate& predicate, SelectionDS& selection) {
+	if (expr.operators.empty() || !visit(str_filterable_visitor {}, expr.operators.back())) {
+		return false;
+	}
+
+	// decodes the offsets or the dictionary index only; the strings themselves stay compressed.
+	smart_execute(expr, vec_idx);
+	expr.PointTo(vec_idx);
+	visit(str_filter_visitor {predicate, n_values, selection}, expr.operators.back());
+	return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * select
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct boolean_select_visitor {
+	bool operator()(sp<dec_boolean_opr>& opr) {
+		opr->PointTo(vec_idx);
+		opr->Select(n_values, selection);
+		return true;
+	}
+	bool operator()(auto&) {
+		return false;
+	}
+
+	n_t          vec_idx;
+	n_t          n_values;
+	SelectionDS& selection;
+};
+
+bool ExprExecutor::select(PhysicalExpr& expr, n_t vec_idx, n_t n_values, SelectionDS& selection) {
+	if (expr.operators.empty()) {
+		return false;
+	}
+
+	return visit(boolean_select_visitor {vec_idx, n_values, selection}, expr.operators.back());
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * aggregate
+\*--------------------------------------------------------------------------------------------------------------------*/
+// MIN and MAX may read the padding of the last vector: it repeats the last value, so it never changes the result.
+struct aggregate_visitor {
+	template <typename PT>
+	static constexpr bool IS_AGGREGATABLE = std::is_arithmetic_v<PT>;
+
+	template <typename PT>
+	bool operator()(sp<dec_uncompressed_opr<PT>>& opr) {
+		if constexpr (!IS_AGGREGATABLE<PT>) {
+			return false;
+		} else {
+			for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+				opr->PointTo(vec_idx);
+				aggregate.Update<PT>(opr->Data(), NValues(vec_idx));
+			}
+			return true;
+		}
+	}
+	template <typename PT>
+	bool operator()(sp<dec_unffor_opr<PT>>& opr) {
+		// ffor works on the unsigned type; signed columns are aggregated as such.
+		if (is_signed) {
+			return Unffor<std::make_signed_t<PT>>(*opr);
+		}
+		return Unffor<PT>(*opr);
+	}
+	template <typename PT>
+	bool operator()(sp<dec_constant_opr<PT>>& opr) {
+		if constexpr (!IS_AGGREGATABLE<PT>) {
+			return false;
+		} else {
+			aggregate.Update<PT>(opr->value, n_tuples);
+			return true;
+		}
+	}
+	template <typename PT>
+	bool operator()(sp<dec_frequency_opr<PT>>& opr) {
+		// the frequent value plus the exceptions of the vector; the exception positions are sorted.
+		for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+			opr->PointTo(vec_idx);
+			const auto* exc_arr      = reinterpret_cast<const PT*>(opr->exceptions_segment.data);
+			const auto* exc_pos_arr  = reinterpret_cast<const vec_idx_t*>(opr->exceptions_position_segment.data);
+			const auto  n_exceptions = *reinterpret_cast<const vec_idx_t*>(opr->n_exceptions_segment.data);
+			const n_t   n_values     = NValues(vec_idx);
+			const auto  n_selected_exceptions =
+			    static_cast<n_t>(std::lower_bound(exc_pos_arr, exc_pos_arr + n_exceptions, n_values) - exc_pos_arr);
+
+			aggregate.Update<PT>(exc_arr, n_selected_exceptions);
+			aggregate.Update<PT>(opr->frequent_val, n_values - n_selected_exceptions);
+		}
+		return true;
+	}
+	template <typename KEY_PT, typename INDEX_PT>
+	bool operator()(sp<dec_dict_opr<KEY_PT, INDEX_PT>>& opr) {
+		if constexpr (!IS_AGGREGATABLE<KEY_PT>) {
+			return false;
+		} else {
+			// a patched index is not aggregated here.
+			if (expr.operators.size() != 2) {
+				return false;
+			}
+
+			// every key occurs in the rowgroup, so MIN and MAX only read the dictionary.
+			if (aggregate.type == AggregateT::MIN || aggregate.type == AggregateT::MAX) {
+				aggregate.Update<KEY_PT>(opr->Keys(), opr->key_segment_view.data_span.size() / sizeof(KEY_PT));
+				return true;
+			}
+
+			KEY_PT values[CFG::VEC_SZ];
+			for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+				ExprExecutor::smart_execute(expr, vec_idx);
+				const n_t n_values = NValues(vec_idx);
+				opr->Gather({opr->Index(), n_values}, values);
+				aggregate.Update<KEY_PT>(values, n_values);
+			}
+			return true;
+		}
+	}
+	template <typename KEY_PT, typename INDEX_PT>
+	bool operator()(sp<dec_rle_map_opr<KEY_PT, INDEX_PT>>& opr) {
+		if constexpr (!IS_AGGREGATABLE<KEY_PT>) {
+			return false;
+		} else {
+			// MIN and MAX only read the run values, the run index is not decoded at all.
+			if (aggregate.type == AggregateT::MIN || aggregate.type == AggregateT::MAX) {
+				for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+					opr->PointTo(vec_idx);
+					aggregate.Update<KEY_PT>(reinterpret_cast<const KEY_PT*>(opr->rle_vals_segment_view.data),
+					                         opr->rle_vals_segment_view.Size() / sizeof(KEY_PT));
+				}
+				return true;
+			}
+
+			for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+				ExprExecutor::smart_execute(expr, vec_idx);
+				opr->PointTo(vec_idx);
+				const auto* rle_vals = reinterpret_cast<const KEY_PT*>(opr->rle_vals_segment_view.data);
+				const n_t   n_values = NValues(vec_idx);
+
+				// the run index is transposed, which does not matter for a full vector.
+				for (n_t idx {0}; idx < CFG::VEC_SZ; ++idx) {
+					opr->temporary_tranposed_arr[idx] = rle_vals[opr->idxs[idx]];
+				}
+				if (n_values == CFG::VEC_SZ) {
+					aggregate.Update<KEY_PT>(opr->temporary_tranposed_arr, n_values);
+				} else {
+					KEY_PT values[CFG::VEC_SZ];
+					::generated::untranspose::fallback::scalar::untranspose_i(opr->temporary_tranposed_arr, values);
+					aggregate.Update<KEY_PT>(values, n_values);
+				}
+			}
+			return true;
+		}
+	}
+	bool operator()(sp<dec_boolean_opr>& opr) {
+		// true is 1 and false is 0, so the popcount of a vector answers SUM, MIN and MAX alike.
+		for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+			opr->PointTo(vec_idx);
+			const n_t n_values = NValues(vec_idx);
+			const n_t n_true   = opr->CountTrue(n_values);
+			aggregate.Update<u08_pt>(u08_pt {1}, n_true);
+			aggregate.Update<u08_pt>(u08_pt {0}, n_values - n_true);
+		}
+		return true;
+	}
+	bool operator()(auto&) {
+		return false;
+	}
+
+	// SUM over FFOR is n * base + sum(packed): the packed deltas are summed without adding the base to each of them,
+	// and a vector of bit width 0 is not read at all. the base is the minimum of the unsigned values, so for a signed
+	// column narrower than the 64-bit sum the formula only holds modulo its width; those vectors are decoded.
+	template <typename PT, typename OPR>
+	bool Unffor(OPR& opr) {
+		using unsigned_t = std::make_unsigned_t<PT>;
+		using sum_t      = aggregate_sum_t<PT>;
+
+		for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
+			opr.PointTo(vec_idx);
+			const auto bw       = *reinterpret_cast<const bw_t*>(opr.bw_segment_view.data);
+			const PT   base     = *reinterpret_cast<const PT*>(opr.base_segment_view.data);
+			const n_t  n_values = NValues(vec_idx);
+
+			if (bw == 0) {
+				aggregate.Update<PT>(base, n_values);
+				continue;
+			}
+
+			if (aggregate.type != AggregateT::SUM || (std::is_signed_v<PT> && sizeof(PT) < sizeof(sum_t))) {
+				opr.Unffor(vec_idx);
+				aggregate.Update<PT>(reinterpret_cast<const PT*>(opr.Data()), n_values);
+				continue;
+			}
+
+			constexpr unsigned_t zero {0};
+			unsigned_t           deltas[CFG::VEC_SZ];
+			::generated::unffor::fallback::scalar::unffor(
+			    reinterpret_cast<const unsigned_t*>(opr.bitpacked_segment_view.data), deltas, bw, &zero);
+
+			u64_pt sum = static_cast<u64_pt>(static_cast<sum_t>(base)) * n_values;
+			for (n_t idx {0}; idx < n_values; ++idx) {
+				sum += deltas[idx];
+			}
+			aggregate.UpdateSum<PT>(static_cast<sum_t>(sum), n_values);
+		}
+		return true;
+	}
+
+	[[nodiscard]] n_t NValues(const n_t vec_idx) const {
+		return std::min(CFG::VEC_SZ, n_tuples - vec_idx * CFG::VEC_SZ);
+	}
+
+	PhysicalExpr& expr;
+	bool          is_signed;
+	n_t           n_tuples;
+	n_t           n_vec;
+	Aggregate&    aggregate;
+};
+
+bool ExprExecutor::aggregate(PhysicalExpr& expr, const bool is_signed, const n_t n_tuples, Aggregate& aggregate) {
+	if (expr.operators.empty()) {
+		return false;
+	}
+
+	const n_t n_vec = (n_tuples + CFG::VEC_SZ - 1) / CFG::VEC_SZ;
+	return visit(aggregate_visitor {expr, is_signed, n_tuples, n_vec, aggregate}, expr.operators.back());
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * memory_usage
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct memory_usage_visitor {
+	void operator()(const sp<PhysicalExpr>& expr) {
+		if (counted.insert(expr.get()).second) {
+			n_bytes += sizeof(PhysicalExpr);
+			for (const auto& expr_operator : expr->operators) {
+				visit(*this, expr_operator);
+			}
+		}
+	}
+	template <typename OPR>
+	void operator()(const sp<OPR>& opr) {
+		if (opr != nullptr && counted.insert(opr.get()).second) {
+			n_bytes += sizeof(OPR);
+		}
+	}
+	void operator()(const std::monostate&) {
+	}
+
+	std::unordered_set<const void*>& counted;
+	n_t&                             n_bytes;
+};
+
+n_t ExprExecutor::memory_usage(const vector<sp<PhysicalExpr>>& exprs) {
+	std::unordered_set<const void*> counted;
+	n_t                             n_bytes {0};
+	for (const auto& expr : exprs) {
+		memory_usage_visitor {counted, n_bytes}(expr);
+	}
+	return n_bytes;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * CountOperator
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -470,6 +893,12 @@ struct operator_counter_visitor {
 	}
 	void operator()(sp<dec_validitymask_opr>& opr) {
 	}
+	void operator()(sp<enc_boolean_opr>& opr) {
+		physical_expr.n_active_operators++;
+	}
+	void operator()(sp<dec_boolean_opr>& opr) {
+		physical_expr.n_active_operators++;
+	}
 
 	PhysicalExpr& physical_expr;
 };
@@ -218,6 +218,27 @@ void dec_frequency_opr<PT>::Decode(n_t vec_idx) {
 	}
 }
 
+template <typename PT>
+void dec_frequency_opr<PT>::Gather(n_t vec_idx, span<const vec_idx_t> idxs, PT* out) {
+	PointTo(vec_idx);
+
+	const auto* exc_arr      = reinterpret_cast<const PT*>(exceptions_segment.data);
+	const auto* exc_pos_arr  = reinterpret_cast<const vec_idx_t*>(exceptions_position_segment.data);
+	const auto  n_exceptions = *reinterpret_cast<const vec_idx_t*>(n_exceptions_segment.data);
+
+	FLS_ASSERT_CORRECT_POS(n_exceptions)
+
+	// both lists are sorted, so a single merge pass finds the selected exceptions.
+	vec_idx_t exc_idx {0};
+	for (n_t idx {0}; idx < idxs.size(); ++idx) {
+		const auto val_idx = idxs[idx];
+		while (exc_idx < n_exceptions && exc_pos_arr[exc_idx] < val_idx) {
+			exc_idx++;
+		}
+		out[idx] = exc_idx < n_exceptions && exc_pos_arr[exc_idx] == val_idx ? exc_arr[exc_idx] : frequent_val;
+	}
+}
+
 template <typename PT>
 void dec_frequency_opr<PT>::Materialize(n_t vec_idx, TypedCol<PT>& typed_col) {
 	typed_col.data.resize(typed_col.data.size() + CFG::VEC_SZ);
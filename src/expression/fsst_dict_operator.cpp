@@ -14,6 +14,7 @@
 #include "fls/expression/decoding_operator.hpp"
 #include "fls/expression/interpreter.hpp"
 #include "fls/expression/physical_expression.hpp"
+#include "fls/expression/selection_ds.hpp"
 #include "fls/primitive/fsst/fsst.hpp"
 #include "fls/reader/column_view.hpp"
 #include "fls/reader/segment.hpp"
@@ -135,9 +136,9 @@ dec_fsst_dict_opr<INDEX_PT>::dec_fsst_dict_opr(const PhysicalExpr& physical_expr
     , fsst_offset_segment_view(column_view.GetSegment(
           static_cast<uint32_t>((*column_view.column_descriptor.encoding_rpn()
                                       ->operand_tokens())[static_cast<uint32_t>(state.cur_operand - 0)])))
-    , index_arr(nullptr) {
+    , index_arr(nullptr)
+    , tmp_string(fsst_helper::decode_scratch()) {
 	visit(FSSTDictExprVisitor<INDEX_PT> {index_arr}, physical_expr.operators[0]);
-	tmp_string.resize(CFG::String::max_bytes_per_string);
 
 	fsst_header_segment_view.PointTo(0);
 	fsst_bytes_segment_view.PointTo(0);
@@ -206,6 +207,34 @@ void dec_fsst_dict_opr<INDEX_PT>::Decode(vector<uint8_t>& byte_arr_vec, vector<o
 	}
 }
 
+template <typename INDEX_PT>
+void dec_fsst_dict_opr<INDEX_PT>::Filter(const StrPredicate& predicate, const n_t n_values, SelectionDS& selection) {
+	if (!matcher || matcher->GetPredicate() != predicate) {
+		matcher = make_unique<FsstMatcher<fsst_decoder_t>>(fsst_decoder, predicate);
+
+		// the dictionary is shared by the whole rowgroup: match every entry once per predicate.
+		const n_t n_entries = fsst_offset_segment_view.data_span.size() / sizeof(ofs_t);
+		entry_match_arr.resize(n_entries);
+		ofs_t offset {0};
+		for (n_t entry_idx {0}; entry_idx < n_entries; ++entry_idx) {
+			const auto offset_next     = Offsets()[entry_idx];
+			entry_match_arr[entry_idx] = matcher->Match(Bytes() + offset, offset_next - offset);
+			offset                     = offset_next;
+		}
+	}
+
+	const auto* index = Index();
+	vec_idx_t   n_selected_values {0};
+	for (vec_idx_t idx {0}; idx < n_values; ++idx) {
+		if (entry_match_arr[index[idx]]) {
+			selection.idx_arr[n_selected_values++] = idx;
+		}
+	}
+
+	selection.n_selected_values = n_selected_values;
+	selection.use_bitmap        = false;
+}
+
 template struct dec_fsst_dict_opr<u32_pt>;
 template struct dec_fsst_dict_opr<u16_pt>;
 template struct dec_fsst_dict_opr<u08_pt>;
@@ -14,11 +14,14 @@
 #include "fls/expression/physical_expression.hpp"
 #include "fls/expression/rsum_operator.hpp"
 #include "fls/expression/scan_operator.hpp"
+#include "fls/expression/selection_ds.hpp"
 #include "fls/primitive/fsst/fsst.hpp"
 #include "fls/reader/column_view.hpp"
 #include "fls/reader/segment.hpp"
+#include "fls/reader/symbol_table_view.hpp"
 #include "fls/std/variant.hpp"
 #include "fls/table/rowgroup.hpp"
+#include "fls/table/shared_symbol_table.hpp"
 #include "fls_gen/untranspose/untranspose.hpp"
 #include <cstdint>
 #include <utility> // for std::move
@@ -28,26 +31,42 @@ namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*\
  * enc_fsst_opr
 \*--------------------------------------------------------------------------------------------------------------------*/
-enc_fsst_opr::enc_fsst_opr(const PhysicalExpr& expr,
-                           const col_pt&       column,
-                           ColumnDescriptorT&  column_descriptor,
-                           InterpreterState&   state)
-    : str_col_view(column)
-    , fsst_encoder_p(fsst_helper::make_fsst(str_col_view)) {
+static void InitFSSTSegments(enc_fsst_opr& opr, ColumnDescriptorT& column_descriptor, InterpreterState& state) {
 	auto& [operator_tokens, operand_tokens] = *column_descriptor.encoding_rpn;
 
-	fsst_bytes.resize(str_col_view.stats.maximum_n_bytes_p_value * CFG::VEC_SZ * 2);
+	opr.fsst_bytes.resize(opr.str_col_view.stats.maximum_n_bytes_p_value * CFG::VEC_SZ * 2);
 
-	fsst_header_segment = make_unique<Segment>();
-	fsst_header_segment->MakeBlockBased();
-	fsst_bytes_segment  = make_unique<Segment>();
-	fsst_offset_segment = make_unique<Segment>();
+	opr.fsst_header_segment = make_unique<Segment>();
+	opr.fsst_header_segment->MakeBlockBased();
+	opr.fsst_bytes_segment  = make_unique<Segment>();
+	opr.fsst_offset_segment = make_unique<Segment>();
 
 	operand_tokens.emplace_back(state.cur_operand++);
 	operand_tokens.emplace_back(state.cur_operand++);
 	operand_tokens.emplace_back(state.cur_operand++);
 }
 
+enc_fsst_opr::enc_fsst_opr(const PhysicalExpr& expr,
+                           const col_pt&       column,
+                           ColumnDescriptorT&  column_descriptor,
+                           InterpreterState&   state)
+    : str_col_view(column)
+    , fsst_encoder_p(fsst_helper::make_fsst(str_col_view))
+    , is_shared(false) {
+	InitFSSTSegments(*this, column_descriptor, state);
+}
+
+enc_fsst_opr::enc_fsst_opr(const PhysicalExpr&      expr,
+                           const col_pt&            column,
+                           ColumnDescriptorT&       column_descriptor,
+                           InterpreterState&        state,
+                           const SharedSymbolTable& symbol_table)
+    : str_col_view(column)
+    , fsst_encoder_p(fsst_duplicate(symbol_table.fsst_encoder))
+    , is_shared(true) {
+	InitFSSTSegments(*this, column_descriptor, state);
+}
+
 enc_fsst_opr::~enc_fsst_opr() {
 	fsst_destroy(fsst_encoder_p);
 }
@@ -57,7 +76,8 @@ void enc_fsst_opr::PointTo(const n_t vec_idx) {
 }
 
 void enc_fsst_opr::Finalize() {
-	const auto size = fsst_export(fsst_encoder_p, fsst_header);
+	// a shared symbol table is stored once for the file, ahead of the rowgroups.
+	const auto size = is_shared ? 0 : fsst_export(fsst_encoder_p, fsst_header);
 	fsst_header_segment->Flush(fsst_header, size);
 }
 
@@ -111,7 +131,10 @@ struct FSSTExprVisitor {
 dec_fsst_opr::dec_fsst_opr(PhysicalExpr& physical_expr, const ColumnView& column_view, InterpreterState& state)
     : fsst_header_segment_view(column_view.GetSegment(0))
     , fsst_bytes_segment_view(column_view.GetSegment(1))
-    , offset_arr(nullptr) {
+    , tmp_string(fsst_helper::decode_scratch())
+    , offset_arr(nullptr)
+    , decoder_p(&fsst_decoder)
+    , symbol_table(nullptr) {
 
 	visit(FSSTExprVisitor {*this}, physical_expr.operators.back());
 	FLS_ASSERT_NOT_NULL_POINTER(offset_arr)
@@ -121,8 +144,22 @@ dec_fsst_opr::dec_fsst_opr(PhysicalExpr& physical_expr, const ColumnView& column
 	    fsst_import(&fsst_decoder, reinterpret_cast<uint8_t*>(fsst_header_segment_view.data));
 
 	FLS_ASSERT_E(symbol_table_size, fsst_header_segment_view.data_span.size())
+}
+
+dec_fsst_opr::dec_fsst_opr(PhysicalExpr&                    physical_expr,
+                           const ColumnView&                column_view,
+                           SymbolTableView<fsst_decoder_t>& a_symbol_table,
+                           InterpreterState&                state)
+    : fsst_header_segment_view(column_view.GetSegment(0))
+    , fsst_bytes_segment_view(column_view.GetSegment(1))
+    , fsst_decoder {}
+    , tmp_string(fsst_helper::decode_scratch())
+    , offset_arr(nullptr)
+    , decoder_p(&a_symbol_table.Decoder())
+    , symbol_table(&a_symbol_table) {
 
-	tmp_string.resize(CFG::String::max_bytes_per_string);
+	visit(FSSTExprVisitor {*this}, physical_expr.operators.back());
+	FLS_ASSERT_NOT_NULL_POINTER(offset_arr)
 }
 
 void dec_fsst_opr::PointTo(const n_t vec_n) {
@@ -152,7 +189,7 @@ void dec_fsst_opr::Decode(vector<uint8_t>& byte_arr_vec, vector<ofs_t>& length_v
 		}
 
 		const auto decoded_size = static_cast<ofs_t>(fsst_decompress(
-		    &fsst_decoder, encoded_size, in_byte_arr, CFG::String::max_bytes_per_string, tmp_string.data()));
+		    decoder_p, encoded_size, in_byte_arr, CFG::String::max_bytes_per_string, tmp_string.data()));
 
 		FLS_ASSERT_L(decoded_size, tmp_string.capacity())
 
@@ -167,4 +204,29 @@ void dec_fsst_opr::Decode(vector<uint8_t>& byte_arr_vec, vector<ofs_t>& length_v
 	//
 	FLS_ASSERT_NOT_NULL_POINTER(length_pointer)
 }
+
+void dec_fsst_opr::Filter(const StrPredicate& predicate, const n_t n_values, SelectionDS& selection) {
+	// a shared symbol table keeps the compiled predicate across the rowgroups of the file.
+	if (symbol_table == nullptr && (!matcher || matcher->GetPredicate() != predicate)) {
+		matcher = make_unique<FsstMatcher<fsst_decoder_t>>(fsst_decoder, predicate);
+	}
+	const auto& predicate_matcher = symbol_table != nullptr ? symbol_table->Matcher(predicate) : *matcher;
+
+	generated::untranspose::fallback::scalar::untranspose_i(offset_arr, untrasposed_offset);
+	const auto* in_byte_arr = reinterpret_cast<const uint8_t*>(fsst_bytes_segment_view.data);
+
+	vec_idx_t n_selected_values {0};
+	ofs_t     offset {0};
+	for (vec_idx_t idx {0}; idx < n_values; ++idx) {
+		const auto offset_next = untrasposed_offset[idx];
+		if (predicate_matcher.Match(in_byte_arr + offset, offset_next - offset)) {
+			selection.idx_arr[n_selected_values++] = idx;
+		}
+		offset = offset_next;
+	}
+
+	selection.n_selected_values = n_selected_values;
+	selection.use_bitmap        = false;
+}
+
 } // namespace fastlanes
@@ -12,6 +12,7 @@
 #include "fls/common/string.hpp"
 #include "fls/expression/alp_expression.hpp"
 #include "fls/expression/analyze_operator.hpp"
+#include "fls/expression/boolean_operator.hpp"
 #include "fls/expression/cross_rle_operator.hpp"
 #include "fls/expression/data_parallelize_patch_operator.hpp"
 #include "fls/expression/data_type.hpp"
@@ -33,8 +34,13 @@
 #include "fls/expression/transpose_operator.hpp"
 #include "fls/expression/validitymask_operator.hpp"
 #include "fls/reader/column_view.hpp"
+#include "fls/reader/global_dictionary_view.hpp"
+#include "fls/reader/rowgroup_reader.hpp"
+#include "fls/reader/symbol_table_view.hpp"
 #include "fls/std/type_traits.hpp"
+#include "fls/table/global_dictionary.hpp"
 #include "fls/table/rowgroup.hpp"
+#include "fls/table/shared_symbol_table.hpp"
 #include <cstddef> // size_t
 #include <cstdint> // uint32_t, uint64_t
 
@@ -72,6 +78,17 @@ void make_enc_validitymask_expr(PhysicalExpr&      physical_expr,
 	    make_shared<enc_validitymask_opr>(physical_expr, column, column_descriptor, state));
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_enc_boolean_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+void make_enc_boolean_expr(PhysicalExpr&      physical_expr,
+                           const rowgroup_pt& rowgroup,
+                           ColumnDescriptorT& column_descriptor,
+                           InterpreterState&  state) {
+	const auto& column = rowgroup[column_descriptor.idx];
+	physical_expr.operators.emplace_back(make_shared<enc_boolean_opr>(physical_expr, column, column_descriptor, state));
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_enc_struct_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -132,6 +149,31 @@ void make_fsst_delta_expr(PhysicalExpr&      physical_expr,
 	operators.emplace_back(make_shared<enc_ffor_opr<ofs_t>>(physical_expr, column, column_descriptor, state));
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_enc_shared_fsst_delta_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename FSSTOperator>
+void make_enc_shared_fsst_delta_expr(PhysicalExpr&      physical_expr,
+                                     const rowgroup_pt& rowgroup,
+                                     ColumnDescriptorT& column_descriptor,
+                                     InterpreterState&  state) {
+
+	const auto& column       = rowgroup[column_descriptor.idx];
+	const auto& symbol_table = SharedSymbolTable::Of(column);
+	auto&       operators    = physical_expr.operators;
+
+	operators.emplace_back(make_shared<FSSTOperator>(physical_expr, column, column_descriptor, state, symbol_table));
+	operators.emplace_back(make_shared<enc_transpose_opr<ofs_t>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(make_shared<enc_rsum_opr<ofs_t>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(make_shared<enc_analyze_opr<ofs_t>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(make_shared<enc_ffor_opr<ofs_t>>(physical_expr, column, column_descriptor, state));
+
+	// where the symbol table is in the file goes last, so the segments keep the operands of EXP_FSST_DELTA.
+	auto& operand_tokens = column_descriptor.encoding_rpn->operand_tokens;
+	operand_tokens.emplace_back(symbol_table.offset);
+	operand_tokens.emplace_back(symbol_table.Size());
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_enc_fsst_delta_slpatch_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -260,6 +302,26 @@ void make_enc_dict_ffor_expr(PhysicalExpr&      physical_expr,
 	operators.emplace_back(make_shared<enc_ffor_opr<INDEX_PT>>(physical_expr, column, column_descriptor, state));
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_enc_global_dict_ffor_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename INDEX_PT>
+void make_enc_global_dict_ffor_expr(PhysicalExpr&      physical_expr,
+                                    const rowgroup_pt& rowgroup,
+                                    ColumnDescriptorT& column_descriptor,
+                                    InterpreterState&  state) {
+	auto&       operators         = physical_expr.operators;
+	const auto& column            = rowgroup[column_descriptor.idx];
+	const auto& global_dictionary = GlobalDictionary::Of(column);
+
+	operators.emplace_back(
+	    make_shared<enc_dict_opr<fls_string_t>>(physical_expr, column, column_descriptor, state, global_dictionary));
+	operators.emplace_back(make_shared<enc_dict_map_opr<fls_string_t, INDEX_PT>>(
+	    physical_expr, column, column_descriptor, state, global_dictionary));
+	operators.emplace_back(make_shared<enc_analyze_opr<INDEX_PT>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(make_shared<enc_ffor_opr<INDEX_PT>>(physical_expr, column, column_descriptor, state));
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_enc_dict_ffor_slpatch_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -434,6 +496,26 @@ void make_enc_delta_expr(PhysicalExpr&      physical_expr,
 	operators.emplace_back(
 	    make_shared<enc_ffor_opr<make_unsigned_t<PT>>>(physical_expr, column, column_descriptor, state));
 }
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_delta2_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename PT>
+void make_enc_delta2_expr(PhysicalExpr&      physical_expr,
+                          const rowgroup_pt& rowgroup,
+                          ColumnDescriptorT& column_descriptor,
+                          InterpreterState&  state) {
+	auto&       operators = physical_expr.operators;
+	const auto& column    = rowgroup[column_descriptor.idx];
+
+	operators.emplace_back(make_shared<enc_scan_opr<PT>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(make_shared<enc_transpose_opr<PT>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(make_shared<enc_rsum_opr<PT>>(physical_expr, column, column_descriptor, state, true));
+	operators.emplace_back(make_shared<enc_analyze_opr<PT>>(physical_expr, column, column_descriptor, state));
+	operators.emplace_back(
+	    make_shared<enc_ffor_opr<make_unsigned_t<PT>>>(physical_expr, column, column_descriptor, state));
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_alp_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -527,6 +609,9 @@ sp<PhysicalExpr> Interpreter::Encoding::Interpret(ColumnDescriptorT& column_desc
 		case EXP_CONSTANT_I08:
 		case EXP_CONSTANT_STR:
 		case EXP_CONSTANT_U08:
+		case EXP_CONSTANT_U16:
+		case EXP_CONSTANT_U32:
+		case EXP_CONSTANT_U64:
 		case EXP_CONSTANT_FLT:
 		case EXP_CONSTANT_BOOL:
 		case EXP_EQUAL: {
@@ -753,6 +838,18 @@ sp<PhysicalExpr> Interpreter::Encoding::Interpret(ColumnDescriptorT& column_desc
 			make_enc_delta_expr<u08_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
 			break;
 		}
+		case EXP_DELTA2_I64: {
+			make_enc_delta2_expr<i64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DELTA2_I32: {
+			make_enc_delta2_expr<i32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DELTA2_I16: {
+			make_enc_delta2_expr<i16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
 		case EXP_FFOR_SLPATCH_I64: {
 			make_enc_ffor_slpatch_expr<i64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
 			break;
@@ -1044,6 +1141,140 @@ sp<PhysicalExpr> Interpreter::Encoding::Interpret(ColumnDescriptorT& column_desc
 			make_enc_validitymask_expr(*physical_expr, physical_rowgroup, column_descriptor, state);
 			break;
 		}
+		case EXP_BOOLEAN: {
+			make_enc_boolean_expr(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_UNCOMPRESSED_U16: {
+			make_enc_uncompressed_expr<u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_FFOR_U16: {
+			make_enc_ffor_expr<u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_FFOR_SLPATCH_U16: {
+			make_enc_ffor_slpatch_expr<u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DELTA_U16: {
+			make_enc_delta_expr<u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_RLE_U16_U16: {
+			make_enc_rle_expr<u16_pt, u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_UNCOMPRESSED_U32: {
+			make_enc_uncompressed_expr<u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_FFOR_U32: {
+			make_enc_ffor_expr<u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_FFOR_SLPATCH_U32: {
+			make_enc_ffor_slpatch_expr<u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DELTA_U32: {
+			make_enc_delta_expr<u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_RLE_U32_U16: {
+			make_enc_rle_expr<u32_pt, u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_UNCOMPRESSED_U64: {
+			make_enc_uncompressed_expr<u64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_FFOR_U64: {
+			make_enc_ffor_expr<u64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_FFOR_SLPATCH_U64: {
+			make_enc_ffor_slpatch_expr<u64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DELTA_U64: {
+			make_enc_delta_expr<u64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_RLE_U64_U16: {
+			make_enc_rle_expr<u64_pt, u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U16_FFOR_U16: {
+			make_enc_dict_ffor_expr<u16_pt, u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U16_FFOR_U08: {
+			make_enc_dict_ffor_expr<u16_pt, u08_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U32_FFOR_U32: {
+			make_enc_dict_ffor_expr<u32_pt, u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U32_FFOR_U16: {
+			make_enc_dict_ffor_expr<u32_pt, u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U32_FFOR_U08: {
+			make_enc_dict_ffor_expr<u32_pt, u08_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U64_FFOR_U32: {
+			make_enc_dict_ffor_expr<u64_pt, u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U64_FFOR_U16: {
+			make_enc_dict_ffor_expr<u64_pt, u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U64_FFOR_U08: {
+			make_enc_dict_ffor_expr<u64_pt, u08_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U16_U16:
+		case EXP_DICT_U16_U08: {
+			make_enc_dict_expr<u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U32_U32:
+		case EXP_DICT_U32_U16:
+		case EXP_DICT_U32_U08: {
+			make_enc_dict_expr<u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_DICT_U64_U32:
+		case EXP_DICT_U64_U16:
+		case EXP_DICT_U64_U08: {
+			make_enc_dict_expr<u64_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_GLOBAL_DICT_STR_FFOR_U32: {
+			make_enc_global_dict_ffor_expr<u32_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_GLOBAL_DICT_STR_FFOR_U16: {
+			make_enc_global_dict_ffor_expr<u16_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_GLOBAL_DICT_STR_FFOR_U08: {
+			make_enc_global_dict_ffor_expr<u08_pt>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_SHARED_FSST_DELTA: {
+			make_enc_shared_fsst_delta_expr<enc_fsst_opr>(*physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
+		case EXP_SHARED_FSST12_DELTA: {
+			make_enc_shared_fsst_delta_expr<enc_fsst12_opr>(
+			    *physical_expr, physical_rowgroup, column_descriptor, state);
+			break;
+		}
 		case INVALID:
 		default:
 			throw_not_supported_exception(operator_token);
@@ -1092,6 +1323,24 @@ void make_dec_validitymask_expr(PhysicalExpr&     physical_expr,
 	physical_expr.operators.emplace_back(std::make_shared<dec_validitymask_opr>(column_view, last));
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_dec_boolean_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+void make_dec_boolean_expr(PhysicalExpr&     physical_expr,
+                           const ColumnView& column_view,
+                           const InterpreterState& /*state*/) {
+	const auto* rpn = column_view.column_descriptor.encoding_rpn();
+	FLS_ASSERT_NOT_NULL_POINTER(rpn);
+
+	const auto* operands = rpn->operand_tokens();
+	FLS_ASSERT_NOT_NULL_POINTER(operands);
+
+	FLS_ASSERT_E(operands->size(), 1);
+
+	const uint64_t last = operands->Get(operands->size() - 1);
+	physical_expr.operators.emplace_back(std::make_shared<dec_boolean_opr>(column_view, last));
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_dec_fls_str_uncompressed_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -1129,6 +1378,29 @@ void make_dec_fsst_delta_expr(PhysicalExpr& physical_expr, const ColumnView& col
 	state.cur_operator = state.cur_operator + 3;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_dec_shared_fsst_delta_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename FSSTDecoder, typename DECODER_T>
+void make_dec_shared_fsst_delta_expr(RowgroupReader&   reader,
+                                     PhysicalExpr&     physical_expr,
+                                     const ColumnView& column_view,
+                                     InterpreterState& state) {
+	const auto* operand_tokens = column_view.column_descriptor.encoding_rpn()->operand_tokens();
+	FLS_ASSERT_NOT_NULL_POINTER(operand_tokens)
+	const n_t n_operands = operand_tokens->size();
+
+	// the last two operands are where the symbol table is in the file, the others are segments of the rowgroup.
+	auto& symbol_table = reader.get_symbol_table<DECODER_T>(operand_tokens->Get(n_operands - 2),
+	                                                        operand_tokens->Get(n_operands - 1));
+
+	state.cur_operand = n_operands - 3;
+	physical_expr.operators.emplace_back(make_shared<dec_unffor_opr<ofs_t>>(column_view, state));
+	physical_expr.operators.emplace_back(make_shared<dec_rsum_opr<ofs_t>>(physical_expr, column_view, state));
+	physical_expr.operators.emplace_back(make_shared<FSSTDecoder>(physical_expr, column_view, symbol_table, state));
+	state.cur_operator = state.cur_operator + 3;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_dec_fsst_delta_slpatch_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -1199,6 +1471,26 @@ void make_dec_dict_ffor_expr(PhysicalExpr& physical_expr, const ColumnView& colu
 	    make_shared<dec_dict_opr<KEY_PT, INDEX_PT>>(physical_expr, column_view, state));
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_dec_global_dict_ffor_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename INDEX_PT>
+void make_dec_global_dict_ffor_expr(RowgroupReader&   reader,
+                                    PhysicalExpr&     physical_expr,
+                                    const ColumnView& column_view,
+                                    InterpreterState& state) {
+	const auto* operand_tokens = column_view.column_descriptor.encoding_rpn()->operand_tokens();
+	FLS_ASSERT_NOT_NULL_POINTER(operand_tokens)
+
+	// the first two operands are where the dictionary is in the file, the others are segments of the rowgroup.
+	auto& global_dictionary = reader.get_global_dictionary(operand_tokens->Get(0), operand_tokens->Get(1));
+
+	state.cur_operand = operand_tokens->size() - 1;
+	physical_expr.operators.emplace_back(make_shared<dec_unffor_opr<INDEX_PT>>(column_view, state));
+	physical_expr.operators.emplace_back(
+	    make_shared<dec_dict_opr<fls_string_t, INDEX_PT>>(physical_expr, global_dictionary, state));
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_dec_null_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -1355,6 +1647,22 @@ void make_dec_delta_expr(RowgroupReader&   reader,
 	physical_expr.operators.emplace_back(make_shared<dec_transpose_opr<PT>>(physical_expr, column_view, state));
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * make_dec_delta2_expr
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename PT>
+void make_dec_delta2_expr(RowgroupReader&   reader,
+                          PhysicalExpr&     physical_expr,
+                          const ColumnView& column_view,
+                          InterpreterState& state) {
+	state.cur_operand  = column_view.column_descriptor.encoding_rpn()->operand_tokens()->size() - 1;
+	state.cur_operator = 0;
+
+	physical_expr.operators.emplace_back(make_shared<dec_unffor_opr<make_unsigned_t<PT>>>(column_view, state));
+	physical_expr.operators.emplace_back(make_shared<dec_rsum_opr<PT>>(physical_expr, column_view, state, true));
+	physical_expr.operators.emplace_back(make_shared<dec_transpose_opr<PT>>(physical_expr, column_view, state));
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * make_dec_fls_str_uncompressed_expr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -1767,6 +2075,18 @@ void Interpreter::Decoding::Interpret(const ColumnDescriptor& column_descriptor,
 			make_dec_delta_expr<u08_pt>(reader, physical_expr, column_view, state);
 			break;
 		}
+		case EXP_DELTA2_I64: {
+			make_dec_delta2_expr<i64_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DELTA2_I32: {
+			make_dec_delta2_expr<i32_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DELTA2_I16: {
+			make_dec_delta2_expr<i16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
 		case EXP_FFOR_SLPATCH_I64: {
 			make_dec_ffor_slpatch_expr<i64_pt>(physical_expr, column_view, state);
 			break;
@@ -2034,6 +2354,167 @@ void Interpreter::Decoding::Interpret(const ColumnDescriptor& column_descriptor,
 			make_dec_validitymask_expr(physical_expr, column_view, state);
 			break;
 		}
+		case EXP_BOOLEAN: {
+			make_dec_boolean_expr(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_UNCOMPRESSED_U16: {
+			make_dec_uncompressed_expr<u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_CONSTANT_U16: {
+			make_dec_constant_expr<u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_FFOR_U16: {
+			make_dec_ffor_expr<u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_FFOR_SLPATCH_U16: {
+			make_dec_ffor_slpatch_expr<u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DELTA_U16: {
+			make_dec_delta_expr<u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_RLE_U16_U16: {
+			make_dec_rle_expr<u16_pt, u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_UNCOMPRESSED_U32: {
+			make_dec_uncompressed_expr<u32_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_CONSTANT_U32: {
+			make_dec_constant_expr<u32_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_FFOR_U32: {
+			make_dec_ffor_expr<u32_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_FFOR_SLPATCH_U32: {
+			make_dec_ffor_slpatch_expr<u32_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DELTA_U32: {
+			make_dec_delta_expr<u32_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_RLE_U32_U16: {
+			make_dec_rle_expr<u32_pt, u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_UNCOMPRESSED_U64: {
+			make_dec_uncompressed_expr<u64_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_CONSTANT_U64: {
+			make_dec_constant_expr<u64_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_FFOR_U64: {
+			make_dec_ffor_expr<u64_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_FFOR_SLPATCH_U64: {
+			make_dec_ffor_slpatch_expr<u64_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DELTA_U64: {
+			make_dec_delta_expr<u64_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_RLE_U64_U16: {
+			make_dec_rle_expr<u64_pt, u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U16_FFOR_U16: {
+			make_dec_dict_ffor_expr<u16_pt, u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U16_FFOR_U08: {
+			make_dec_dict_ffor_expr<u16_pt, u08_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U32_FFOR_U32: {
+			make_dec_dict_ffor_expr<u32_pt, u32_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U32_FFOR_U16: {
+			make_dec_dict_ffor_expr<u32_pt, u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U32_FFOR_U08: {
+			make_dec_dict_ffor_expr<u32_pt, u08_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U64_FFOR_U32: {
+			make_dec_dict_ffor_expr<u64_pt, u32_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U64_FFOR_U16: {
+			make_dec_dict_ffor_expr<u64_pt, u16_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U64_FFOR_U08: {
+			make_dec_dict_ffor_expr<u64_pt, u08_pt>(physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U16_U16: {
+			make_dec_dict_expr<u16_pt, u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U16_U08: {
+			make_dec_dict_expr<u16_pt, u08_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U32_U32: {
+			make_dec_dict_expr<u32_pt, u32_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U32_U16: {
+			make_dec_dict_expr<u32_pt, u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U32_U08: {
+			make_dec_dict_expr<u32_pt, u08_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U64_U32: {
+			make_dec_dict_expr<u64_pt, u32_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U64_U16: {
+			make_dec_dict_expr<u64_pt, u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_DICT_U64_U08: {
+			make_dec_dict_expr<u64_pt, u08_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_GLOBAL_DICT_STR_FFOR_U32: {
+			make_dec_global_dict_ffor_expr<u32_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_GLOBAL_DICT_STR_FFOR_U16: {
+			make_dec_global_dict_ffor_expr<u16_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_GLOBAL_DICT_STR_FFOR_U08: {
+			make_dec_global_dict_ffor_expr<u08_pt>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_SHARED_FSST_DELTA: {
+			make_dec_shared_fsst_delta_expr<dec_fsst_opr, fsst_decoder_t>(reader, physical_expr, column_view, state);
+			break;
+		}
+		case EXP_SHARED_FSST12_DELTA: {
+			make_dec_shared_fsst_delta_expr<dec_fsst12_opr, fsst12_decoder_t>(
+			    reader, physical_expr, column_view, state);
+			break;
+		}
 		case INVALID:
 		default:
 			FLS_UNREACHABLE();
@@ -10,6 +10,7 @@
 #include "fls/cor/lyt/buf.hpp"
 #include "fls/expression/alp_expression.hpp"
 #include "fls/expression/analyze_operator.hpp"
+#include "fls/expression/boolean_operator.hpp"
 #include "fls/expression/cross_rle_operator.hpp"
 #include "fls/expression/data_parallelize_patch_operator.hpp"
 #include "fls/expression/decoding_operator.hpp"
@@ -224,6 +225,12 @@ struct point_to_visitor {
 	void operator()(const sp<dec_validitymask_opr>& opr) {
 		opr->PointTo(vec_idx);
 	}
+	void operator()(const sp<enc_boolean_opr>& opr) {
+		opr->PointTo(vec_idx);
+	}
+	void operator()(const sp<dec_boolean_opr>& opr) {
+		opr->PointTo(vec_idx);
+	}
 	//
 	template <typename PT>
 	void operator()(const sp<enc_cross_rle_opr<PT>>& opr) {
@@ -377,6 +384,9 @@ struct flush_segments_visitor {
 	void operator()(const sp<enc_validitymask_opr>& opr) {
 		opr->MoveSegments(segments);
 	}
+	void operator()(const sp<enc_boolean_opr>& opr) {
+		opr->MoveSegments(segments);
+	}
 	//
 	template <typename PT>
 	void operator()(const sp<enc_data_parallel_patch_opr<PT>>& opr) {
@@ -533,6 +543,9 @@ struct extract_segments_visitor {
 	void operator()(const sp<enc_validitymask_opr>& opr) {
 		opr->MoveSegments(segments);
 	}
+	void operator()(const sp<enc_boolean_opr>& opr) {
+		opr->MoveSegments(segments);
+	}
 	//
 	template <typename PT>
 	void operator()(const sp<enc_data_parallel_patch_opr<PT>>& opr) {
@@ -674,6 +687,8 @@ struct finalize_operators_visitor {
 	//
 	void operator()(const sp<enc_validitymask_opr>& opr) {
 	}
+	void operator()(const sp<enc_boolean_opr>& opr) {
+	}
 	//
 	template <typename PT>
 	void operator()(const sp<enc_data_parallel_patch_opr<PT>>& opr) {
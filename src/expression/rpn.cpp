@@ -333,6 +333,92 @@ string token_to_string(OperatorToken token) {
 		return "EXP_GALP_FLT"; // 155
 	case OperatorToken::EXP_GALP_DBL:
 		return "EXP_GALP_DBL"; // 156
+	case OperatorToken::EXP_DELTA2_I64:
+		return "EXP_DELTA2_I64"; // 157
+	case OperatorToken::EXP_DELTA2_I32:
+		return "EXP_DELTA2_I32"; // 158
+	case OperatorToken::EXP_DELTA2_I16:
+		return "EXP_DELTA2_I16"; // 159
+	case OperatorToken::EXP_BOOLEAN:
+		return "EXP_BOOLEAN"; // 160
+	case OperatorToken::EXP_UNCOMPRESSED_U16:
+		return "EXP_UNCOMPRESSED_U16"; // 161
+	case OperatorToken::EXP_CONSTANT_U16:
+		return "EXP_CONSTANT_U16"; // 162
+	case OperatorToken::EXP_FFOR_U16:
+		return "EXP_FFOR_U16"; // 163
+	case OperatorToken::EXP_FFOR_SLPATCH_U16:
+		return "EXP_FFOR_SLPATCH_U16"; // 164
+	case OperatorToken::EXP_DELTA_U16:
+		return "EXP_DELTA_U16"; // 165
+	case OperatorToken::EXP_RLE_U16_U16:
+		return "EXP_RLE_U16_U16"; // 166
+	case OperatorToken::EXP_UNCOMPRESSED_U32:
+		return "EXP_UNCOMPRESSED_U32"; // 167
+	case OperatorToken::EXP_CONSTANT_U32:
+		return "EXP_CONSTANT_U32"; // 168
+	case OperatorToken::EXP_FFOR_U32:
+		return "EXP_FFOR_U32"; // 169
+	case OperatorToken::EXP_FFOR_SLPATCH_U32:
+		return "EXP_FFOR_SLPATCH_U32"; // 170
+	case OperatorToken::EXP_DELTA_U32:
+		return "EXP_DELTA_U32"; // 171
+	case OperatorToken::EXP_RLE_U32_U16:
+		return "EXP_RLE_U32_U16"; // 172
+	case OperatorToken::EXP_UNCOMPRESSED_U64:
+		return "EXP_UNCOMPRESSED_U64"; // 173
+	case OperatorToken::EXP_CONSTANT_U64:
+		return "EXP_CONSTANT_U64"; // 174
+	case OperatorToken::EXP_FFOR_U64:
+		return "EXP_FFOR_U64"; // 175
+	case OperatorToken::EXP_FFOR_SLPATCH_U64:
+		return "EXP_FFOR_SLPATCH_U64"; // 176
+	case OperatorToken::EXP_DELTA_U64:
+		return "EXP_DELTA_U64"; // 177
+	case OperatorToken::EXP_RLE_U64_U16:
+		return "EXP_RLE_U64_U16"; // 178
+	case OperatorToken::EXP_DICT_U16_FFOR_U16:
+		return "EXP_DICT_U16_FFOR_U16"; // 179
+	case OperatorToken::EXP_DICT_U16_FFOR_U08:
+		return "EXP_DICT_U16_FFOR_U08"; // 180
+	case OperatorToken::EXP_DICT_U32_FFOR_U32:
+		return "EXP_DICT_U32_FFOR_U32"; // 181
+	case OperatorToken::EXP_DICT_U32_FFOR_U16:
+		return "EXP_DICT_U32_FFOR_U16"; // 182
+	case OperatorToken::EXP_DICT_U32_FFOR_U08:
+		return "EXP_DICT_U32_FFOR_U08"; // 183
+	case OperatorToken::EXP_DICT_U64_FFOR_U32:
+		return "EXP_DICT_U64_FFOR_U32"; // 184
+	case OperatorToken::EXP_DICT_U64_FFOR_U16:
+		return "EXP_DICT_U64_FFOR_U16"; // 185
+	case OperatorToken::EXP_DICT_U64_FFOR_U08:
+		return "EXP_DICT_U64_FFOR_U08"; // 186
+	case OperatorToken::EXP_DICT_U16_U16:
+		return "EXP_DICT_U16_U16"; // 187
+	case OperatorToken::EXP_DICT_U16_U08:
+		return "EXP_DICT_U16_U08"; // 188
+	case OperatorToken::EXP_DICT_U32_U32:
+		return "EXP_DICT_U32_U32"; // 189
+	case OperatorToken::EXP_DICT_U32_U16:
+		return "EXP_DICT_U32_U16"; // 190
+	case OperatorToken::EXP_DICT_U32_U08:
+		return "EXP_DICT_U32_U08"; // 191
+	case OperatorToken::EXP_DICT_U64_U32:
+		return "EXP_DICT_U64_U32"; // 192
+	case OperatorToken::EXP_DICT_U64_U16:
+		return "EXP_DICT_U64_U16"; // 193
+	case OperatorToken::EXP_DICT_U64_U08:
+		return "EXP_DICT_U64_U08"; // 194
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U32:
+		return "EXP_GLOBAL_DICT_STR_FFOR_U32"; // 195
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U16:
+		return "EXP_GLOBAL_DICT_STR_FFOR_U16"; // 196
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U08:
+		return "EXP_GLOBAL_DICT_STR_FFOR_U08"; // 197
+	case OperatorToken::EXP_SHARED_FSST_DELTA:
+		return "EXP_SHARED_FSST_DELTA"; // 198
+	case OperatorToken::EXP_SHARED_FSST12_DELTA:
+		return "EXP_SHARED_FSST12_DELTA"; // 199
 	default:
 		FLS_UNREACHABLE()
 	}
@@ -376,7 +462,11 @@ bool is_1_to_1(const OperatorToken token) {
 	    OperatorToken::EXP_DICT_STR_U08,        OperatorToken::EXP_FSST_DICT_STR_U32,
 	    OperatorToken::EXP_FSST_DICT_STR_U16,   OperatorToken::EXP_FSST_DICT_STR_U08,
 	    OperatorToken::EXP_FSST12_DICT_STR_U32, OperatorToken::EXP_FSST12_DICT_STR_U16,
-	    OperatorToken::EXP_FSST12_DICT_STR_U08,
+	    OperatorToken::EXP_FSST12_DICT_STR_U08, OperatorToken::EXP_DICT_U08_U08,
+	    OperatorToken::EXP_DICT_U16_U16,        OperatorToken::EXP_DICT_U16_U08,
+	    OperatorToken::EXP_DICT_U32_U32,        OperatorToken::EXP_DICT_U32_U16,
+	    OperatorToken::EXP_DICT_U32_U08,        OperatorToken::EXP_DICT_U64_U32,
+	    OperatorToken::EXP_DICT_U64_U16,        OperatorToken::EXP_DICT_U64_U08,
 	};
 
 	return one_to_one_set.find(token) != one_to_one_set.end();
@@ -21,10 +21,76 @@
 #include "fls/table/rowgroup.hpp"
 #include "fls_gen/rsum/rsum.hpp"
 #include "fls_gen/unrsum/unrsum.hpp"
+#include <cstring> // std::memcpy
 #include <utility>
 #include <variant>
 
 namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * delta of delta
+\*--------------------------------------------------------------------------------------------------------------------*/
+// the unified transposed layout splits a vector into 128 bytes worth of lanes. the k-th value of a lane lies in row
+// k % 8 of block k / 8, and the blocks follow the FastLanes order; the generated rsum and unrsum walk the same chain.
+static constexpr n_t FLS_ORDER[] = {0, 4, 2, 6, 1, 5, 3, 7};
+
+static constexpr n_t ChainOffset(const n_t value_idx) {
+	return (value_idx % 8) * 128 + FLS_ORDER[value_idx / 8] * 16;
+}
+
+// out gets the differences of the deltas of every lane, the first one taken against the first delta of lane 0, which
+// is returned; the first value of every lane is left to the bases. the arithmetic wraps, as in unrsum.
+template <typename PT>
+static PT UnrsumUnrsum(const PT* __restrict in, PT* __restrict out) {
+	using UPT                  = make_unsigned_t<PT>;
+	constexpr n_t N_LANES      = CFG::UNIFIED_TRANSPOSED::BASES_SIZE / sizeof(PT);
+	constexpr n_t CHAIN_SIZE   = CFG::VEC_SZ / N_LANES;
+	const auto*   unsigned_in  = reinterpret_cast<const UPT*>(in);
+	auto*         unsigned_out = reinterpret_cast<UPT*>(out);
+
+	const UPT first_delta = unsigned_in[ChainOffset(1)] - unsigned_in[0];
+	UPT       previous_deltas[N_LANES];
+	for (n_t lane {0}; lane < N_LANES; ++lane) {
+		unsigned_out[lane]    = 0;
+		previous_deltas[lane] = first_delta;
+	}
+	for (n_t value_idx {1}; value_idx < CHAIN_SIZE; ++value_idx) {
+		const n_t offset          = ChainOffset(value_idx);
+		const n_t previous_offset = ChainOffset(value_idx - 1);
+		for (n_t lane {0}; lane < N_LANES; ++lane) {
+			const UPT delta             = unsigned_in[offset + lane] - unsigned_in[previous_offset + lane];
+			unsigned_out[offset + lane] = delta - previous_deltas[lane];
+			previous_deltas[lane]       = delta;
+		}
+	}
+	return static_cast<PT>(first_delta);
+}
+
+// the inverse of UnrsumUnrsum: both prefix sums in one pass over the lanes, the deltas kept in registers.
+template <typename PT>
+static void RsumRsum(const PT* __restrict in, PT* __restrict out, const PT* __restrict bases, const PT first_delta) {
+	using UPT                  = make_unsigned_t<PT>;
+	constexpr n_t N_LANES      = CFG::UNIFIED_TRANSPOSED::BASES_SIZE / sizeof(PT);
+	constexpr n_t CHAIN_SIZE   = CFG::VEC_SZ / N_LANES;
+	const auto*   unsigned_in  = reinterpret_cast<const UPT*>(in);
+	auto*         unsigned_out = reinterpret_cast<UPT*>(out);
+
+	UPT values[N_LANES];
+	UPT deltas[N_LANES];
+	for (n_t lane {0}; lane < N_LANES; ++lane) {
+		values[lane]       = static_cast<UPT>(bases[lane]);
+		deltas[lane]       = static_cast<UPT>(first_delta);
+		unsigned_out[lane] = values[lane];
+	}
+	for (n_t value_idx {1}; value_idx < CHAIN_SIZE; ++value_idx) {
+		const n_t offset = ChainOffset(value_idx);
+		for (n_t lane {0}; lane < N_LANES; ++lane) {
+			deltas[lane] += unsigned_in[offset + lane];
+			values[lane] += deltas[lane];
+			unsigned_out[offset + lane] = values[lane];
+		}
+	}
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * enc rsum opr
 \*--------------------------------------------------------------------------------------------------------------------*/
@@ -32,7 +98,9 @@ template <typename PT>
 enc_rsum_opr<PT>::enc_rsum_opr(const PhysicalExpr& expr,
                                const col_pt&       col,
                                ColumnDescriptorT&  column_descriptor,
-                               InterpreterState&   state) {
+                               InterpreterState&   state,
+                               const bool          a_is_delta_of_delta)
+    : is_delta_of_delta(a_is_delta_of_delta) {
 
 	visit(overloaded {
 	          [&](const sp<enc_scan_opr<PT>>& opr) { data = opr->data; },
@@ -50,9 +118,19 @@ enc_rsum_opr<PT>::enc_rsum_opr(const PhysicalExpr& expr,
 
 template <typename PT>
 void enc_rsum_opr<PT>::Rsum() {
-	::generated::unrsum::fallback::scalar::unrsum(data, deltas);
+	if (!is_delta_of_delta) {
+		::generated::unrsum::fallback::scalar::unrsum(data, deltas);
 
-	bases_segment->Flush(data, CFG::UNIFIED_TRANSPOSED::BASES_SIZE);
+		bases_segment->Flush(data, CFG::UNIFIED_TRANSPOSED::BASES_SIZE);
+		return;
+	}
+
+	// the bases of the lanes, then the first delta of lane 0.
+	constexpr n_t N_LANES = CFG::UNIFIED_TRANSPOSED::BASES_SIZE / sizeof(PT);
+	std::memcpy(rsumed_bases, data, CFG::UNIFIED_TRANSPOSED::BASES_SIZE);
+	rsumed_bases[N_LANES] = UnrsumUnrsum(data, deltas);
+
+	bases_segment->Flush(rsumed_bases, CFG::UNIFIED_TRANSPOSED::BASES_SIZE + sizeof(PT));
 };
 
 template <typename PT>
@@ -98,9 +176,13 @@ struct RsumExprVisitor {
 };
 
 template <typename PT>
-dec_rsum_opr<PT>::dec_rsum_opr(PhysicalExpr& physical_expr, const ColumnView& column_view, InterpreterState& state)
+dec_rsum_opr<PT>::dec_rsum_opr(PhysicalExpr&     physical_expr,
+                               const ColumnView& column_view,
+                               InterpreterState& state,
+                               const bool        a_is_delta_of_delta)
     : bases_segment_view(column_view.GetSegment(state.cur_operand))
-    , deltas(nullptr) {
+    , deltas(nullptr)
+    , is_delta_of_delta(a_is_delta_of_delta) {
 
 	visit(RsumExprVisitor<PT> {deltas}, physical_expr.operators.back());
 	state.cur_operand = state.cur_operand - 1;
@@ -115,6 +197,11 @@ void dec_rsum_opr<PT>::Unrsum(n_t vec_idx) {
 	PointTo(vec_idx);
 
 	auto* bases = reinterpret_cast<PT*>(bases_segment_view.data);
+	if (is_delta_of_delta) {
+		constexpr n_t N_LANES = CFG::UNIFIED_TRANSPOSED::BASES_SIZE / sizeof(PT);
+		RsumRsum(deltas, idxs, bases, bases[N_LANES]);
+		return;
+	}
 	::generated::rsum::fallback::scalar::rsum(deltas, idxs, bases);
 }
 
@@ -5,6 +5,7 @@
 // ────────────────────────────────────────────────────────
 #include "fls/expression/selection_ds.hpp"
 #include "fls/common/alias.hpp"
+#include <bit>
 
 namespace fastlanes {
 
@@ -33,4 +34,24 @@ void SelectionDS::Reset() {
 	n_selected_values = 0;
 }
 
+void SelectionDS::ToIndices() {
+	if (!use_bitmap) {
+		return;
+	}
+
+	n_selected_values = 0;
+	for (n_t unit_idx {0}; unit_idx < bitmap.size(); ++unit_idx) {
+		for (bitmap_unit_t unit = bitmap[unit_idx]; unit != 0; unit &= unit - 1) {
+			const auto bit_idx           = static_cast<n_t>(std::countr_zero(unit));
+			idx_arr[n_selected_values++] = static_cast<vec_idx_t>(unit_idx * 64 + bit_idx);
+		}
+	}
+	use_bitmap = false;
+}
+
+span<const vec_idx_t> SelectionDS::Indices() const {
+	FLS_ASSERT_FALSE(use_bitmap)
+	return {idx_arr.data(), n_selected_values};
+}
+
 } // namespace fastlanes
@@ -0,0 +1,132 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/filter/bloom_filter.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/filter/bloom_filter.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/common/common.hpp"
+#include "fls/std/variant.hpp"
+#include "fls/table/rowgroup.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * hashing
+\*--------------------------------------------------------------------------------------------------------------------*/
+// salts from the parquet split-block bloom filter specification.
+constexpr BloomFilter::word_t SALT[BloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+constexpr uint64_t HASH_PRIME = 0x9E3779B97F4A7C15ULL;
+
+inline uint64_t fmix64(uint64_t key) {
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+	return key;
+}
+
+uint64_t BloomFilter::Hash(const uint8_t* data, const n_t size) {
+	uint64_t hash = HASH_PRIME ^ (size * HASH_PRIME);
+
+	n_t byte_idx {0};
+	for (; byte_idx + sizeof(uint64_t) <= size; byte_idx += sizeof(uint64_t)) {
+		uint64_t chunk;
+		std::memcpy(&chunk, data + byte_idx, sizeof(uint64_t));
+		hash = (hash ^ fmix64(chunk)) * HASH_PRIME;
+	}
+
+	// an empty string or a null slot may come with a null pointer, which memcpy must not see even for 0 bytes.
+	uint64_t tail {0};
+	if (byte_idx < size) {
+		std::memcpy(&tail, data + byte_idx, size - byte_idx);
+	}
+	hash = (hash ^ fmix64(tail)) * HASH_PRIME;
+
+	return fmix64(hash);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * BloomFilter
+\*--------------------------------------------------------------------------------------------------------------------*/
+BloomFilter::BloomFilter(const n_t n_distinct_values) {
+	const n_t n_bits   = std::max<n_t>(n_distinct_values, 1) * CFG::BloomFilter::BITS_PER_VALUE;
+	const n_t n_blocks = (n_bits + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+	words.resize(n_blocks * WORDS_PER_BLOCK, 0);
+}
+
+// the upper half of the hash picks the block, the lower half the bit inside every word of it.
+static n_t block_offset(const n_t n_words, const uint64_t hash) {
+	const n_t n_blocks = n_words / BloomFilter::WORDS_PER_BLOCK;
+	return ((hash >> 32) * n_blocks >> 32) * BloomFilter::WORDS_PER_BLOCK;
+}
+
+void BloomFilter::Insert(const uint64_t hash) {
+	const auto offset = block_offset(words.size(), hash);
+	const auto key    = static_cast<word_t>(hash);
+	for (n_t word_idx {0}; word_idx < WORDS_PER_BLOCK; ++word_idx) {
+		words[offset + word_idx] |= word_t {1} << ((key * SALT[word_idx]) >> 27);
+	}
+}
+
+bool BloomFilter::MayContain(span<const word_t> words, const uint64_t hash) {
+	if (words.empty()) {
+		return true;
+	}
+
+	const auto offset = block_offset(words.size(), hash);
+	const auto key    = static_cast<word_t>(hash);
+	for (n_t word_idx {0}; word_idx < WORDS_PER_BLOCK; ++word_idx) {
+		if ((words[offset + word_idx] & (word_t {1} << ((key * SALT[word_idx]) >> 27))) == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Build
+\*--------------------------------------------------------------------------------------------------------------------*/
+static bool is_null(const null_map_arr_t& null_map_arr, const n_t val_idx) {
+	return val_idx < null_map_arr.size() && null_map_arr[val_idx];
+}
+
+vector<BloomFilter::word_t> BloomFilter::Build(const col_pt& column) {
+	return visit(overloaded {
+	                 [](const up<FLSStrColumn>& str_col) {
+		                 BloomFilter bloom_filter {str_col->m_stats.bimap.size()};
+		                 for (n_t val_idx {0}; val_idx < str_col->length_arr.size(); ++val_idx) {
+			                 if (is_null(str_col->null_map_arr, val_idx)) {
+				                 continue;
+			                 }
+			                 bloom_filter.Insert(Hash(str_col->str_p_arr[val_idx], str_col->length_arr[val_idx]));
+		                 }
+		                 return std::move(bloom_filter.words);
+	                 },
+	                 []<typename PT>(const up<TypedCol<PT>>& typed_col) {
+		                 n_t n_distinct_values = typed_col->data.size();
+		                 if constexpr (!std::is_same_v<PT, str_pt>) {
+			                 if (!typed_col->m_stats.bimap_frequency.empty()) {
+				                 n_distinct_values = typed_col->m_stats.bimap_frequency.size();
+			                 }
+		                 }
+
+		                 BloomFilter bloom_filter {n_distinct_values};
+		                 for (n_t val_idx {0}; val_idx < typed_col->data.size(); ++val_idx) {
+			                 if (is_null(typed_col->null_map_arr, val_idx)) {
+				                 continue;
+			                 }
+			                 bloom_filter.Insert(Hash(typed_col->data[val_idx]));
+		                 }
+		                 return std::move(bloom_filter.words);
+	                 },
+	                 [](const auto&) { return vector<word_t> {}; },
+	             },
+	             column);
+}
+
+} // namespace fastlanes
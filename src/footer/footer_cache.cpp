@@ -0,0 +1,184 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/footer/footer_cache.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/footer/footer_cache.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/common/status.hpp"
+#include "fls/file/file_footer.hpp"
+#include "fls/file/file_header.hpp"
+#include "fls/info.hpp"
+#include "fls/io/file.hpp"
+#include "fls/std/vector.hpp"
+#include <algorithm> // std::min
+#include <cstdint>   // uint8_t
+#include <cstring>   // std::memcpy
+#include <fstream>   // std::ifstream
+#include <ios>       // std::ios, std::streamoff, std::streamsize
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <utility> // std::move
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+constexpr static auto const* TABLE_DESCRIPTOR_FILE_NAME {"table_descriptor.fbb"};
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void ThrowInvalid(const path& file_path, const Status::ErrorCode code) {
+	throw std::runtime_error("cannot open " + file_path.string() + ": " + string(Status::message_for(code)));
+}
+
+static void ReadAt(std::ifstream& file, const path& file_path, const n_t offset, uint8_t* out, const n_t n_bytes) {
+	file.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+	file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(n_bytes));
+	if (!file) {
+		throw std::runtime_error("failed to read " + std::to_string(n_bytes) + " bytes at " + std::to_string(offset) +
+		                         " of " + file_path.string());
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * FooterCache
+\*--------------------------------------------------------------------------------------------------------------------*/
+FooterCache::FooterCache(const n_t budget)
+    : m_budget(budget)
+    , m_cached_bytes(0)
+    , m_hits(0)
+    , m_misses(0) {
+}
+
+TableDescriptorHandle FooterCache::Get(const path& file_path) {
+	auto key = File::identity(file_path);
+	{
+		const std::lock_guard lock(m_mutex);
+
+		if (const auto it = m_entries.find(key); it != m_entries.end()) {
+			m_hits++;
+			m_lru.splice(m_lru.begin(), m_lru, it->second);
+			return it->second->handle;
+		}
+		m_misses++;
+	}
+
+	// loaded without the lock, so opening one file does not stall the readers of others.
+	auto handle = Load(file_path);
+
+	const std::lock_guard lock(m_mutex);
+	const n_t             n_bytes = handle.size();
+	if (n_bytes > m_budget || m_entries.contains(key)) {
+		return handle;
+	}
+
+	Evict(m_budget - n_bytes);
+	m_lru.push_front(Entry {key, handle});
+	m_entries.emplace(std::move(key), m_lru.begin());
+	m_cached_bytes += n_bytes;
+
+	return handle;
+}
+
+void FooterCache::Clear() {
+	const std::lock_guard lock(m_mutex);
+
+	Evict(0);
+	m_hits   = 0;
+	m_misses = 0;
+}
+
+n_t FooterCache::CachedBytes() const {
+	const std::lock_guard lock(m_mutex);
+	return m_cached_bytes;
+}
+
+n_t FooterCache::Budget() const {
+	const std::lock_guard lock(m_mutex);
+	return m_budget;
+}
+
+void FooterCache::SetBudget(const n_t budget) {
+	const std::lock_guard lock(m_mutex);
+
+	m_budget = budget;
+	Evict(budget);
+}
+
+n_t FooterCache::Hits() const {
+	const std::lock_guard lock(m_mutex);
+	return m_hits;
+}
+
+n_t FooterCache::Misses() const {
+	const std::lock_guard lock(m_mutex);
+	return m_misses;
+}
+
+FooterCache& FooterCache::Global() {
+	// never destroyed, so readers alive during static destruction still find it.
+	static auto* cache = new FooterCache {CFG::FooterCache::BUDGET};
+	return *cache;
+}
+
+TableDescriptorHandle FooterCache::Load(const path& file_path) {
+	std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+	if (!file) {
+		throw std::runtime_error("failed to open " + file_path.string());
+	}
+
+	const auto file_size = static_cast<n_t>(file.tellg());
+	if (file_size < sizeof(FileHeader) + sizeof(FileFooter)) {
+		ThrowInvalid(file_path, Status::ErrorCode::ERR_1_SMALL_FILE_SIZE);
+	}
+
+	// the footer and an inlined descriptor sit at the end of the file: read the tail speculatively.
+	const n_t       tail_size   = std::min(file_size, CFG::Footer::SPECULATIVE_READ_SIZE);
+	const n_t       tail_offset = file_size - tail_size;
+	vector<uint8_t> tail(tail_size);
+	ReadAt(file, file_path, tail_offset, tail.data(), tail_size);
+
+	FileFooter file_footer {};
+	std::memcpy(&file_footer, tail.data() + tail_size - sizeof(FileFooter), sizeof(FileFooter));
+	if (file_footer.magic_bytes != Info::get_magic_bytes()) {
+		ThrowInvalid(file_path, Status::ErrorCode::ERR_5_INVALID_MAGIC_BYTES);
+	}
+
+	// small files are covered entirely by the tail; larger ones need the header from the front.
+	FileHeader file_header {};
+	if (tail_offset == 0) {
+		std::memcpy(&file_header, tail.data(), sizeof(FileHeader));
+	} else {
+		ReadAt(file, file_path, 0, reinterpret_cast<uint8_t*>(&file_header), sizeof(FileHeader));
+	}
+
+	if (!file_header.settings.inline_footer) {
+		return TableDescriptorHandle::FromFile(file_path.parent_path() / TABLE_DESCRIPTOR_FILE_NAME);
+	}
+
+	const n_t descriptor_offset = file_footer.table_descriptor_offset;
+	const n_t descriptor_size   = file_footer.table_descriptor_size;
+	if (descriptor_offset + descriptor_size > file_size - sizeof(FileFooter)) {
+		ThrowInvalid(file_path, Status::ErrorCode::ERR_8_INVALID_TABLE_DESCRIPTOR);
+	}
+
+	vector<uint8_t> descriptor_bytes(descriptor_size);
+	if (descriptor_offset >= tail_offset) {
+		const auto* begin = tail.data() + (descriptor_offset - tail_offset);
+		std::copy(begin, begin + descriptor_size, descriptor_bytes.begin());
+	} else {
+		ReadAt(file, file_path, descriptor_offset, descriptor_bytes.data(), descriptor_size);
+	}
+
+	return TableDescriptorHandle::FromBytes(std::move(descriptor_bytes));
+}
+
+// called with the mutex held.
+void FooterCache::Evict(const n_t budget) {
+	while (m_cached_bytes > budget) {
+		const auto& entry = m_lru.back();
+		m_cached_bytes -= entry.handle.size();
+		m_entries.erase(entry.key);
+		m_lru.pop_back();
+	}
+}
+
+} // namespace fastlanes
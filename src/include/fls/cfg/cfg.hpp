@@ -8,6 +8,8 @@
 
 #include "fls/common/alias.hpp"         // for hdr_field_t
 #include "fls/expression/data_type.hpp" // for u32_pt, dbl_pt, i32_pt, i64_pt, u64_pt
+#include "fls/table/sort_order.hpp"     // for SortOrder
+#include "fls/wizard/optimize_for.hpp"  // for OptimizeFor
 #include <cstdint>                      // for uint64_t, uint8_t, uint32_t
 
 namespace fastlanes {
@@ -37,11 +39,16 @@ public:
 	struct RowGroup {
 		static constexpr uint64_t N_VECTORS_PER_ROWGROUP = 64;
 		static constexpr uint64_t N_VALUES_PER_ROWGROUP  = 64 * 1024;
+		static constexpr uint64_t BYTE_BUDGET            = 0;    // 0 sizes rowgroups by N_VECTORS_PER_ROWGROUP
+		static constexpr uint64_t MIN_BYTE_BUDGET        = 1024; // a byte per value of a vector
+		static constexpr uint64_t MIN_N_VECTORS          = 1;    // the bounds of a rowgroup sized by its byte budget
+		static constexpr uint64_t MAX_N_VECTORS          = 1024; //
 	};
 
 	// Rowgroup
 	struct Footer {
-		static constexpr fls_bool IS_INLINED = FLS_FALSE;
+		static constexpr fls_bool IS_INLINED            = FLS_FALSE;
+		static constexpr n_t      SPECULATIVE_READ_SIZE = 64 * 1024; // tail bytes read at open, covers small descriptors
 	};
 
 	/* String Config. */
@@ -58,6 +65,10 @@ public:
 		static constexpr uint64_t ADAPTIVE_TRY_C     = 3;           //
 		static constexpr double   ADAPTIVE_THRESHOLD = 00.80;       //
 		static constexpr uint64_t SAMPLE_SIZE        = 7;           //
+		// successive halving: candidates are first tried on this many vectors, then on 2n + 1, ...
+		static constexpr uint64_t HALVING_FIRST_SAMPLE_SIZE = 1;
+		// ... as long as more than this many are left.
+		static constexpr uint64_t HALVING_MIN_CANDIDATES = 2;
 	};
 
 	/* Dictionary Config. */
@@ -131,10 +142,57 @@ public:
 	};
 	struct CCC {
 		static constexpr double MAX_UNIQUENESS_RATIO_FOR_DICTIONARY_ENCODING = 0.25;
+		// runs shorter than that on average leave RLE nothing to collapse.
+		static constexpr double MIN_AVG_RUN_LENGTH_FOR_RLE = 1.5;
 	};
 	struct UNIFIED_TRANSPOSED {
 		static constexpr n_t BASES_SIZE = 128;
 	};
+	struct BloomFilter {
+		static constexpr bool IS_ENABLED     = false; //
+		static constexpr n_t  BITS_PER_VALUE = 10;    // ~1% false positives
+	};
+	struct BufPool {
+		static constexpr n_t  MAX_RETAINED_BYTES = 256ULL * 1024 * 1024; // free blocks kept for reuse, per pool
+		static constexpr bool HUGE_PAGES         = false;                // back large read and encode buffers
+		static constexpr n_t  SEGMENT_CAPACITY   = 64ULL * 1024;         // first block of a segment, grows as it fills
+	};
+	struct RowgroupCache {
+		static constexpr bool IS_ENABLED = false;                 //
+		static constexpr n_t  BUDGET     = 1024ULL * 1024 * 1024; // bytes of raw rowgroups kept by the process
+	};
+	struct FooterCache {
+		static constexpr bool IS_ENABLED = false;                //
+		static constexpr n_t  BUDGET     = 64ULL * 1024 * 1024; // bytes of parsed table descriptors kept by the process
+	};
+	struct Scan {
+		static constexpr n_t N_THREADS = 1; // workers that read rowgroups in parallel, 1 reads them in order
+	};
+	struct CostModel {
+		static constexpr OptimizeFor OPTIMIZE_FOR        = OptimizeFor::SIZE; //
+		static constexpr double      BYTES_PER_CYCLE     = 4.0;               // scan bandwidth, ~12 GB/s at 3 GHz
+		static constexpr double      BALANCED_SIZE_SLACK = 0.10;              // BALANCED picks up to 10% over smallest
+	};
+	struct SchemaCache {
+		static constexpr bool   IS_ENABLED             = false; //
+		static constexpr n_t    VALIDATION_SAMPLE_SIZE = 1;     // vectors a reused encoding is re-validated on
+		static constexpr double MAX_SIZE_DRIFT         = 0.10;  // beyond that, the column is searched again
+	};
+	struct Memory {
+		static constexpr n_t BUDGET = 0; // bytes a connection may hold while reading, 0 is unlimited
+	};
+	struct GlobalDictionary {
+		static constexpr bool IS_ENABLED = false;              //
+		static constexpr n_t  MAX_SIZE   = 1024ULL * 1024 / 2; // bytes; a shared dictionary has to stay in the L2 cache
+	};
+	struct SharedSymbolTable {
+		static constexpr bool   IS_ENABLED      = false;     //
+		static constexpr n_t    N_SAMPLE_VALUES = 16 * 1024; // strings a table is trained on, spread over its rowgroups
+		static constexpr double MAX_DRIFT       = 0.25;      // beyond that compression loss, a table is trained again
+	};
+	struct Sort {
+		static constexpr SortOrder ORDER = SortOrder::LEXICOGRAPHIC; //
+	};
 	struct NULLS {
 		static constexpr double NULLS_THRESHOLD_PERCENTAGE = 0.95;                 //
 		static constexpr int    MAX_HEADER_SIZE            = 8 + 1 + 8 + 2048 + 1; //
@@ -92,6 +92,12 @@ public:
 		return forward_map_.empty();
 	}
 
+	/// Makes room for `n_keys` distinct keys, so filling the map does not rehash
+	void reserve(n_t n_keys) {
+		forward_map_.reserve(n_keys);
+		reverse_map_.reserve(n_keys);
+	}
+
 	fls_string_t get_most_frequent_key() const {
 		if (empty()) {
 			throw std::runtime_error("BiMapFrequency<fls_string_t>::get_most_frequent_key: Map is empty.");
@@ -50,6 +50,8 @@ public:
 	n_t size() const;
 	//
 	bool empty() const;
+	// makes room for `n_values` distinct values, so filling the map does not rehash
+	void reserve(n_t n_values);
 };
 
 } // namespace fastlanes
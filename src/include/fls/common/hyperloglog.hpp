@@ -0,0 +1,63 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/common/hyperloglog.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_COMMON_HYPERLOGLOG_HPP
+#define FLS_COMMON_HYPERLOGLOG_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/string.hpp"
+#include "fls/std/vector.hpp"
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <type_traits>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * HyperLogLog
+\*--------------------------------------------------------------------------------------------------------------------*/
+// A fixed-size sketch of the number of distinct values of a column. It is updated with one register write per value,
+// so it is kept while values are ingested, and it estimates the cardinality without holding the values themselves.
+class HyperLogLog {
+public:
+	static constexpr n_t PRECISION   = 12;
+	static constexpr n_t N_REGISTERS = n_t {1} << PRECISION;
+
+public:
+	HyperLogLog();
+
+public:
+	///! adds a value by its hash; see Hash.
+	void Add(uint64_t hash);
+	///! the estimated number of distinct values added, with a standard error of about 1.6%.
+	[[nodiscard]] n_t Estimate() const;
+	///! afterwards, this sketch estimates the distinct values added to either of both.
+	void Merge(const HyperLogLog& other);
+	///! true if nothing was added.
+	[[nodiscard]] bool IsEmpty() const;
+
+public:
+	///! the hash of a fixed-size value, by its bit pattern.
+	template <typename PT>
+	static uint64_t Hash(const PT& value) {
+		static_assert(std::is_trivially_copyable_v<PT> && sizeof(PT) <= sizeof(uint64_t));
+		uint64_t bits {0};
+		std::memcpy(&bits, &value, sizeof(PT));
+		return Mix(bits);
+	}
+	///! the hash of a byte string.
+	static uint64_t Hash(const uint8_t* data, n_t size);
+	///
+	static uint64_t Hash(const string& value);
+
+private:
+	static uint64_t Mix(uint64_t bits);
+
+private:
+	vector<uint8_t> m_registers;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_COMMON_HYPERLOGLOG_HPP
@@ -9,6 +9,7 @@
 #include "fls/api/api.hpp"
 #include "fls/common/alias.hpp" // for up, idx_t
 #include "fls/common/status.hpp"
+#include "fls/cor/lyt/memory_tracker.hpp" // for MemoryTracker
 #include "fls/footer/rowgroup_descriptor.hpp" // for Footer
 #include "fls/footer/table_descriptor.hpp"
 #include "fls/reader/column_view.hpp" //
@@ -19,11 +20,16 @@
 #include "fls/std/filesystem.hpp" // for path
 #include "fls/std/vector.hpp"     // for vector
 #include "fls/table/rowgroup.hpp" // for Rowgroup
+#include "fls/table/sort_order.hpp" // for SortOrder
 #include "fls/table/table.hpp"    // for Reader
+#include "fls/wizard/decode_cost.hpp"
+#include "fls/wizard/schema_cache.hpp"
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
 class Dir;
+class FooterCache;
+class RowgroupCache;
 /*--------------------------------------------------------------------------------------------------------------------*/
 /*--------------------------------------------------------------------------------------------------------------------*\
  * Config
@@ -39,10 +45,35 @@ public:
 	vector<OperatorToken> forced_schema;
 	n_t                   sample_size;
 	n_t                   n_vector_per_rowgroup;
+	n_t                   rowgroup_byte_budget;
 	//
 	fls_bool inline_footer;
 	//
 	bool enable_verbose;
+	//
+	bool enable_bloom_filter;
+	//
+	n_t memory_budget;
+	//
+	bool enable_rowgroup_cache;
+	//
+	bool enable_footer_cache;
+	//
+	bool enable_huge_pages;
+	//
+	n_t n_scan_threads;
+	//
+	OptimizeFor optimize_for;
+	//
+	bool enable_schema_cache;
+	//
+	bool enable_global_dictionaries;
+	//
+	bool enable_shared_symbol_tables;
+	//
+	vector<idx_t> sort_key_idxs;
+	//
+	SortOrder sort_order;
 };
 
 /*--------------------------------------------------------------------------------------------------------------------*\
@@ -111,12 +142,103 @@ public:
 	[[nodiscard]] const vector<OperatorToken>& get_forced_schema() const;
 	//
 	Connection& set_n_vectors_per_rowgroup(n_t n_vector_per_rowgroup);
+	// API:
+	// Sizes every rowgroup by the width of its rows instead of by a fixed number of vectors: once its first vector is
+	// read, a rowgroup takes as many vectors as fit `n_bytes` in memory at that width, between
+	// CFG::RowGroup::MIN_N_VECTORS and CFG::RowGroup::MAX_N_VECTORS. Wide tables get short rowgroups and narrow ones
+	// long rowgroups. 0 goes back to set_n_vectors_per_rowgroup; any other budget below
+	// CFG::RowGroup::MIN_BYTE_BUDGET throws.
+	Connection& set_rowgroup_byte_budget(n_t n_bytes);
+	//
+	[[nodiscard]] n_t get_rowgroup_byte_budget() const;
 	///!
 	[[nodiscard]] Table& get_table() const;
 	//
 	[[nodiscard]] fls_bool is_footer_inlined() const;
 	//
 	Connection& inline_footer();
+	// API:
+	// Builds a split-block Bloom filter per column per rowgroup and stores it in the footer,
+	// so point lookups can skip rowgroups without reading them.
+	Connection& enable_bloom_filter();
+	// API:
+	// Caps the memory held by the readers of this connection: read buffers and decoding operators.
+	// Readers that cache rowgroups evict them to stay under the cap; a single rowgroup that does not fit
+	// throws MemoryBudgetException instead of growing past it. 0 removes the cap.
+	Connection& set_memory_budget(n_t n_bytes);
+	// API: the bytes the readers of this connection hold now, and at most so far.
+	[[nodiscard]] n_t get_memory_usage() const;
+	[[nodiscard]] n_t get_peak_memory_usage() const;
+	//
+	[[nodiscard]] MemoryTracker& get_memory_tracker() const;
+	// API:
+	// Reads rowgroups through the process-wide RowgroupCache, so readers of the same file share the bytes
+	// of hot rowgroups instead of reading them again. Cached rowgroups count against the cache budget,
+	// not against the memory budget of the connection.
+	Connection& enable_rowgroup_cache();
+	// nullptr if the rowgroup cache is not enabled.
+	[[nodiscard]] RowgroupCache* get_rowgroup_cache() const;
+	// API:
+	// Opens tables through the process-wide FooterCache, so opening a file that was opened before, by any
+	// connection, skips reading and parsing its header, footer and table descriptor.
+	Connection& enable_footer_cache();
+	// nullptr if the footer cache is not enabled.
+	[[nodiscard]] FooterCache* get_footer_cache() const;
+	// API:
+	// Backs the rowgroup read buffers and the encode buffer with 2 MiB huge pages, faulted in when allocated,
+	// so large sequential scans take fewer TLB misses and page faults. Explicit huge pages are used if the
+	// system reserved them, transparent ones otherwise; buffers smaller than a huge page are unaffected.
+	Connection& enable_huge_pages();
+	//
+	[[nodiscard]] bool is_huge_pages_enabled() const;
+	// API:
+	// Materializes tables with `n_threads` workers spread over the NUMA nodes of the machine. Each node
+	// reads its own share of the rowgroups into node-local buffers; a worker steals from another node only
+	// once its node runs out of rowgroups. 1 reads the rowgroups in order on the calling thread.
+	// The wizard runs its cross-column checks on as many workers.
+	Connection& set_n_scan_threads(n_t n_threads);
+	//
+	[[nodiscard]] n_t get_n_scan_threads() const;
+	// API:
+	// What the wizard picks the encoding of every column for: SIZE the smallest, SPEED the one that scans
+	// fastest given its size and decode cost, BALANCED the fastest of those within
+	// CFG::CostModel::BALANCED_SIZE_SLACK of the smallest. Forced schemas are not affected.
+	Connection& optimize_for(OptimizeFor target);
+	//
+	[[nodiscard]] OptimizeFor get_optimize_for() const;
+	// API:
+	// Lets the wizard reuse the encoding it chose for a column in the previous rowgroup, and in the tables written
+	// before by this connection, instead of searching all encodings again. A reused encoding is re-validated on
+	// CFG::SchemaCache::VALIDATION_SAMPLE_SIZE vectors; a column that drifted is searched as before.
+	Connection& enable_schema_cache();
+	// API: enables the schema cache and seeds it with the encodings of the last rowgroup of an existing file.
+	Connection& reuse_schema(const path& file_path);
+	// nullptr if the schema cache is not enabled.
+	[[nodiscard]] SchemaCache* get_schema_cache() const;
+	// API:
+	// Stores the dictionary of a string column once for the whole file when its rowgroups are all dictionary-encoded
+	// and have values in common. The rowgroups keep only their codes, in one code space for the file: a reader keeps
+	// the dictionary across rowgroups and matches a string predicate against it once. Dictionaries larger than
+	// CFG::GlobalDictionary::MAX_SIZE stay per rowgroup.
+	Connection& enable_global_dictionaries();
+	//
+	[[nodiscard]] bool is_global_dictionaries_enabled() const;
+	// API:
+	// Trains the FSST symbol table of a string column once, on a sample of all its rowgroups, when the column is
+	// FSST-encoded in every rowgroup. The table is stored once in the file and a reader imports it once for all
+	// rowgroups. A rowgroup that compresses more than CFG::SharedSymbolTable::MAX_DRIFT worse with it than the sample
+	// did gets a table trained on itself, which the rowgroups after it then share.
+	Connection& enable_shared_symbol_tables();
+	//
+	[[nodiscard]] bool is_shared_symbol_tables_enabled() const;
+	// API:
+	// Sorts the rows of every rowgroup on the columns `col_idxs` before they are encoded, on the first column and then
+	// on the next ones to break ties, so equal and close values end up next to each other for the run-length and delta
+	// encodings. SortOrder::Z_ORDER orders the rows on all columns at once instead, so filters on any of them find
+	// their values clustered. Rows move within their rowgroup only; an empty `col_idxs` keeps the order of the input.
+	Connection& sort_by(const vector<idx_t>& col_idxs, SortOrder order = CFG::Sort::ORDER);
+	//
+	[[nodiscard]] const vector<idx_t>& get_sort_keys() const;
 	//
 	string_view get_version() const;
 
@@ -128,6 +250,8 @@ private:
 	up<Config>           m_config;
 	up<Table>            m_table;
 	up<TableDescriptorT> m_table_descriptor;
+	up<MemoryTracker>    m_memory_tracker;
+	up<SchemaCache>      m_schema_cache;
 };
 
 constexpr static auto const* FASTLANES_FILE_NAME {"data.fls"};
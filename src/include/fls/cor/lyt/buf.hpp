@@ -10,12 +10,22 @@
 #include "fls/std/span.hpp"
 
 namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class BufPool;
+class MemoryTracker;
+/*--------------------------------------------------------------------------------------------------------------------*/
 class Buf {
 public:
 	// fixed size buffer;
 	explicit Buf();
-	// variable size buffer;
+	// variable size buffer; the capacity is rounded up to the size class of the BufPool it comes from, which is the
+	// BufPool::Local() of the creating thread.
 	explicit Buf(n_t capacity); //
+	// variable size buffer backed by huge pages if `huge_pages` and the capacity spans at least one.
+	explicit Buf(n_t capacity, bool huge_pages);
+	// variable size buffer whose capacity is accounted in `memory_tracker`; throws MemoryBudgetException if it does not
+	// fit the budget.
+	explicit Buf(n_t capacity, MemoryTracker& memory_tracker, bool huge_pages = false);
 	~Buf();                     //
 public:
 	/// pointer to data
@@ -27,7 +37,7 @@ public:
 	//
 	template <typename PT>
 	PT* GetFixedSizeArray(n_t length);
-	///
+	///! grows the buffer if `sz` more bytes do not fit; a swapped buffer cannot grow and throws.
 	void Append(const void* data_p, n_t sz);
 	///
 	template <typename PT>
@@ -55,8 +65,17 @@ public:
 	template <typename PT>
 	PT* mutable_data(); //
 
+public:
+	/// capacity of the fixed size buffer
+	static constexpr n_t DEFAULT_CAPACITY = 64ULL * 8 * 256 * 1024;
+
 private:
 	void init();
+	///! a block of at least `capacity` bytes from the pool, reserved in the memory tracker if there is one; a failed
+	///! allocation gives its reservation back.
+	[[nodiscard]] uint8_t* Acquire(n_t& capacity) const;
+	///! at least doubles the capacity if it is below `min_capacity`.
+	void Grow(n_t min_capacity);
 
 private:
 	/// capacity
@@ -65,6 +84,12 @@ private:
 	n_t      m_off;      //
 	uint8_t* m_owned_p;  //
 	uint8_t* m_active_p; //
+	/// nullptr if the buffer is not accounted
+	MemoryTracker* m_memory_tracker;
+	/// the block was asked for on huge pages
+	bool m_huge_pages;
+	/// BufPool::Local() of the thread that created the buffer; blocks go back to it
+	BufPool* m_pool;
 };
 } // namespace fastlanes
 
@@ -0,0 +1,71 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/cor/lyt/buf_pool.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_COR_LYT_BUF_POOL_HPP
+#define FLS_COR_LYT_BUF_POOL_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/vector.hpp"
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * BufPool
+\*--------------------------------------------------------------------------------------------------------------------*/
+// Size-classed free lists of Buf blocks. A released block is handed to the next Buf of the same class instead of going
+// back to the OS, so the segments and scratch buffers of one column reuse the pages of the previous column.
+// Blocks of HUGE_PAGE_SIZE and up can be asked for on huge pages: explicit ones if the system reserved them, transparent
+// ones otherwise. Such blocks are faulted in when allocated, so a pooled block never page-faults again.
+class BufPool {
+public:
+	explicit BufPool(n_t max_retained_bytes);
+	~BufPool();
+	BufPool(const BufPool&)            = delete;
+	BufPool& operator=(const BufPool&) = delete;
+
+public:
+	///! a block of at least `capacity` bytes; `capacity` is rounded up to its size class.
+	[[nodiscard]] uint8_t* Acquire(n_t& capacity, bool huge_pages = false);
+	///! takes a block back, with the `huge_pages` it was acquired with; it is freed instead if the pool already retains
+	///! its limit.
+	void Release(uint8_t* block, n_t capacity, bool huge_pages = false);
+	///! frees all retained blocks.
+	void Trim();
+	///
+	[[nodiscard]] n_t RetainedBytes() const;
+	///! the smallest size class that holds `capacity` bytes: a power of two, at least MIN_BLOCK_SIZE.
+	[[nodiscard]] static n_t SizeClass(n_t capacity);
+	///! the pool of threads that are not bound to a NUMA node.
+	static BufPool& Global();
+	///! the pool of NUMA node `node`; its blocks were first touched, and therefore placed, on that node.
+	static BufPool& ForNode(n_t node);
+	///! the pool new Bufs of the calling thread allocate from: the one set by SetLocal, Global() otherwise.
+	static BufPool& Local();
+	///! binds the calling thread to `pool`; nullptr goes back to Global().
+	static void SetLocal(BufPool* pool);
+
+public:
+	static constexpr n_t MIN_BLOCK_SIZE = 4 * 1024;
+	static constexpr n_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+private:
+	///! smaller blocks do not fill a huge page and come from the regular lists.
+	[[nodiscard]] static bool IsHuge(n_t capacity, bool huge_pages);
+	static uint8_t*           AllocateHuge(n_t capacity);
+	static void               FreeHuge(uint8_t* block, n_t capacity);
+
+private:
+	mutable std::mutex              m_mutex;
+	const n_t                       m_max_retained_bytes;
+	n_t                             m_retained_bytes;
+	std::map<n_t, vector<uint8_t*>> m_free_blocks;
+	std::map<n_t, vector<uint8_t*>> m_free_huge_blocks;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_COR_LYT_BUF_POOL_HPP
@@ -0,0 +1,60 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/cor/lyt/memory_tracker.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_COR_LYT_MEMORY_TRACKER_HPP
+#define FLS_COR_LYT_MEMORY_TRACKER_HPP
+
+#include "fls/common/alias.hpp"
+#include <atomic>
+#include <stdexcept>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * MemoryBudgetException
+\*--------------------------------------------------------------------------------------------------------------------*/
+class MemoryBudgetException final : public std::runtime_error {
+public:
+	using std::runtime_error::runtime_error;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * MemoryTracker
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The bytes held on behalf of one Connection: the read buffers of its rowgroup readers and the operators decoding
+// them. A budget turns it into a hard cap; readers ask before they grow and shed cached work when the answer is no.
+class MemoryTracker {
+public:
+	///! `budget` of 0 means unlimited.
+	explicit MemoryTracker(n_t budget = 0);
+	MemoryTracker(const MemoryTracker&)            = delete;
+	MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+public:
+	///! accounts `n_bytes`; throws MemoryBudgetException if they do not fit in the budget.
+	void Reserve(n_t n_bytes);
+	///! accounts `n_bytes` only if they fit in the budget.
+	[[nodiscard]] bool TryReserve(n_t n_bytes);
+	///! gives back bytes accounted by Reserve or TryReserve.
+	void Release(n_t n_bytes);
+	///! true if `n_bytes` more would currently fit in the budget.
+	[[nodiscard]] bool Fits(n_t n_bytes) const;
+	///
+	[[nodiscard]] n_t Used() const;
+	///! the highest Used() so far.
+	[[nodiscard]] n_t Peak() const;
+	///
+	[[nodiscard]] n_t Budget() const;
+	///! a new budget only applies to the next reservation; what is already held is not taken back.
+	void SetBudget(n_t budget);
+
+private:
+	std::atomic<n_t> m_used;
+	std::atomic<n_t> m_peak;
+	std::atomic<n_t> m_budget;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_COR_LYT_MEMORY_TRACKER_HPP
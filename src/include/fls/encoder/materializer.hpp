@@ -16,6 +16,8 @@ class Materializer {
 public:
 	explicit Materializer(Rowgroup& rowgroup);
 	void Materialize(const vector<sp<PhysicalExpr>>& expressions, n_t vec_idx) const;
+	///! materializes vector `vec_idx` of column `col_idx` only.
+	void Materialize(const sp<PhysicalExpr>& expr, n_t col_idx, n_t vec_idx) const;
 
 public:
 	Rowgroup& rowgroup;
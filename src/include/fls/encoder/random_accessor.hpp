@@ -6,20 +6,53 @@
 #ifndef FLS_ENCODER_RANDOM_ACCESSOR_HPP
 #define FLS_ENCODER_RANDOM_ACCESSOR_HPP
 
+#include "fls/common/alias.hpp"
+#include "fls/expression/data_type.hpp"
+#include "fls/std/span.hpp"
+#include "fls/std/string.hpp"
+#include "fls/std/variant.hpp"
 #include "fls/std/vector.hpp"
 
 namespace fastlanes {
-class PhysicalExpr;
-class Buf;
+/*--------------------------------------------------------------------------------------------------------------------*/
+class RowgroupReader;
+class Rowgroup;
+/*--------------------------------------------------------------------------------------------------------------------*/
+///! a single value read by random access; std::monostate until a value is read.
+using fls_value_t = variant<std::monostate,
+                            i08_pt,
+                            i16_pt,
+                            i32_pt,
+                            i64_pt,
+                            u08_pt,
+                            u16_pt,
+                            u32_pt,
+                            u64_pt,
+                            flt_pt,
+                            dbl_pt,
+                            string>;
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RandomAccessor
+\*--------------------------------------------------------------------------------------------------------------------*/
 class RandomAccessor {
 public:
-	explicit RandomAccessor();
-	void RandomAccess(const vector<sp<PhysicalExpr>>& expressions, n_t val_idx);
+	explicit RandomAccessor(up<RowgroupReader> rowgroup_reader);
+	~RandomAccessor();
 
 public:
-	up<Buf> data_1_buf;
-	up<Buf> data_2_buf;
+	///! reads the rows at `idxs` (ascending) of vector `vec_idx` of column `col_idx`, one value per idx into `out`.
+	///! FFOR is bit-extracted, DICT reads the index and then the dictionary, RLE looks up the run of each row;
+	///! encodings without a point path are served from the materialized rowgroup, which is decoded once.
+	void RandomAccess(n_t col_idx, n_t vec_idx, span<const vec_idx_t> idxs, fls_value_t* out);
+
+private:
+	fls_value_t MaterializedValue(n_t col_idx, n_t row_idx);
+
+private:
+	up<RowgroupReader>    m_rowgroup_reader;
+	up<Rowgroup>          m_materialized_rowgroup;
+	vector<vector<ofs_t>> m_str_offsets;
 };
 
 } // namespace fastlanes
@@ -0,0 +1,68 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/expression/aggregate.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_EXPRESSION_AGGREGATE_HPP
+#define FLS_EXPRESSION_AGGREGATE_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/encoder/random_accessor.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * AggregateT
+\*--------------------------------------------------------------------------------------------------------------------*/
+enum class AggregateT : uint8_t {
+	SUM   = 0,
+	COUNT = 1,
+	MIN   = 2,
+	MAX   = 3,
+};
+
+///! integers are summed in 64 bits and wrap around on overflow; floating point is summed in double.
+template <typename PT>
+using aggregate_sum_t =
+    std::conditional_t<std::is_floating_point_v<PT>, dbl_pt, std::conditional_t<std::is_signed_v<PT>, i64_pt, u64_pt>>;
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Aggregate
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The running state of one aggregate over one column. Encodings feed it whatever they can produce without a full
+// decode: a repeated value, a partial sum, or a range of decoded values.
+class Aggregate {
+public:
+	explicit Aggregate(AggregateT type);
+
+public:
+	///! folds `n_values` decoded values.
+	template <typename PT>
+	void Update(const PT* values, n_t n_values);
+	///! folds one value repeated `n_repeats` times: a constant, a run or the frequent value.
+	template <typename PT>
+	void Update(PT value, n_t n_repeats);
+	///! folds the sum of `n_values` values computed by the caller, e.g. n * base + sum(packed) for FFOR.
+	template <typename PT>
+	void UpdateSum(aggregate_sum_t<PT> sum, n_t n_values);
+	///! rows that are only counted.
+	void UpdateCount(n_t n_values);
+	///! COUNT is a u64, SUM is an i64, u64 or double, MIN and MAX have the type of the column.
+	///! std::monostate if no row was aggregated.
+	[[nodiscard]] fls_value_t Result() const;
+
+public:
+	const AggregateT type;
+	///! rowgroups answered from the compressed segments, and rowgroups that had to be decoded.
+	n_t n_pushed_down_rowgroups {0};
+	n_t n_decoded_rowgroups {0};
+
+private:
+	n_t         m_count {0};
+	fls_value_t m_value;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_EXPRESSION_AGGREGATE_HPP
@@ -0,0 +1,82 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/expression/boolean_operator.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_EXPRESSION_BOOLEAN_OPERATOR_HPP
+#define FLS_EXPRESSION_BOOLEAN_OPERATOR_HPP
+
+#include "fls/reader/segment.hpp"
+#include "fls/std/type_traits.hpp"
+#include "fls/table/rowgroup.hpp"
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class Segment;
+struct ColumnDescriptorT;
+class PhysicalExpr;
+class ColumnView;
+struct InterpreterState;
+class SelectionDS;
+/*--------------------------------------------------------------------------------------------------------------------*/
+// A boolean vector is stored as one bit per value: 16 words of 64 bits, bit i of word w is value w * 64 + i. A vector
+// that is all false takes no bytes and one that is all true takes a single byte, so the size of the vector in the
+// segment tells which of the three it is.
+struct BooleanVector {
+	static constexpr n_t N_WORDS        = CFG::VEC_SZ / 64;
+	static constexpr n_t ALL_FALSE_SIZE = 0;
+	static constexpr n_t ALL_TRUE_SIZE  = 1;
+	static constexpr n_t BITPACKED_SIZE = N_WORDS * sizeof(uint64_t);
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * enc_boolean_opr
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct enc_boolean_opr {
+public:
+	explicit enc_boolean_opr(const PhysicalExpr& physical_expr,
+	                         const col_pt&       column,
+	                         ColumnDescriptorT&  column_descriptor,
+	                         InterpreterState&   state);
+
+	void Encode();
+	void PointTo(n_t vec_idx);
+	void MoveSegments(vector<up<Segment>>& segments);
+
+public:
+	TypedColumnView<uint8_t> typed_column_view;
+	up<Segment>              bitmap_segment;
+	uint64_t                 bitmap[BooleanVector::N_WORDS];
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * dec_boolean_opr
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct dec_boolean_opr {
+public:
+	explicit dec_boolean_opr(const ColumnView& column_view, n_t segment_idx);
+
+public:
+	void     PointTo(n_t vec_idx);
+	void     Decode();
+	uint8_t* Data();
+	void     Materialize(n_t vec_idx, TypedCol<uint8_t>& typed_col);
+	///! the values at `idxs` of the current vector, without decoding the others.
+	void Gather(span<const vec_idx_t> idxs, uint8_t* out) const;
+	///! the true values of the first `n_values` values of the current vector, by popcount.
+	[[nodiscard]] n_t CountTrue(n_t n_values) const;
+	///! selects the true values among the first `n_values` values of the current vector: the bitmap is copied into
+	///! the selection bitmap, without the words and bits past `n_values`.
+	void Select(n_t n_values, SelectionDS& selection) const;
+
+private:
+	[[nodiscard]] uint64_t Word(n_t word_idx) const;
+
+public:
+	SegmentView bitmap_segment_view;
+	uint8_t     data[CFG::VEC_SZ];
+};
+
+} // namespace fastlanes
+
+#endif // FLS_EXPRESSION_BOOLEAN_OPERATOR_HPP
@@ -22,6 +22,11 @@ std::string ToStr(DataType type);
 \*--------------------------------------------------------------------------------------------------------------------*/
 uint64_t SizeOf(DataType datatype);
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * IsSigned : true if the column is stored as a signed integer.
+\*--------------------------------------------------------------------------------------------------------------------*/
+bool IsSigned(DataType datatype);
+
 /*--------------------------------------------------------------------------------------------------------------------*\
  * Overload << operator
 \*--------------------------------------------------------------------------------------------------------------------*/
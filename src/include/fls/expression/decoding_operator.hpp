@@ -25,6 +25,8 @@ public:
 	void      PointTo(n_t vec_idx);
 	void      Unffor(n_t vec_idx);
 	const PT* Data();
+	///! decodes only the values at `idxs` by extracting them straight from the bit-packed lanes.
+	void Gather(n_t vec_idx, span<const vec_idx_t> idxs, PT* out);
 
 public:
 	SegmentView bitpacked_segment_view;
@@ -43,6 +45,7 @@ public:
 public:
 	void PointTo(n_t vec_n);
 	PT*  Data();
+	void Gather(n_t vec_idx, span<const vec_idx_t> idxs, PT* out);
 
 public:
 	SegmentView data_segment;
@@ -68,7 +71,8 @@ template <typename PT>
 struct dec_constant_opr {
 public:
 	explicit dec_constant_opr(const ColumnView& column_view);
-	PT value;
+	void Gather(span<const vec_idx_t> idxs, PT* out) const;
+	PT   value;
 };
 
 struct dec_constant_str_opr {
@@ -7,6 +7,7 @@
 #define FLS_EXPRESSION_DICT_EXPRESSION_HPP
 
 #include "fls/cfg/cfg.hpp"
+#include "fls/primitive/predicate/str_predicate.hpp"
 #include "fls/reader/segment.hpp"
 #include "fls/table/chunk.hpp"
 #include "fls/table/rowgroup.hpp"
@@ -20,6 +21,9 @@ struct InterpreterState;
 class ColumnView;
 struct InterpreterState;
 class RowgroupReader;
+class GlobalDictionary;
+class GlobalDictionaryView;
+class SelectionDS;
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 /*--------------------------------------------------------------------------------------------------------------------*\
@@ -44,6 +48,12 @@ struct enc_dict_opr<fls_string_t> {
 	                      const col_pt&       column,
 	                      ColumnDescriptorT&  column_descriptor,
 	                      InterpreterState&   state);
+	///! refers to `global_dictionary`, already stored in the file, instead of storing a dictionary in the rowgroup.
+	explicit enc_dict_opr(const PhysicalExpr&     expr,
+	                      const col_pt&           column,
+	                      ColumnDescriptorT&      column_descriptor,
+	                      InterpreterState&       state,
+	                      const GlobalDictionary& global_dictionary);
 
 	void PointTo(n_t vec_idx);
 	void Encode();
@@ -54,7 +64,8 @@ public:
 	up<Segment> offset_segment;
 	up<Segment> bytes_segment;
 
-	FlsStrColumnView col_view;
+	FlsStrColumnView        col_view;
+	const GlobalDictionary* global_dictionary;
 };
 
 /*--------------------------------------------------------------------------------------------------------------------*\
@@ -65,6 +76,8 @@ struct dec_dict_opr {
 	explicit dec_dict_opr(const PhysicalExpr& physical_expr, const ColumnView& column_view, InterpreterState& state);
 	KEY_PT*         Keys();
 	const INDEX_PT* Index();
+	///! looks up already gathered dictionary indexes.
+	void Gather(span<const INDEX_PT> gathered_index, KEY_PT* out);
 
 	SegmentView     key_segment_view;
 	const INDEX_PT* index_arr;
@@ -73,16 +86,27 @@ struct dec_dict_opr {
 template <typename INDEX_PT>
 struct dec_dict_opr<fls_string_t, INDEX_PT> {
 	explicit dec_dict_opr(const PhysicalExpr& physical_expr, const ColumnView& column_view, InterpreterState& state);
+	///! decodes through the dictionary the rowgroups of the file share instead of one stored in the rowgroup.
+	explicit dec_dict_opr(const PhysicalExpr&   physical_expr,
+	                      GlobalDictionaryView& global_dictionary,
+	                      InterpreterState&     state);
 
 	const INDEX_PT* Index();
 	const ofs_t*    Offsets();
 	const uint8_t*  Bytes();
 	void            Decode(vector<uint8_t>& byte_arr_vec, vector<ofs_t>& length_vec);
+	///! selects the values among the first `n_values` of the current vector that satisfy `predicate`. the predicate
+	///! is evaluated once per dictionary entry, and once per file if the dictionary is shared, then looked up through
+	///! the index.
+	void Filter(const StrPredicate& predicate, n_t n_values, SelectionDS& selection);
 
 public:
-	SegmentView     dict_offsets_segment;
-	SegmentView     dict_bytes_segment;
-	const INDEX_PT* index_arr;
+	const ofs_t*          dict_offsets;
+	const uint8_t*        dict_bytes;
+	n_t                   n_dict_values;
+	const INDEX_PT*       index_arr;
+	GlobalDictionaryView* global_dictionary;
+	DictionaryMatcher     matcher;
 };
 
 } // namespace fastlanes
@@ -15,6 +15,7 @@ class Segment;
 struct ColumnDescriptorT;
 class PhysicalExpr;
 struct InterpreterState;
+class GlobalDictionary;
 /*--------------------------------------------------------------------------------------------------------------------*/
 /*--------------------------------------------------------------------------------------------------------------------*\
  * enc_scan_opr
@@ -57,11 +58,18 @@ struct enc_dict_map_opr<fls_string_t, INDEX_PT> {
 	                          const col_pt&       column,
 	                          ColumnDescriptorT&  column_descriptor,
 	                          InterpreterState&   state);
+	///! maps the values to their codes in `global_dictionary` instead of in the dictionary of the rowgroup.
+	explicit enc_dict_map_opr(const PhysicalExpr&     expr,
+	                          const col_pt&           column,
+	                          ColumnDescriptorT&      column_descriptor,
+	                          InterpreterState&       state,
+	                          const GlobalDictionary& global_dictionary);
 	void PointTo(n_t vec_idx);
 	void Map();
 
-	FlsStrColumnView column_view;
-	INDEX_PT         index_arr[CFG::VEC_SZ];
+	FlsStrColumnView         column_view;
+	const BiMapFrequencyStr* bimap;
+	INDEX_PT                 index_arr[CFG::VEC_SZ];
 };
 /*--------------------------------------------------------------------------------------------------------------------*\
  * enc_constant_op
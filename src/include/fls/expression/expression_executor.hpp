@@ -7,10 +7,16 @@
 #define FLS_EXPRESSION_EXPRESSION_EXECUTOR_HPP
 
 #include "fls/common/alias.hpp"
+#include "fls/std/span.hpp"
+#include "fls/std/vector.hpp"
+#include <cstddef>
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
 class PhysicalExpr;
+struct StrPredicate;
+class SelectionDS;
+class Aggregate;
 /*--------------------------------------------------------------------------------------------------------------------*/
 class ExprExecutor {
 public:
@@ -20,6 +26,24 @@ public:
 	static void execute(PhysicalExpr& expr, n_t vec_idx);
 	//
 	static void smart_execute(PhysicalExpr& expr, n_t vec_idx);
+	// decodes only the values at `idxs` of vector `vec_idx` into `out`, compacted. `idxs` must be ascending.
+	// returns false, leaving `out` untouched, if the expression has no gather path.
+	static bool gather(PhysicalExpr& expr, n_t vec_idx, span<const vec_idx_t> idxs, std::byte* out);
+	// evaluates a string predicate on the first `n_values` compressed values of vector `vec_idx` and stores the
+	// matching positions in `selection`. returns false, leaving `selection` untouched, if the expression is not
+	// fsst-compressed.
+	static bool
+	filter(PhysicalExpr& expr, n_t vec_idx, n_t n_values, const StrPredicate& predicate, SelectionDS& selection);
+	// stores the positions of the true values among the first `n_values` of vector `vec_idx` of a boolean column in
+	// `selection`, as its bitmap. returns false, leaving `selection` untouched, if the column is not bit-packed as
+	// booleans.
+	static bool select(PhysicalExpr& expr, n_t vec_idx, n_t n_values, SelectionDS& selection);
+	// folds the first `n_tuples` values of the column into `aggregate`, straight from the segments where the encoding
+	// allows it. returns false, leaving `aggregate` untouched, if the column has to be decoded instead.
+	static bool aggregate(PhysicalExpr& expr, bool is_signed, n_t n_tuples, Aggregate& aggregate);
+	// the bytes held by the operators of `exprs`, which keep their decoded vectors and scratch arrays inline.
+	// an operator shared by several expressions is counted once.
+	static n_t memory_usage(const vector<sp<PhysicalExpr>>& exprs);
 	//
 	ExprExecutor() = default;
 };
@@ -86,6 +86,8 @@ public:
 	void PointTo(n_t vec_idx);
 	void Decode(n_t vec_idx);
 	void Materialize(n_t vec_idx, TypedCol<PT>& typed_col);
+	///! `idxs` must be ascending, like the exception positions.
+	void Gather(n_t vec_idx, span<const vec_idx_t> idxs, PT* out);
 	PT   data[CFG::VEC_SZ];
 	PT   frequent_val;
 
@@ -8,6 +8,7 @@
 
 #include "fls/cfg/cfg.hpp"
 #include "fls/cor/prm/fsst12/fsst12.h"
+#include "fls/primitive/predicate/str_predicate.hpp"
 #include "fls/reader/segment.hpp"
 #include "fls/table/chunk.hpp"
 #include "fls/table/rowgroup.hpp"
@@ -21,6 +22,10 @@ struct InterpreterState;
 class ColumnView;
 struct InterpreterState;
 class RowgroupReader;
+class SelectionDS;
+class SharedSymbolTable;
+template <typename DECODER_T>
+class SymbolTableView;
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 /*--------------------------------------------------------------------------------------------------------------------*\
@@ -31,6 +36,12 @@ struct enc_fsst12_opr {
 	                        const col_pt&       column,
 	                        ColumnDescriptorT&  column_descriptor,
 	                        InterpreterState&   state);
+	///! compresses with `symbol_table`, which the rowgroup does not store: the header segment stays empty.
+	explicit enc_fsst12_opr(const PhysicalExpr&      expr,
+	                        const col_pt&            column,
+	                        ColumnDescriptorT&       column_descriptor,
+	                        InterpreterState&        state,
+	                        const SharedSymbolTable& symbol_table);
 	~enc_fsst12_opr();
 
 	void PointTo(n_t vec_idx);
@@ -50,6 +61,8 @@ public:
 	up<Segment> fsst12_header_segment;
 	up<Segment> fsst12_bytes_segment;
 	up<Segment> fsst12_offset_segment;
+	///! false if the rowgroup stores its own symbol table.
+	bool is_shared;
 };
 
 /*--------------------------------------------------------------------------------------------------------------------*\
@@ -58,18 +71,29 @@ public:
 struct dec_fsst12_opr {
 public:
 	explicit dec_fsst12_opr(PhysicalExpr& physical_expr, const ColumnView& column_view, InterpreterState& state);
+	///! decodes with the shared `symbol_table` instead of the one in the header segment.
+	explicit dec_fsst12_opr(PhysicalExpr&                      physical_expr,
+	                        const ColumnView&                  column_view,
+	                        SymbolTableView<fsst12_decoder_t>& symbol_table,
+	                        InterpreterState&                  state);
 
 public:
 	void PointTo(n_t vec_n);
 	void Decode(vector<uint8_t>& out_byte_arr, vector<ofs_t>& out_length_arr);
+	///! selects the strings among the first `n_values` of the current vector that satisfy `predicate` without
+	///! decompressing them.
+	void Filter(const StrPredicate& predicate, n_t n_values, SelectionDS& selection);
 
 public:
-	SegmentView      fsst12_header_segment_view;
-	SegmentView      fsst12_bytes_segment_view;
-	fsst12_decoder_t fsst12_decoder;
-	vector<uint8_t>  tmp_string;
-	ofs_t*           offset_arr;
-	ofs_t            untrasposed_offset[CFG::VEC_SZ];
+	SegmentView                        fsst12_header_segment_view;
+	SegmentView                        fsst12_bytes_segment_view;
+	fsst12_decoder_t                   fsst12_decoder;
+	vector<uint8_t>&                   tmp_string;
+	ofs_t*                             offset_arr;
+	ofs_t                              untrasposed_offset[CFG::VEC_SZ];
+	up<FsstMatcher<fsst12_decoder_t>>  matcher;
+	fsst12_decoder_t*                  decoder_p;    // the one imported from the header segment, or the shared one
+	SymbolTableView<fsst12_decoder_t>* symbol_table; // nullptr if the rowgroup has its own
 };
 
 } // namespace fastlanes
@@ -8,6 +8,7 @@
 
 #include "fls/cfg/cfg.hpp"
 #include "fls/cor/prm/fsst/fsst.h"
+#include "fls/primitive/predicate/str_predicate.hpp"
 #include "fls/reader/segment.hpp"
 #include "fls/table/chunk.hpp"
 #include "fls/table/rowgroup.hpp"
@@ -21,6 +22,7 @@ struct InterpreterState;
 class ColumnView;
 struct InterpreterState;
 class RowgroupReader;
+class SelectionDS;
 /*--------------------------------------------------------------------------------------------------------------------*/
 struct enc_fsst_dict_opr {
 	explicit enc_fsst_dict_opr(const PhysicalExpr& expr,
@@ -57,14 +59,19 @@ struct dec_fsst_dict_opr {
 	const ofs_t*    Offsets();
 	const uint8_t*  Bytes();
 	void            Decode(vector<uint8_t>& byte_arr_vec, vector<ofs_t>& length_vec);
+	///! selects the values among the first `n_values` of the current vector that satisfy `predicate`. the predicate
+	///! is evaluated once per dictionary entry, on the compressed entry, and then looked up through the index.
+	void Filter(const StrPredicate& predicate, n_t n_values, SelectionDS& selection);
 
 public:
-	SegmentView     fsst_header_segment_view;
-	SegmentView     fsst_bytes_segment_view;
-	SegmentView     fsst_offset_segment_view;
-	const INDEX_PT* index_arr;
-	vector<uint8_t> tmp_string;
-	fsst_decoder_t  fsst_decoder;
+	SegmentView                     fsst_header_segment_view;
+	SegmentView                     fsst_bytes_segment_view;
+	SegmentView                     fsst_offset_segment_view;
+	const INDEX_PT*                 index_arr;
+	vector<uint8_t>&                tmp_string;
+	fsst_decoder_t                  fsst_decoder;
+	up<FsstMatcher<fsst_decoder_t>> matcher;
+	vector<uint8_t>                 entry_match_arr;
 };
 
 } // namespace fastlanes
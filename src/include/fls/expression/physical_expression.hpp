@@ -94,6 +94,8 @@ template <typename PT>
 struct dec_cross_rle_opr;
 struct enc_validitymask_opr;
 struct dec_validitymask_opr;
+struct enc_boolean_opr;
+struct dec_boolean_opr;
 template <typename PT>
 struct enc_data_parallel_patch_opr;
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -152,6 +154,9 @@ using physical_operator = variant<std::monostate,
                                   sp<enc_dict_opr<i16_pt>>,
                                   sp<enc_dict_opr<i08_pt>>,
                                   sp<enc_dict_opr<u08_pt>>,
+                                  sp<enc_dict_opr<u16_pt>>,
+                                  sp<enc_dict_opr<u32_pt>>,
+                                  sp<enc_dict_opr<u64_pt>>,
                                   sp<enc_dict_opr<dbl_pt>>,
                                   sp<enc_dict_opr<fls_string_t>>,
                                   sp<enc_dict_opr<flt_pt>>,
@@ -165,6 +170,14 @@ using physical_operator = variant<std::monostate,
                                   sp<struct dec_dict_opr<i16_pt, u08_pt>>,
                                   sp<struct dec_dict_opr<i08_pt, u08_pt>>,
                                   sp<struct dec_dict_opr<u08_pt, u08_pt>>,
+                                  sp<struct dec_dict_opr<u16_pt, u16_pt>>,
+                                  sp<struct dec_dict_opr<u16_pt, u08_pt>>,
+                                  sp<struct dec_dict_opr<u32_pt, u32_pt>>,
+                                  sp<struct dec_dict_opr<u32_pt, u16_pt>>,
+                                  sp<struct dec_dict_opr<u32_pt, u08_pt>>,
+                                  sp<struct dec_dict_opr<u64_pt, u32_pt>>,
+                                  sp<struct dec_dict_opr<u64_pt, u16_pt>>,
+                                  sp<struct dec_dict_opr<u64_pt, u08_pt>>,
                                   sp<struct dec_dict_opr<dbl_pt, u32_pt>>,
                                   sp<struct dec_dict_opr<dbl_pt, u16_pt>>,
                                   sp<struct dec_dict_opr<dbl_pt, u08_pt>>,
@@ -220,6 +233,14 @@ using physical_operator = variant<std::monostate,
                                   sp<struct enc_dict_map_opr<flt_pt, u32_pt>>,
                                   sp<struct enc_dict_map_opr<flt_pt, u16_pt>>,
                                   sp<struct enc_dict_map_opr<flt_pt, u08_pt>>,
+                                  sp<struct enc_dict_map_opr<u16_pt, u16_pt>>,
+                                  sp<struct enc_dict_map_opr<u16_pt, u08_pt>>,
+                                  sp<struct enc_dict_map_opr<u32_pt, u32_pt>>,
+                                  sp<struct enc_dict_map_opr<u32_pt, u16_pt>>,
+                                  sp<struct enc_dict_map_opr<u32_pt, u08_pt>>,
+                                  sp<struct enc_dict_map_opr<u64_pt, u32_pt>>,
+                                  sp<struct enc_dict_map_opr<u64_pt, u16_pt>>,
+                                  sp<struct enc_dict_map_opr<u64_pt, u08_pt>>,
                                   // FSST
                                   sp<struct enc_fsst_opr>,
                                   sp<struct enc_fsst12_opr>,
@@ -266,6 +287,12 @@ using physical_operator = variant<std::monostate,
                                   sp<struct dec_rle_map_opr<i08_pt, u16_pt>>,
                                   sp<struct enc_rle_map_opr<u08_pt, u16_pt>>,
                                   sp<struct dec_rle_map_opr<u08_pt, u16_pt>>,
+                                  sp<struct enc_rle_map_opr<u16_pt, u16_pt>>,
+                                  sp<struct dec_rle_map_opr<u16_pt, u16_pt>>,
+                                  sp<struct enc_rle_map_opr<u32_pt, u16_pt>>,
+                                  sp<struct dec_rle_map_opr<u32_pt, u16_pt>>,
+                                  sp<struct enc_rle_map_opr<u64_pt, u16_pt>>,
+                                  sp<struct dec_rle_map_opr<u64_pt, u16_pt>>,
                                   sp<struct enc_rle_map_opr<fls_string_t, u16_pt>>,
                                   sp<struct dec_rle_map_opr<fls_string_t, u16_pt>>,
                                   // FFOR
@@ -339,6 +366,9 @@ using physical_operator = variant<std::monostate,
                                   // VALIDITY MASK
                                   sp<enc_validitymask_opr>,
                                   sp<dec_validitymask_opr>,
+                                  // BOOLEAN
+                                  sp<enc_boolean_opr>,
+                                  sp<dec_boolean_opr>,
                                   // RSUM
                                   sp<enc_rsum_opr<u08_pt>>,
                                   sp<dec_rsum_opr<u08_pt>>,
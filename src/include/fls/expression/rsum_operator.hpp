@@ -21,13 +21,17 @@ struct InterpreterState;
 /*--------------------------------------------------------------------------------------------------------------------*\
  * enc_rsum_opr
 \*--------------------------------------------------------------------------------------------------------------------*/
+// With `is_delta_of_delta`, the deltas are taken twice: every lane keeps its first value as base, its first delta
+// relative to the first delta of lane 0, stored after the bases, and the differences of its later deltas.
+// Fixed-interval values with jitter leave only the jitter to bit-pack.
 template <typename PT>
 struct enc_rsum_opr {
 public:
 	explicit enc_rsum_opr(const PhysicalExpr& expr,
 	                      const col_pt&       col,
 	                      ColumnDescriptorT&  column_descriptor,
-	                      InterpreterState&   state);
+	                      InterpreterState&   state,
+	                      bool                a_is_delta_of_delta = false);
 
 	void Rsum();
 	void MoveSegments(vector<up<Segment>>& segments);
@@ -37,6 +41,7 @@ public:
 	PT          deltas[CFG::VEC_SZ];
 	PT          rsumed_bases[CFG::VEC_SZ];
 	up<Segment> bases_segment;
+	bool        is_delta_of_delta;
 };
 
 /*--------------------------------------------------------------------------------------------------------------------*\
@@ -45,7 +50,10 @@ public:
 template <typename PT>
 struct dec_rsum_opr {
 public:
-	explicit dec_rsum_opr(PhysicalExpr& physical_expr, const ColumnView& column_view, InterpreterState& state);
+	explicit dec_rsum_opr(PhysicalExpr&     physical_expr,
+	                      const ColumnView& column_view,
+	                      InterpreterState& state,
+	                      bool              a_is_delta_of_delta = false);
 
 public:
 	void PointTo(n_t vec_n);
@@ -55,6 +63,7 @@ public:
 	SegmentView bases_segment_view;
 	const PT*   deltas;
 	PT          idxs[CFG::VEC_SZ];
+	bool        is_delta_of_delta;
 };
 
 } // namespace fastlanes
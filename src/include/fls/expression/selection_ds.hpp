@@ -9,6 +9,7 @@
 #include "fls/cfg/cfg.hpp"
 #include "fls/common/common.hpp"
 #include "fls/std/array.hpp"
+#include "fls/std/span.hpp"
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -24,6 +25,10 @@ public:
 	SelectionDS& operator=(const SelectionDS&) = delete; // non copyable
 public:
 	void Reset();
+	///! unpacks a bitmap selection into `idx_arr`; an index selection is left as it is.
+	void ToIndices();
+	///! ascending positions of the selected values; a bitmap selection has to be unpacked with `ToIndices` first.
+	[[nodiscard]] span<const vec_idx_t> Indices() const;
 
 public:
 	///! the logical expression this selectionds belongs to
@@ -0,0 +1,69 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/filter/bloom_filter.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_FILTER_BLOOM_FILTER_HPP
+#define FLS_FILTER_BLOOM_FILTER_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/span.hpp"
+#include "fls/std/string.hpp"
+#include "fls/std/vector.hpp"
+#include "fls/table/rowgroup.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * BloomFilter
+\*--------------------------------------------------------------------------------------------------------------------*/
+// Split-block Bloom filter: every value sets one bit in each of the 8 words of a single 256-bit block,
+// so a lookup touches exactly one cache line.
+class BloomFilter {
+public:
+	using word_t                         = uint32_t;
+	static constexpr n_t WORDS_PER_BLOCK = 8;
+	static constexpr n_t BITS_PER_BLOCK  = WORDS_PER_BLOCK * sizeof(word_t) * 8;
+
+public:
+	explicit BloomFilter(n_t n_distinct_values);
+
+public:
+	///! builds a filter over the non-null values of a column. nested columns get an empty filter.
+	static vector<word_t> Build(const col_pt& column);
+	///!
+	static bool MayContain(span<const word_t> words, uint64_t hash);
+	///!
+	void Insert(uint64_t hash);
+	///!
+	static uint64_t Hash(const uint8_t* data, n_t size);
+	///! integers and integral floating-point values hash alike, so a lookup does not depend on the physical type
+	///! the column was cast to.
+	template <typename PT>
+	static uint64_t Hash(const PT& value) {
+		if constexpr (std::is_integral_v<PT>) {
+			const auto val = static_cast<int64_t>(value);
+			return Hash(reinterpret_cast<const uint8_t*>(&val), sizeof(val));
+		} else if constexpr (std::is_floating_point_v<PT>) {
+			auto val = static_cast<double>(value);
+			if (std::trunc(val) == val && std::abs(val) < static_cast<double>(std::numeric_limits<int64_t>::max())) {
+				return Hash(static_cast<int64_t>(val));
+			}
+			return Hash(reinterpret_cast<const uint8_t*>(&val), sizeof(val));
+		} else {
+			const string_view val {value};
+			return Hash(reinterpret_cast<const uint8_t*>(val.data()), val.size());
+		}
+	}
+
+public:
+	vector<word_t> words;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_FILTER_BLOOM_FILTER_HPP
@@ -110,6 +110,7 @@ struct ColumnDescriptorT : public ::flatbuffers::NativeTable {
 	std::vector<std::unique_ptr<fastlanes::SegmentDescriptorT>> segment_descriptors {};
 	uint64_t                                                    n_null = 0;
 	std::unique_ptr<fastlanes::DecimalTypeT>                    fix_me_decimal_type {};
+	std::vector<uint32_t>                                       bloom_filter {};
 	ColumnDescriptorT() = default;
 	ColumnDescriptorT(const ColumnDescriptorT& o);
 	ColumnDescriptorT(ColumnDescriptorT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -131,7 +132,8 @@ struct ColumnDescriptor FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
         VT_EXPR_SPACE          = 20,
         VT_SEGMENT_DESCRIPTORS = 22,
         VT_N_NULL              = 24,
-        VT_FIX_ME_DECIMAL_TYPE = 26
+        VT_FIX_ME_DECIMAL_TYPE = 26,
+        VT_BLOOM_FILTER        = 28
 	};
 	fastlanes::DataType data_type() const {
 		return static_cast<fastlanes::DataType>(GetField<uint8_t>(VT_DATA_TYPE, 0));
@@ -172,6 +174,9 @@ struct ColumnDescriptor FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
 	const fastlanes::DecimalType* fix_me_decimal_type() const {
 		return GetPointer<const fastlanes::DecimalType*>(VT_FIX_ME_DECIMAL_TYPE);
 	}
+	const ::flatbuffers::Vector<uint32_t>* bloom_filter() const {
+		return GetPointer<const ::flatbuffers::Vector<uint32_t>*>(VT_BLOOM_FILTER);
+	}
 	bool Verify(::flatbuffers::Verifier& verifier) const {
 		return VerifyTableStart(verifier) && VerifyField<uint8_t>(verifier, VT_DATA_TYPE, 1) &&
 		       VerifyOffset(verifier, VT_ENCODING_RPN) && verifier.VerifyTable(encoding_rpn()) &&
@@ -185,7 +190,7 @@ struct ColumnDescriptor FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
 		       VerifyOffset(verifier, VT_SEGMENT_DESCRIPTORS) && verifier.VerifyVector(segment_descriptors()) &&
 		       verifier.VerifyVectorOfTables(segment_descriptors()) && VerifyField<uint64_t>(verifier, VT_N_NULL, 8) &&
 		       VerifyOffset(verifier, VT_FIX_ME_DECIMAL_TYPE) && verifier.VerifyTable(fix_me_decimal_type()) &&
-		       verifier.EndTable();
+		       VerifyOffset(verifier, VT_BLOOM_FILTER) && verifier.VerifyVector(bloom_filter()) && verifier.EndTable();
 	}
 	ColumnDescriptorT* UnPack(const ::flatbuffers::resolver_function_t* _resolver = nullptr) const;
 	void UnPackTo(ColumnDescriptorT* _o, const ::flatbuffers::resolver_function_t* _resolver = nullptr) const;
@@ -238,6 +243,9 @@ struct ColumnDescriptorBuilder {
 	void add_fix_me_decimal_type(::flatbuffers::Offset<fastlanes::DecimalType> fix_me_decimal_type) {
 		fbb_.AddOffset(ColumnDescriptor::VT_FIX_ME_DECIMAL_TYPE, fix_me_decimal_type);
 	}
+	void add_bloom_filter(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> bloom_filter) {
+		fbb_.AddOffset(ColumnDescriptor::VT_BLOOM_FILTER, bloom_filter);
+	}
 	explicit ColumnDescriptorBuilder(::flatbuffers::FlatBufferBuilder& _fbb)
 	    : fbb_(_fbb) {
 		start_ = fbb_.StartTable();
@@ -262,13 +270,15 @@ inline ::flatbuffers::Offset<ColumnDescriptor> CreateColumnDescriptor(
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<fastlanes::ExpressionResult>>> expr_space    = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<fastlanes::SegmentDescriptor>>>
                                                   segment_descriptors = 0,
-    uint64_t                                      n_null              = 0,
-    ::flatbuffers::Offset<fastlanes::DecimalType> fix_me_decimal_type = 0) {
+    uint64_t                                               n_null              = 0,
+    ::flatbuffers::Offset<fastlanes::DecimalType>          fix_me_decimal_type = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> bloom_filter        = 0) {
 	ColumnDescriptorBuilder builder_(_fbb);
 	builder_.add_n_null(n_null);
 	builder_.add_total_size(total_size);
 	builder_.add_column_offset(column_offset);
 	builder_.add_idx(idx);
+	builder_.add_bloom_filter(bloom_filter);
 	builder_.add_fix_me_decimal_type(fix_me_decimal_type);
 	builder_.add_segment_descriptors(segment_descriptors);
 	builder_.add_expr_space(expr_space);
@@ -293,7 +303,8 @@ inline ::flatbuffers::Offset<ColumnDescriptor> CreateColumnDescriptorDirect(
     const std::vector<::flatbuffers::Offset<fastlanes::ExpressionResult>>*  expr_space          = nullptr,
     const std::vector<::flatbuffers::Offset<fastlanes::SegmentDescriptor>>* segment_descriptors = nullptr,
     uint64_t                                                                n_null              = 0,
-    ::flatbuffers::Offset<fastlanes::DecimalType>                           fix_me_decimal_type = 0) {
+    ::flatbuffers::Offset<fastlanes::DecimalType>                           fix_me_decimal_type = 0,
+    const std::vector<uint32_t>*                                            bloom_filter        = nullptr) {
 	auto name__     = name ? _fbb.CreateString(name) : 0;
 	auto children__ = children ? _fbb.CreateVector<::flatbuffers::Offset<fastlanes::ColumnDescriptor>>(*children) : 0;
 	auto expr_space__ =
@@ -302,6 +313,7 @@ inline ::flatbuffers::Offset<ColumnDescriptor> CreateColumnDescriptorDirect(
 	    segment_descriptors
 	        ? _fbb.CreateVector<::flatbuffers::Offset<fastlanes::SegmentDescriptor>>(*segment_descriptors)
 	        : 0;
+	auto bloom_filter__ = bloom_filter ? _fbb.CreateVector<uint32_t>(*bloom_filter) : 0;
 	return fastlanes::CreateColumnDescriptor(_fbb,
 	                                         data_type,
 	                                         encoding_rpn,
@@ -314,7 +326,8 @@ inline ::flatbuffers::Offset<ColumnDescriptor> CreateColumnDescriptorDirect(
 	                                         expr_space__,
 	                                         segment_descriptors__,
 	                                         n_null,
-	                                         fix_me_decimal_type);
+	                                         fix_me_decimal_type,
+	                                         bloom_filter__);
 }
 
 ::flatbuffers::Offset<ColumnDescriptor>
@@ -375,7 +388,8 @@ inline ColumnDescriptorT::ColumnDescriptorT(const ColumnDescriptorT& o)
     , column_offset(o.column_offset)
     , total_size(o.total_size)
     , n_null(o.n_null)
-    , fix_me_decimal_type((o.fix_me_decimal_type) ? new fastlanes::DecimalTypeT(*o.fix_me_decimal_type) : nullptr) {
+    , fix_me_decimal_type((o.fix_me_decimal_type) ? new fastlanes::DecimalTypeT(*o.fix_me_decimal_type) : nullptr)
+    , bloom_filter(o.bloom_filter) {
 	children.reserve(o.children.size());
 	for (const auto& children_ : o.children) {
 		children.emplace_back((children_) ? new fastlanes::ColumnDescriptorT(*children_) : nullptr);
@@ -404,6 +418,7 @@ inline ColumnDescriptorT& ColumnDescriptorT::operator=(ColumnDescriptorT o) FLAT
 	std::swap(segment_descriptors, o.segment_descriptors);
 	std::swap(n_null, o.n_null);
 	std::swap(fix_me_decimal_type, o.fix_me_decimal_type);
+	std::swap(bloom_filter, o.bloom_filter);
 	return *this;
 }
 
@@ -524,6 +539,17 @@ inline void ColumnDescriptor::UnPackTo(ColumnDescriptorT*
 			_o->fix_me_decimal_type.reset();
 		}
 	}
+	{
+		auto _e = bloom_filter();
+		if (_e) {
+			_o->bloom_filter.resize(_e->size());
+			for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) {
+				_o->bloom_filter[_i] = _e->Get(_i);
+			}
+		} else {
+			_o->bloom_filter.resize(0);
+		}
+	}
 }
 
 inline ::flatbuffers::Offset<ColumnDescriptor>
@@ -583,6 +609,7 @@ CreateColumnDescriptor(::flatbuffers::FlatBufferBuilder&         _fbb,
 	auto _n_null              = _o->n_null;
 	auto _fix_me_decimal_type =
 	    _o->fix_me_decimal_type ? CreateDecimalType(_fbb, _o->fix_me_decimal_type.get(), _rehasher) : 0;
+	auto _bloom_filter = _o->bloom_filter.size() ? _fbb.CreateVector(_o->bloom_filter) : 0;
 	return fastlanes::CreateColumnDescriptor(_fbb,
 	                                         _data_type,
 	                                         _encoding_rpn,
@@ -595,7 +622,8 @@ CreateColumnDescriptor(::flatbuffers::FlatBufferBuilder&         _fbb,
 	                                         _expr_space,
 	                                         _segment_descriptors,
 	                                         _n_null,
-	                                         _fix_me_decimal_type);
+	                                         _fix_me_decimal_type,
+	                                         _bloom_filter);
 }
 
 inline const fastlanes::ColumnDescriptor* GetColumnDescriptor(const void* buf) {
@@ -0,0 +1,71 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/footer/footer_cache.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_FOOTER_FOOTER_CACHE_HPP
+#define FLS_FOOTER_FOOTER_CACHE_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/footer/table_descriptor.hpp"
+#include "fls/std/filesystem.hpp"
+#include "fls/std/string.hpp"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * FooterCache
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The table descriptors of recently opened files, keyed by File::identity, shared by every reader of the connections
+// that enable it. A hit opens a table without touching the file; entries are evicted least recently used first to
+// stay within the byte budget. Handles share their bytes, so an evicted descriptor stays valid while in use.
+class FooterCache {
+public:
+	explicit FooterCache(n_t budget);
+	FooterCache(const FooterCache&)            = delete;
+	FooterCache& operator=(const FooterCache&) = delete;
+
+public:
+	///! the table descriptor of the file, loaded and cached on a miss.
+	[[nodiscard]] TableDescriptorHandle Get(const path& file_path);
+	///! drops all entries.
+	void Clear();
+	///
+	[[nodiscard]] n_t CachedBytes() const;
+	///
+	[[nodiscard]] n_t Budget() const;
+	///! a smaller budget evicts right away.
+	void SetBudget(n_t budget);
+	///
+	[[nodiscard]] n_t Hits() const;
+	///
+	[[nodiscard]] n_t Misses() const;
+	///! the cache shared by all connections of the process.
+	static FooterCache& Global();
+	///! reads the header, the footer and an inlined table descriptor with one open and, for descriptors that fit in
+	///! CFG::Footer::SPECULATIVE_READ_SIZE, one read of the tail of the file.
+	static TableDescriptorHandle Load(const path& file_path);
+
+private:
+	struct Entry {
+		string                key;
+		TableDescriptorHandle handle;
+	};
+
+	void Evict(n_t budget);
+
+private:
+	mutable std::mutex                                     m_mutex;
+	n_t                                                    m_budget;
+	n_t                                                    m_cached_bytes;
+	n_t                                                    m_hits;
+	n_t                                                    m_misses;
+	std::list<Entry>                                       m_lru; // most recently used first
+	std::unordered_map<string, std::list<Entry>::iterator> m_entries;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_FOOTER_FOOTER_CACHE_HPP
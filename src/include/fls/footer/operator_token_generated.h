@@ -176,10 +176,53 @@ enum class OperatorToken : uint16_t {
 	EXP_DELTA_U08                        = 153,
 	EXP_RLE_U08_U16                      = 154,
 	EXP_GALP_FLT                         = 155,
-	EXP_GALP_DBL                         = 156
+	EXP_GALP_DBL                         = 156,
+	EXP_DELTA2_I64                       = 157,
+	EXP_DELTA2_I32                       = 158,
+	EXP_DELTA2_I16                       = 159,
+	EXP_BOOLEAN                          = 160,
+	EXP_UNCOMPRESSED_U16                 = 161,
+	EXP_CONSTANT_U16                     = 162,
+	EXP_FFOR_U16                         = 163,
+	EXP_FFOR_SLPATCH_U16                 = 164,
+	EXP_DELTA_U16                        = 165,
+	EXP_RLE_U16_U16                      = 166,
+	EXP_UNCOMPRESSED_U32                 = 167,
+	EXP_CONSTANT_U32                     = 168,
+	EXP_FFOR_U32                         = 169,
+	EXP_FFOR_SLPATCH_U32                 = 170,
+	EXP_DELTA_U32                        = 171,
+	EXP_RLE_U32_U16                      = 172,
+	EXP_UNCOMPRESSED_U64                 = 173,
+	EXP_CONSTANT_U64                     = 174,
+	EXP_FFOR_U64                         = 175,
+	EXP_FFOR_SLPATCH_U64                 = 176,
+	EXP_DELTA_U64                        = 177,
+	EXP_RLE_U64_U16                      = 178,
+	EXP_DICT_U16_FFOR_U16                = 179,
+	EXP_DICT_U16_FFOR_U08                = 180,
+	EXP_DICT_U32_FFOR_U32                = 181,
+	EXP_DICT_U32_FFOR_U16                = 182,
+	EXP_DICT_U32_FFOR_U08                = 183,
+	EXP_DICT_U64_FFOR_U32                = 184,
+	EXP_DICT_U64_FFOR_U16                = 185,
+	EXP_DICT_U64_FFOR_U08                = 186,
+	EXP_DICT_U16_U16                     = 187,
+	EXP_DICT_U16_U08                     = 188,
+	EXP_DICT_U32_U32                     = 189,
+	EXP_DICT_U32_U16                     = 190,
+	EXP_DICT_U32_U08                     = 191,
+	EXP_DICT_U64_U32                     = 192,
+	EXP_DICT_U64_U16                     = 193,
+	EXP_DICT_U64_U08                     = 194,
+	EXP_GLOBAL_DICT_STR_FFOR_U32         = 195,
+	EXP_GLOBAL_DICT_STR_FFOR_U16         = 196,
+	EXP_GLOBAL_DICT_STR_FFOR_U08         = 197,
+	EXP_SHARED_FSST_DELTA                = 198,
+	EXP_SHARED_FSST12_DELTA              = 199
 };
 
-inline const OperatorToken (&EnumValuesOperatorToken())[157] {
+inline const OperatorToken (&EnumValuesOperatorToken())[200] {
 	static const OperatorToken values[] = {OperatorToken::INVALID,
 	                                       OperatorToken::EXP_EQUAL,
 	                                       OperatorToken::EXP_CONSTANT_I64,
@@ -336,12 +379,55 @@ inline const OperatorToken (&EnumValuesOperatorToken())[157] {
 	                                       OperatorToken::EXP_DELTA_U08,
 	                                       OperatorToken::EXP_RLE_U08_U16,
 	                                       OperatorToken::EXP_GALP_FLT,
-	                                       OperatorToken::EXP_GALP_DBL};
+	                                       OperatorToken::EXP_GALP_DBL,
+	                                       OperatorToken::EXP_DELTA2_I64,
+	                                       OperatorToken::EXP_DELTA2_I32,
+	                                       OperatorToken::EXP_DELTA2_I16,
+	                                       OperatorToken::EXP_BOOLEAN,
+	                                       OperatorToken::EXP_UNCOMPRESSED_U16,
+	                                       OperatorToken::EXP_CONSTANT_U16,
+	                                       OperatorToken::EXP_FFOR_U16,
+	                                       OperatorToken::EXP_FFOR_SLPATCH_U16,
+	                                       OperatorToken::EXP_DELTA_U16,
+	                                       OperatorToken::EXP_RLE_U16_U16,
+	                                       OperatorToken::EXP_UNCOMPRESSED_U32,
+	                                       OperatorToken::EXP_CONSTANT_U32,
+	                                       OperatorToken::EXP_FFOR_U32,
+	                                       OperatorToken::EXP_FFOR_SLPATCH_U32,
+	                                       OperatorToken::EXP_DELTA_U32,
+	                                       OperatorToken::EXP_RLE_U32_U16,
+	                                       OperatorToken::EXP_UNCOMPRESSED_U64,
+	                                       OperatorToken::EXP_CONSTANT_U64,
+	                                       OperatorToken::EXP_FFOR_U64,
+	                                       OperatorToken::EXP_FFOR_SLPATCH_U64,
+	                                       OperatorToken::EXP_DELTA_U64,
+	                                       OperatorToken::EXP_RLE_U64_U16,
+	                                       OperatorToken::EXP_DICT_U16_FFOR_U16,
+	                                       OperatorToken::EXP_DICT_U16_FFOR_U08,
+	                                       OperatorToken::EXP_DICT_U32_FFOR_U32,
+	                                       OperatorToken::EXP_DICT_U32_FFOR_U16,
+	                                       OperatorToken::EXP_DICT_U32_FFOR_U08,
+	                                       OperatorToken::EXP_DICT_U64_FFOR_U32,
+	                                       OperatorToken::EXP_DICT_U64_FFOR_U16,
+	                                       OperatorToken::EXP_DICT_U64_FFOR_U08,
+	                                       OperatorToken::EXP_DICT_U16_U16,
+	                                       OperatorToken::EXP_DICT_U16_U08,
+	                                       OperatorToken::EXP_DICT_U32_U32,
+	                                       OperatorToken::EXP_DICT_U32_U16,
+	                                       OperatorToken::EXP_DICT_U32_U08,
+	                                       OperatorToken::EXP_DICT_U64_U32,
+	                                       OperatorToken::EXP_DICT_U64_U16,
+	                                       OperatorToken::EXP_DICT_U64_U08,
+	                                       OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U32,
+	                                       OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U16,
+	                                       OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U08,
+	                                       OperatorToken::EXP_SHARED_FSST_DELTA,
+	                                       OperatorToken::EXP_SHARED_FSST12_DELTA};
 	return values;
 }
 
 inline const char* const* EnumNamesOperatorToken() {
-	static const char* const names[158] = {"INVALID",
+	static const char* const names[201] = {"INVALID",
 	                                       "EXP_EQUAL",
 	                                       "EXP_CONSTANT_I64",
 	                                       "EXP_CONSTANT_I32",
@@ -498,12 +584,55 @@ inline const char* const* EnumNamesOperatorToken() {
 	                                       "EXP_RLE_U08_U16",
 	                                       "EXP_GALP_FLT",
 	                                       "EXP_GALP_DBL",
+	                                       "EXP_DELTA2_I64",
+	                                       "EXP_DELTA2_I32",
+	                                       "EXP_DELTA2_I16",
+	                                       "EXP_BOOLEAN",
+	                                       "EXP_UNCOMPRESSED_U16",
+	                                       "EXP_CONSTANT_U16",
+	                                       "EXP_FFOR_U16",
+	                                       "EXP_FFOR_SLPATCH_U16",
+	                                       "EXP_DELTA_U16",
+	                                       "EXP_RLE_U16_U16",
+	                                       "EXP_UNCOMPRESSED_U32",
+	                                       "EXP_CONSTANT_U32",
+	                                       "EXP_FFOR_U32",
+	                                       "EXP_FFOR_SLPATCH_U32",
+	                                       "EXP_DELTA_U32",
+	                                       "EXP_RLE_U32_U16",
+	                                       "EXP_UNCOMPRESSED_U64",
+	                                       "EXP_CONSTANT_U64",
+	                                       "EXP_FFOR_U64",
+	                                       "EXP_FFOR_SLPATCH_U64",
+	                                       "EXP_DELTA_U64",
+	                                       "EXP_RLE_U64_U16",
+	                                       "EXP_DICT_U16_FFOR_U16",
+	                                       "EXP_DICT_U16_FFOR_U08",
+	                                       "EXP_DICT_U32_FFOR_U32",
+	                                       "EXP_DICT_U32_FFOR_U16",
+	                                       "EXP_DICT_U32_FFOR_U08",
+	                                       "EXP_DICT_U64_FFOR_U32",
+	                                       "EXP_DICT_U64_FFOR_U16",
+	                                       "EXP_DICT_U64_FFOR_U08",
+	                                       "EXP_DICT_U16_U16",
+	                                       "EXP_DICT_U16_U08",
+	                                       "EXP_DICT_U32_U32",
+	                                       "EXP_DICT_U32_U16",
+	                                       "EXP_DICT_U32_U08",
+	                                       "EXP_DICT_U64_U32",
+	                                       "EXP_DICT_U64_U16",
+	                                       "EXP_DICT_U64_U08",
+	                                       "EXP_GLOBAL_DICT_STR_FFOR_U32",
+	                                       "EXP_GLOBAL_DICT_STR_FFOR_U16",
+	                                       "EXP_GLOBAL_DICT_STR_FFOR_U08",
+	                                       "EXP_SHARED_FSST_DELTA",
+	                                       "EXP_SHARED_FSST12_DELTA",
 	                                       nullptr};
 	return names;
 }
 
 inline const char* EnumNameOperatorToken(OperatorToken e) {
-	if (::flatbuffers::IsOutRange(e, OperatorToken::INVALID, OperatorToken::EXP_GALP_DBL))
+	if (::flatbuffers::IsOutRange(e, OperatorToken::INVALID, OperatorToken::EXP_SHARED_FSST12_DELTA))
 		return "";
 	const size_t index = static_cast<size_t>(e);
 	return EnumNamesOperatorToken()[index];
@@ -41,6 +41,8 @@ public:
 	static void write(const path& file_path, const string& dump);
 	/// append to file_path
 	static void append(const path& file_path, const string& dump);
+	/// canonical path, size and modification time: changes whenever the file is rewritten.
+	static string identity(const path& file_path);
 
 private:
 	path              m_path;
@@ -8,6 +8,8 @@
 
 #include "fls/common/alias.hpp"
 #include "fls/cor/prm/fsst/fsst.h"
+#include "fls/std/vector.hpp"
+#include <cstdint>
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -29,6 +31,10 @@ public:
 	    unsigned char*  output,     /* OUT: memory buffer to put the compressed strings in (one after the other). */
 	    ofs_t*          out_offsets /* OUT: output string start pointers. Will all point into [output,output+size). */
 	);
+
+	///! the buffer one string is decompressed into, CFG::String::max_bytes_per_string bytes. shared by every fsst and
+	///! fsst12 decoder of the calling thread, so building a decoder per rowgroup does not allocate it again.
+	static vector<uint8_t>& decode_scratch();
 };
 
 } // namespace fastlanes
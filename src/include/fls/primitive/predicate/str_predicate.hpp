@@ -0,0 +1,89 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/primitive/predicate/str_predicate.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_PRIMITIVE_PREDICATE_STR_PREDICATE_HPP
+#define FLS_PRIMITIVE_PREDICATE_STR_PREDICATE_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/cor/prm/fsst/fsst.h"
+#include "fls/cor/prm/fsst12/fsst12.h"
+#include "fls/std/string.hpp"
+#include "fls/std/vector.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * StrPredicate
+\*--------------------------------------------------------------------------------------------------------------------*/
+enum class StrPredicateT : uint8_t {
+	EQUAL    = 0, // value == pattern
+	PREFIX   = 1, // value LIKE 'pattern%'
+	CONTAINS = 2, // value LIKE '%pattern%'
+};
+
+struct StrPredicate {
+	StrPredicateT type;
+	string        pattern;
+
+	bool operator==(const StrPredicate& other) const = default;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * FsstMatcher
+\*--------------------------------------------------------------------------------------------------------------------*/
+// A string predicate compiled against one FSST symbol table. The pattern becomes a byte-level automaton (KMP for
+// CONTAINS); every symbol of the table is then run through it once, so a compressed string is matched with one
+// table lookup per code and never decompressed.
+template <typename DECODER_T>
+class FsstMatcher {
+public:
+	using state_t = uint16_t;
+	///! fsst: 255 codes plus the escape; fsst12: 4096 codes and no escape.
+	static constexpr n_t N_CODES = std::is_same_v<DECODER_T, fsst_decoder_t> ? 256 : 4096;
+
+public:
+	explicit FsstMatcher(const DECODER_T& decoder, const StrPredicate& predicate);
+
+public:
+	///! matches one compressed string of `n_bytes` bytes.
+	[[nodiscard]] bool Match(const uint8_t* in, n_t n_bytes) const;
+	///!
+	[[nodiscard]] const StrPredicate& GetPredicate() const;
+
+private:
+	[[nodiscard]] bool IsFinal(state_t state) const;
+
+private:
+	StrPredicate    m_predicate;
+	state_t         m_accept_state;
+	state_t         m_dead_state;
+	vector<state_t> m_byte_transition_arr;
+	vector<state_t> m_code_transition_arr;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * DictionaryMatcher
+\*--------------------------------------------------------------------------------------------------------------------*/
+// A string predicate evaluated once per entry of a plain dictionary, laid out as end offsets and bytes. The values
+// are then matched through their dictionary index; the entries are evaluated again only when the predicate changes.
+class DictionaryMatcher {
+public:
+	///! `result[i]` is 1 if entry i of the `n_entries` entries satisfies `predicate`.
+	const vector<uint8_t>&
+	Match(const StrPredicate& predicate, const ofs_t* offsets, const uint8_t* bytes, n_t n_entries);
+
+public:
+	///! whether the `n_bytes` bytes at `in` satisfy `predicate`.
+	[[nodiscard]] static bool Matches(const StrPredicate& predicate, const uint8_t* in, n_t n_bytes);
+
+private:
+	up<StrPredicate> m_predicate;
+	vector<uint8_t>  m_entry_match_arr;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_PRIMITIVE_PREDICATE_STR_PREDICATE_HPP
@@ -0,0 +1,46 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/reader/global_dictionary_view.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_READER_GLOBAL_DICTIONARY_VIEW_HPP
+#define FLS_READER_GLOBAL_DICTIONARY_VIEW_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/primitive/predicate/str_predicate.hpp"
+#include "fls/std/vector.hpp"
+#include <cstdint>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class Buf;
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * GlobalDictionaryView
+\*--------------------------------------------------------------------------------------------------------------------*/
+// A dictionary shared by the rowgroups of a file, as read back; see GlobalDictionary for its layout. A reader keeps it
+// across the rowgroups it is reset to, so it is read once and stays in cache, and a string predicate is evaluated on
+// its entries once for all of them.
+class GlobalDictionaryView {
+public:
+	///! `buf` holds the `size` bytes of the dictionary.
+	explicit GlobalDictionaryView(sp<const Buf> buf, n_t size);
+
+public:
+	///!
+	[[nodiscard]] n_t Cardinality() const;
+	///! the end offset of every entry.
+	[[nodiscard]] const ofs_t* Offsets() const;
+	///!
+	[[nodiscard]] const uint8_t* Bytes() const;
+	///! `result[i]` is 1 if entry i satisfies `predicate`.
+	const vector<uint8_t>& Match(const StrPredicate& predicate);
+
+private:
+	sp<const Buf>     m_buf;
+	n_t               m_cardinality;
+	DictionaryMatcher m_matcher;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_READER_GLOBAL_DICTIONARY_VIEW_HPP
@@ -0,0 +1,74 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/reader/rowgroup_cache.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_READER_ROWGROUP_CACHE_HPP
+#define FLS_READER_ROWGROUP_CACHE_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/string.hpp"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class Buf;
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RowgroupCache
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The raw bytes of recently read rowgroups, keyed by File::identity and rowgroup offset, shared by every reader of the
+// connections that enable it. A hit skips the disk read; entries are evicted least recently used first to stay within
+// the byte budget. Readers hold their entry by a shared pointer, so an evicted rowgroup stays valid while in use.
+class RowgroupCache {
+public:
+	explicit RowgroupCache(n_t budget);
+	RowgroupCache(const RowgroupCache&)            = delete;
+	RowgroupCache& operator=(const RowgroupCache&) = delete;
+
+public:
+	///! the cached rowgroup at byte `offset` of the file, or nullptr.
+	[[nodiscard]] sp<const Buf> Get(const string& file_identity, n_t offset);
+	///! caches the `n_bytes` bytes of the rowgroup at byte `offset` of the file. a rowgroup larger than the whole
+	///! budget is not cached.
+	void Put(const string& file_identity, n_t offset, sp<const Buf> buf, n_t n_bytes);
+	///! drops all entries.
+	void Clear();
+	///
+	[[nodiscard]] n_t CachedBytes() const;
+	///
+	[[nodiscard]] n_t Budget() const;
+	///! a smaller budget evicts right away.
+	void SetBudget(n_t budget);
+	///
+	[[nodiscard]] n_t Hits() const;
+	///
+	[[nodiscard]] n_t Misses() const;
+	///! the cache shared by all connections of the process.
+	static RowgroupCache& Global();
+
+private:
+	struct Entry {
+		string        key;
+		sp<const Buf> buf;
+		n_t           n_bytes;
+	};
+
+	static string Key(const string& file_identity, n_t offset);
+	void          Evict(n_t budget);
+
+private:
+	mutable std::mutex                                    m_mutex;
+	n_t                                                   m_budget;
+	n_t                                                   m_cached_bytes;
+	n_t                                                   m_hits;
+	n_t                                                   m_misses;
+	std::list<Entry>                                      m_lru; // most recently used first
+	std::unordered_map<string, std::list<Entry>::iterator> m_entries;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_READER_ROWGROUP_CACHE_HPP
@@ -8,26 +8,83 @@
 
 #include "fls/common/alias.hpp"                   // for up, n_t
 #include "fls/cor/lyt/buf.hpp"                    // for Buf
+#include "fls/cor/prm/fsst/fsst.h"                // for fsst_decoder_t
+#include "fls/cor/prm/fsst12/fsst12.h"            // for fsst12_decoder_t
 #include "fls/expression/physical_expression.hpp" // for PhysicalExpr
-#include "fls/reader/rowgroup_reader.hpp"
-#include "fls/std/filesystem.hpp" // for path
-#include "fls/std/vector.hpp"     // for vector
-#include "fls/table/chunk.hpp"    // for Chunk
+#include "fls/io/io.hpp"                          // for io
+#include "fls/std/filesystem.hpp"                 // for path
+#include "fls/std/span.hpp"                       // for span
+#include "fls/std/string.hpp"                     // for string
+#include "fls/std/unordered_map.hpp"              // for unordered_map
+#include "fls/std/vector.hpp"                     // for vector
+#include "fls/table/chunk.hpp"                    // for Chunk
+#include <cstddef>                                // for std::byte
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
 class Connection;
 class RowgroupView;
 class Rowgroup;
+class SelectionDS;
+class Aggregate;
+class GlobalDictionaryView;
+template <typename DECODER_T>
+class SymbolTableView;
+struct StrPredicate;
+struct TableDescriptor;
 /*--------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * GatheredColumn
+\*--------------------------------------------------------------------------------------------------------------------*/
+class GatheredColumn {
+public:
+	///! the selected values, compacted, in the physical type of the column.
+	alignas(64) std::byte data[CFG::VEC_SZ * sizeof(u64_pt)];
+	///! false if the encoding has no gather path; the column expression then holds the whole decoded vector.
+	bool is_gathered {false};
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RowgroupReader
+\*--------------------------------------------------------------------------------------------------------------------*/
 class RowgroupReader {
 public:
 	explicit RowgroupReader(const path& file_path, const RowgroupDescriptor& rowgroup_descriptor, Connection& fls);
+	///! a reader of rowgroup `rowgroup_idx` that can be re-targeted to any other rowgroup of the table with reset.
+	explicit RowgroupReader(const path&            file_path,
+	                        const TableDescriptor& table_descriptor,
+	                        n_t                    rowgroup_idx,
+	                        Connection&            fls);
+	///! gives the bytes of its operators back to the connection; the buffer gives back its own.
+	~RowgroupReader();
 
 public:
 	vector<sp<PhysicalExpr>>& get_chunk(n_t vec_idx);
+	///! decodes only the rows at `selected_idxs` (ascending) of vector `vec_idx`.
+	///! returns false, without touching any segment, if no row is selected.
+	bool gather_chunk(n_t vec_idx, span<const vec_idx_t> selected_idxs);
+	///
+	bool gather_chunk(n_t vec_idx, SelectionDS& selection);
 	///
-	void reset();
+	[[nodiscard]] const GatheredColumn& get_gathered_column(n_t col_idx) const;
+	///! evaluates `predicate` on column `col_idx` of vector `vec_idx` without decompressing the strings.
+	///! returns false if the column is neither fsst-compressed nor dictionary-encoded; the caller then has to decode
+	///! and compare. if the bloom filter of the column rules the predicate out, nothing is selected for any encoding.
+	bool filter_chunk(n_t vec_idx, n_t col_idx, const StrPredicate& predicate, SelectionDS& selection);
+	///! false only if no row of the rowgroup satisfies `predicate` on column `col_idx`. answered from the bloom
+	///! filter of the column for equality predicates; the other predicates and columns without one may always match.
+	[[nodiscard]] bool may_match(n_t col_idx, const StrPredicate& predicate) const;
+	///! selects the rows of vector `vec_idx` where the boolean column `col_idx` is true, straight from its bitmap.
+	///! returns false if the column is not bit-packed as booleans; the caller then has to decode and compare.
+	bool select_chunk(n_t vec_idx, n_t col_idx, SelectionDS& selection);
+	///! folds column `col_idx` into `aggregate`. returns true if it was answered from the compressed segments,
+	///! false if the column had to be decoded; the other columns are never decoded.
+	bool aggregate(n_t col_idx, Aggregate& aggregate);
+	///! re-targets the reader to rowgroup `rowgroup_idx` of its table. the open file and the read buffer are kept,
+	///! so a scan over many rowgroups reads them all through one reader.
+	void reset(n_t rowgroup_idx);
+	///! re-targets the reader to `rowgroup_descriptor`, which has to be a rowgroup of the same file.
+	void reset(const RowgroupDescriptor& rowgroup_descriptor);
 	///!
 	up<Rowgroup> materialize();
 	///
@@ -38,15 +95,44 @@ public:
 	[[nodiscard]] vector<string> get_column_names() const;
 	///
 	[[nodiscard]] vector<DataType> get_data_types() const;
+	///! the dictionary of `size` bytes at `offset` that the rowgroups of the file share. it is read once, through the
+	///! rowgroup cache if it is enabled, and kept across resets.
+	GlobalDictionaryView& get_global_dictionary(n_t offset, n_t size);
+	///! the FSST or FSST12 symbol table of `size` bytes at `offset` that rowgroups of the file share. it is imported
+	///! once and kept across resets.
+	template <typename DECODER_T>
+	SymbolTableView<DECODER_T>& get_symbol_table(n_t offset, n_t size);
 
 public:
 	vector<sp<PhysicalExpr>> m_expressions;
 
+private:
+	///! reads the current rowgroup into the buffer and builds the expressions of its columns.
+	void Read();
+	///! reads the `size` bytes at `offset` that rowgroups of the file share, through the rowgroup cache if enabled.
+	sp<const Buf> ReadShared(n_t offset, n_t size);
+	///! the values of vector `vec_idx`, without the padding that fills up the last vector of the rowgroup.
+	[[nodiscard]] n_t value_count(n_t vec_idx) const;
+
 private:
 	Connection&               m_connection;
-	const RowgroupDescriptor& m_rowgroup_descriptor;
-	up<Buf>                   m_buf;
+	const RowgroupDescriptor* m_rowgroup_descriptor;
+	const TableDescriptor*    m_table_descriptor;
+	const path                m_file_path;
+	io                        m_io;
+	up<Buf>                   m_buf;        // unused when the rowgroups come from the rowgroup cache
+	sp<const Buf>             m_cached_buf; // the current rowgroup, if it comes from the rowgroup cache
+	string                    m_file_identity;
 	up<RowgroupView>          m_rowgroup_view;
+	vector<GatheredColumn>    m_gathered_columns;
+	n_t                       m_n_operator_bytes;      // accounted in the memory tracker of the connection
+	n_t                       m_n_cached_bytes;        // m_cached_buf, accounted the same way
+	n_t                       m_n_cached_shared_bytes; // what ReadShared took from the rowgroup cache, the same
+
+	// what the rowgroups of the file share, by offset in the file.
+	unordered_map<n_t, up<GlobalDictionaryView>>              m_global_dictionaries;
+	unordered_map<n_t, up<SymbolTableView<fsst_decoder_t>>>   m_fsst_symbol_tables;
+	unordered_map<n_t, up<SymbolTableView<fsst12_decoder_t>>> m_fsst12_symbol_tables;
 };
 
 } // namespace fastlanes
@@ -0,0 +1,82 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/reader/scan_scheduler.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_READER_SCAN_SCHEDULER_HPP
+#define FLS_READER_SCAN_SCHEDULER_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/string.hpp"
+#include "fls/std/vector.hpp"
+#include <functional>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * NumaTopology
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The NUMA nodes of the machine and their cpus, read from /sys/devices/system/node. Machines without it, and all
+// non-Linux ones, are a single node whose cpu list is empty: nothing is pinned there.
+class NumaTopology {
+public:
+	///! the topology of this machine, read once.
+	static const NumaTopology& Get();
+	///! parses a sysfs cpu list such as "0-3,8,10-11".
+	static vector<int> ParseCpuList(const string& cpu_list);
+
+public:
+	///
+	[[nodiscard]] n_t NodeCount() const;
+	///
+	[[nodiscard]] const vector<int>& Cpus(n_t node) const;
+
+public:
+	vector<vector<int>> m_cpus_per_node;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * ScanScheduler
+\*--------------------------------------------------------------------------------------------------------------------*/
+// Runs the morsels of a scan, typically one rowgroup each, on workers spread over the NUMA nodes. Every worker is
+// pinned to the cpus of its node and allocates its Bufs from the BufPool of that node, so read buffers and decode
+// scratch are first touched, and therefore placed, node-locally. The morsels are split into one contiguous range per
+// node; a worker takes morsels of its own node and only steals from another node once its own range is drained.
+class ScanScheduler {
+public:
+	using task_t = std::function<void(n_t worker_idx, n_t morsel_idx)>;
+
+public:
+	explicit ScanScheduler(n_t n_workers);
+
+public:
+	///! calls `task` once for every morsel in [0, n_morsels) and returns when all are done. a worker runs its morsels
+	///! one after the other, so state indexed by `worker_idx` is never shared. the first exception thrown by a task
+	///! stops the remaining morsels and is rethrown.
+	void Run(n_t n_morsels, const task_t& task);
+	///
+	[[nodiscard]] n_t WorkerCount() const;
+	///! the node worker `worker_idx` runs on.
+	[[nodiscard]] n_t WorkerNode(n_t worker_idx) const;
+	///! the node whose workers take morsel `morsel_idx` first.
+	[[nodiscard]] n_t MorselNode(n_t morsel_idx, n_t n_morsels) const;
+	///! morsels run by a worker of another node during the last Run.
+	[[nodiscard]] n_t StolenMorsels() const;
+
+private:
+	const NumaTopology& m_topology;
+	const n_t           m_n_workers;
+	///! the nodes that have at least one worker.
+	const n_t m_n_nodes;
+	n_t       m_n_stolen_morsels;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * ParallelFor
+\*--------------------------------------------------------------------------------------------------------------------*/
+///! runs task(idx) for every idx in [0, n) on at most `n_threads` workers of a ScanScheduler, or inline when there is a
+///! single thread or a single index. the first exception thrown by a task is rethrown.
+void ParallelFor(n_t n_threads, n_t n, const std::function<void(n_t idx)>& task);
+
+} // namespace fastlanes
+
+#endif // FLS_READER_SCAN_SCHEDULER_HPP
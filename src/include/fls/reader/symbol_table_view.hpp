@@ -0,0 +1,39 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/reader/symbol_table_view.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_READER_SYMBOL_TABLE_VIEW_HPP
+#define FLS_READER_SYMBOL_TABLE_VIEW_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/primitive/predicate/str_predicate.hpp"
+#include <cstdint>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * SymbolTableView
+\*--------------------------------------------------------------------------------------------------------------------*/
+// An FSST or FSST12 symbol table shared by rowgroups of a file, as read back; see SharedSymbolTable. A reader imports
+// it once and keeps it across the rowgroups it is reset to, together with the last string predicate compiled against
+// it, so neither is done again per rowgroup.
+template <typename DECODER_T>
+class SymbolTableView {
+public:
+	///! imports the table from the `size` bytes at `header`.
+	explicit SymbolTableView(const uint8_t* header, n_t size);
+
+public:
+	///!
+	DECODER_T& Decoder();
+	///! `predicate` compiled against the table; compiled again only when the predicate changes.
+	const FsstMatcher<DECODER_T>& Matcher(const StrPredicate& predicate);
+
+private:
+	DECODER_T                  m_decoder;
+	up<FsstMatcher<DECODER_T>> m_matcher;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_READER_SYMBOL_TABLE_VIEW_HPP
@@ -8,12 +8,18 @@
 
 #include "fls/api/api.hpp"
 #include "fls/common/alias.hpp"
+#include "fls/encoder/random_accessor.hpp"
+#include "fls/expression/aggregate.hpp"
 #include "fls/std/filesystem.hpp"
+#include "fls/std/span.hpp"
 #include "fls/std/string.hpp"
+#include "fls/std/vector.hpp"
+#include <deque>
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
 class Connection;
+class Rowgroup;
 class RowgroupReader;
 class TableDescriptorHandle;
 class Table;
@@ -28,6 +34,26 @@ public:
 	[[nodiscard]] up<RowgroupReader> get_rowgroup_reader(n_t rowgroup_idx) const;
 	//
 	[[nodiscard]] up<Table> materialize() const;
+	//
+	[[nodiscard]] n_t get_n_rowgroups() const;
+	//
+	[[nodiscard]] n_t get_n_tuples() const;
+	// API: false only if the column of this rowgroup definitely does not contain the value.
+	// answered from the footer alone; rowgroups written without a bloom filter always may contain it.
+	template <typename PT>
+	[[nodiscard]] bool may_contain(n_t rowgroup_idx, n_t col_idx, const PT& value) const;
+	// API: the rowgroups that have to be read to find the value in the column.
+	template <typename PT>
+	[[nodiscard]] vector<n_t> get_candidate_rowgroups(n_t col_idx, const PT& value) const;
+	// API: the value of column `col_idx` at row `row_id` of the table. only the vector holding the row is touched,
+	// and for most encodings only the row itself is decoded.
+	[[nodiscard]] fls_value_t get_value(n_t row_id, n_t col_idx);
+	// API: the values of columns `col_idxs` at rows `row_ids`, row-major: value j of row i is at
+	// [i * col_idxs.size() + j]. rows are grouped per vector, so nearby rows share one decode.
+	[[nodiscard]] vector<fls_value_t> get_rows(span<const n_t> row_ids, span<const n_t> col_idxs);
+	// API: SUM, COUNT, MIN or MAX of column `col_idx`, see Aggregate::Result for the result type. answered from the
+	// compressed segments where the encoding allows it (FFOR, constant, frequency, DICT, RLE), decoded otherwise.
+	[[nodiscard]] fls_value_t aggregate(n_t col_idx, AggregateT type) const;
 	// API: append to the existing csv.
 	// write to the fle path
 	void to_csv(const path& file_path) const;
@@ -35,9 +61,22 @@ public:
 	void to_csv(const char* file_path) const;
 
 private:
-	up<TableDescriptorHandle> m_table_descriptor_handle;
-	Connection&               m_connection;
-	const path                m_file_path;
+	RandomAccessor& get_random_accessor(n_t rowgroup_idx);
+	void            evict_oldest_random_accessor();
+	// re-targets `rowgroup_reader` to the rowgroup, or creates it, and materializes the rowgroup. under a memory
+	// budget, a reader that cannot grow for the rowgroup is dropped and created again.
+	[[nodiscard]] up<Rowgroup> materialize_rowgroup(up<RowgroupReader>& rowgroup_reader, n_t rowgroup_idx) const;
+	// the rowgroup holding `row_id`, and the row index inside it.
+	[[nodiscard]] std::pair<n_t, n_t> locate_row(n_t row_id);
+
+private:
+	up<TableDescriptorHandle>  m_table_descriptor_handle;
+	Connection&                m_connection;
+	const path                 m_file_path;
+	vector<n_t>                m_rowgroup_first_row_ids;
+	vector<up<RandomAccessor>> m_random_accessors;
+	///! the rowgroups with an accessor, oldest first; evicted in this order under a memory budget.
+	std::deque<n_t> m_random_accessor_order;
 };
 
 } // namespace fastlanes
@@ -0,0 +1,57 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/table/global_dictionary.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_TABLE_GLOBAL_DICTIONARY_HPP
+#define FLS_TABLE_GLOBAL_DICTIONARY_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/common/bimap.hpp"
+#include "fls/std/vector.hpp"
+#include "fls/table/rowgroup.hpp"
+#include <cstdint>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class Table;
+class Buf;
+enum class OperatorToken : uint16_t;
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * GlobalDictionary
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The distinct values of one string column over all the rowgroups of a table. It is stored once in the file, ahead of
+// the rowgroups, and the rowgroups of the column keep only their codes into it, so a code means the same value in
+// every rowgroup. It is laid out as the number of values, their end offsets and then their bytes.
+class GlobalDictionary {
+public:
+	GlobalDictionary();
+
+public:
+	///! the union of the dictionaries of column `col_idx` in all rowgroups, in order of first appearance. nullptr if
+	///! the column does not hold strings, if the union exceeds CFG::GlobalDictionary::MAX_SIZE, or if it is not
+	///! smaller than the rowgroup dictionaries together.
+	[[nodiscard]] static sp<GlobalDictionary> Build(const Table& table, n_t col_idx);
+	///! the dictionaries shared by the rowgroups of `table`, once each.
+	[[nodiscard]] static vector<sp<GlobalDictionary>> Collect(const Table& table);
+	///! the dictionary `column` shares with the other rowgroups; throws if it has none.
+	[[nodiscard]] static const GlobalDictionary& Of(const col_pt& column);
+
+public:
+	///! the encoding of the rowgroups that refer to it: the smallest index type that holds all its codes.
+	[[nodiscard]] OperatorToken Token() const;
+	///! the bytes it takes in the file.
+	[[nodiscard]] n_t Size() const;
+	///!
+	void Write(Buf& buf) const;
+
+public:
+	BiMapFrequencyStr bimap;
+	n_t               n_value_bytes;
+	///! where it is stored in the file; set by the encoder before the rowgroups refer to it.
+	n_t offset;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_TABLE_GLOBAL_DICTIONARY_HPP
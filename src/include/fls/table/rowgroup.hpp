@@ -205,6 +205,8 @@ public:
 
 public:
 	explicit Rowgroup(const RowgroupDescriptorT& rowgroup_footer, const Connection& connection);
+	///! takes over the descriptor instead of copying it.
+	explicit Rowgroup(RowgroupDescriptorT&& rowgroup_footer, const Connection& connection);
 
 	Rowgroup(const Rowgroup&)             = delete;
 	Rowgroup& operator=(const Rowgroup&)  = delete;
@@ -230,13 +232,14 @@ public:
 	[[nodiscard]] DataType GetDataType(idx_t col_idx) const;
 	///
 	[[nodiscard]] RowgroupDescriptor& GetRowgroupDescriptor();
-	///
+	///! the columns at `idxs`, in that order. their data and descriptors are moved, not copied, so this rowgroup
+	///! must not be used afterwards.
 	[[nodiscard]] up<Rowgroup> Project(const vector<idx_t>& idxs, const Connection& connection);
 	///
 	[[nodiscard]] up<Rowgroup> Project(const vector<string>& idxs, const Connection& connection);
-	///
+	///! gathers the statistics Attribute::Ingest keeps, for rowgroups filled otherwise. call after Finalize.
 	void GetStatistics();
-	///
+	///! builds the string pointers and the exact dictionaries in one pass over each column.
 	void Finalize();
 	///
 	void Cast();
@@ -244,13 +247,18 @@ public:
 	void Init();
 	///
 	void FillMissingValues(n_t how_many_to_fill);
+	///! the bytes its columns hold in memory.
+	[[nodiscard]] n_t MemorySize() const;
+	///! sets the capacity from the width of the `n_ingested_tuples` rows ingested so far, so the rowgroup fits the
+	///! byte budget of the connection. keeps it if the connection has none.
+	void FitCapacity(n_t n_ingested_tuples);
 
 public: /* Members */
 	RowgroupDescriptorT m_descriptor;
 	n_t                 n_tup;
 	rowgroup_pt         internal_rowgroup;
 	const Connection&   m_connection;
-	const n_t           capacity;
+	n_t                 capacity;
 };
 
 std::ostream& operator<<(std::ostream& output, const Rowgroup& mini_arrow);
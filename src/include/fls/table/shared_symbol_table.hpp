@@ -0,0 +1,68 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/table/shared_symbol_table.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_TABLE_SHARED_SYMBOL_TABLE_HPP
+#define FLS_TABLE_SHARED_SYMBOL_TABLE_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/cor/prm/fsst/fsst.h"
+#include "fls/cor/prm/fsst12/fsst12.h"
+#include "fls/std/vector.hpp"
+#include "fls/table/rowgroup.hpp"
+#include <cstdint>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class Table;
+class Buf;
+enum class OperatorToken : uint16_t;
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * SharedSymbolTable
+\*--------------------------------------------------------------------------------------------------------------------*/
+// An FSST or FSST12 symbol table trained once for a string column and used by several of its rowgroups, so it is
+// trained once and stored once in the file, ahead of the rowgroups, in the format of fsst_export or fsst12_export.
+class SharedSymbolTable {
+public:
+	///! trains a table on the `n_strings` strings of the sample.
+	explicit SharedSymbolTable(bool is_fsst12, n_t n_strings, len_t* lengths, uint8_t** strings);
+	~SharedSymbolTable();
+
+	SharedSymbolTable(const SharedSymbolTable&)            = delete;
+	SharedSymbolTable& operator=(const SharedSymbolTable&) = delete;
+
+public:
+	///! gives the rowgroups of string column `col_idx` their tables: one trained on a sample of all rowgroups, and
+	///! a new one from every rowgroup the current one compresses CFG::SharedSymbolTable::MAX_DRIFT worse than the
+	///! sample it was trained on. false if the column does not hold strings.
+	static bool Assign(const Table& table, n_t col_idx, bool is_fsst12);
+	///! the tables shared by the rowgroups of `table`, once each, in order of first use.
+	[[nodiscard]] static vector<sp<SharedSymbolTable>> Collect(const Table& table);
+	///! the table `column` shares with other rowgroups; throws if it has none.
+	[[nodiscard]] static const SharedSymbolTable& Of(const col_pt& column);
+
+public:
+	///! the encoding of the rowgroups that use it.
+	[[nodiscard]] OperatorToken Token() const;
+	///! the bytes it takes in the file.
+	[[nodiscard]] n_t Size() const;
+	///!
+	void Write(Buf& buf) const;
+	///! the compressed bytes per input byte of the `n_strings` strings.
+	[[nodiscard]] double CompressionRatio(n_t n_strings, len_t* lengths, uint8_t** strings) const;
+
+public:
+	bool              is_fsst12;
+	fsst_encoder_t*   fsst_encoder;   // nullptr for fsst12
+	fsst12_encoder_t* fsst12_encoder; // nullptr for fsst
+	vector<uint8_t>   header;         // the exported table
+	///! the compression ratio of the sample it was trained on.
+	double sample_ratio;
+	///! where it is stored in the file; set by the encoder before the rowgroups refer to it.
+	n_t offset;
+};
+
+} // namespace fastlanes
+
+#endif // FLS_TABLE_SHARED_SYMBOL_TABLE_HPP
@@ -0,0 +1,20 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/table/sort_order.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_TABLE_SORT_ORDER_HPP
+#define FLS_TABLE_SORT_ORDER_HPP
+
+#include <cstdint>
+
+namespace fastlanes {
+///! the order RowgroupSorter clusters the rows of a rowgroup in.
+enum class SortOrder : uint8_t {
+	LEXICOGRAPHIC = 0, // by the first key, ties by the next one, and so on
+	Z_ORDER       = 1, // by the interleaved bits of all keys, so every key clusters about as well
+};
+
+} // namespace fastlanes
+
+#endif // FLS_TABLE_SORT_ORDER_HPP
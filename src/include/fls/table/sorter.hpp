@@ -0,0 +1,39 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/table/sorter.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_TABLE_SORTER_HPP
+#define FLS_TABLE_SORTER_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/vector.hpp"
+#include "fls/table/sort_order.hpp"
+#include <cstdint>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+class Rowgroup;
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RowgroupSorter
+\*--------------------------------------------------------------------------------------------------------------------*/
+// Clusters the rows of a rowgroup on some of its columns before they are encoded, so equal and close values end up
+// next to each other for the run-length and delta encodings. Every key is replaced by the dense ranks of its values
+// first, so both orders compare fixed-width integers whatever the type of the key; nulls rank lowest. The permutation
+// is then gathered into each column as a whole, one column per worker. Only the first n_tup rows move: the padding of
+// the last vector stays where it is.
+class RowgroupSorter {
+public:
+	///! sorts the rows of `rowgroup` on the columns `key_idxs` with `n_threads` workers. throws if a key is out of
+	///! range or is not a flat column, or if the rowgroup holds a list column.
+	static void Sort(Rowgroup& rowgroup, const vector<idx_t>& key_idxs, SortOrder order, n_t n_threads);
+	///! the row of `rowgroup` that goes to each position once it is sorted on `key_idxs`; equal rows keep their order.
+	[[nodiscard]] static vector<uint32_t>
+	Permutation(const Rowgroup& rowgroup, const vector<idx_t>& key_idxs, SortOrder order, n_t n_threads);
+};
+
+} // namespace fastlanes
+
+#endif // FLS_TABLE_SORTER_HPP
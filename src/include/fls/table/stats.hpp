@@ -9,6 +9,7 @@
 #include "fls/common/alias.hpp"
 #include "fls/common/bimap.hpp"
 #include "fls/common/bimap_frequency.hpp"
+#include "fls/common/hyperloglog.hpp"
 
 namespace fastlanes {
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -16,6 +17,8 @@ class Struct;
 class List;
 class Column;
 class Rowgroup;
+class GlobalDictionary;
+class SharedSymbolTable;
 template <typename PT>
 class TypedCol;
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -42,6 +45,12 @@ public:
 	n_t n_nulls;
 	///!
 	bool is_double_castable;
+	///! whether all values equal the first; kept while values are ingested.
+	bool is_constant;
+	///! runs of equal consecutive values; kept while values are ingested.
+	n_t n_runs;
+	///! the distinct values, estimated while they are ingested.
+	HyperLogLog sketch;
 };
 
 class FlsStringStats {
@@ -59,6 +68,14 @@ public:
 	BiMapFrequencyStr bimap;
 	///
 	string last_seen_val;
+	///! runs of equal consecutive values; kept while values are ingested.
+	n_t n_runs;
+	///! the distinct values, estimated while they are ingested.
+	HyperLogLog sketch;
+	///! the dictionary the column shares with the other rowgroups of its table, if the wizard chose one.
+	sp<GlobalDictionary> global_dictionary;
+	///! the FSST symbol table the column shares with other rowgroups of its table, if the wizard chose one.
+	sp<SharedSymbolTable> symbol_table;
 };
 
 } // namespace fastlanes
@@ -0,0 +1,37 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/wizard/decode_cost.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_WIZARD_DECODE_COST_HPP
+#define FLS_WIZARD_DECODE_COST_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/wizard/optimize_for.hpp"
+#include <cstdint>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+enum class OperatorToken : uint16_t;
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * DecodeCost
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The cost of scanning a column in a given encoding: the cycles to read its bytes plus the cycles to decode its
+// values. The decode throughput of every token is calibrated per encoding family, from the decoding benchmarks on a
+// recent x86-64 core; only the ratios between the families matter for choosing an encoding.
+class DecodeCost {
+public:
+	DecodeCost() = delete;
+
+public:
+	///! the cycles it takes to decode one value encoded with `token`.
+	[[nodiscard]] static double CyclesPerValue(OperatorToken token);
+	///! the estimated cycles to scan `n_values` values that take `size` bytes encoded with `token`.
+	[[nodiscard]] static double ScanCycles(OperatorToken token, n_t size, n_t n_values);
+};
+
+} // namespace fastlanes
+
+#endif // FLS_WIZARD_DECODE_COST_HPP
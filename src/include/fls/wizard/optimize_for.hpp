@@ -0,0 +1,21 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/wizard/optimize_for.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_WIZARD_OPTIMIZE_FOR_HPP
+#define FLS_WIZARD_OPTIMIZE_FOR_HPP
+
+#include <cstdint>
+
+namespace fastlanes {
+///! what the wizard optimizes the encoding of a column for.
+enum class OptimizeFor : uint8_t {
+	SIZE     = 0, // the smallest encoding
+	BALANCED = 1, // the fastest to scan among the encodings close to the smallest
+	SPEED    = 2, // the fastest to scan
+};
+
+} // namespace fastlanes
+
+#endif // FLS_WIZARD_OPTIMIZE_FOR_HPP
@@ -0,0 +1,72 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/include/fls/wizard/schema_cache.hpp
+// ────────────────────────────────────────────────────────
+#ifndef FLS_WIZARD_SCHEMA_CACHE_HPP
+#define FLS_WIZARD_SCHEMA_CACHE_HPP
+
+#include "fls/common/alias.hpp"
+#include "fls/std/string.hpp"
+#include "fls/std/vector.hpp"
+#include <cstdint>
+#include <unordered_map>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*/
+enum class DataType : uint8_t;
+enum class OperatorToken : uint16_t;
+struct ColumnDescriptorT;
+struct RowgroupDescriptorT;
+struct TableDescriptorT;
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * SchemaCache
+\*--------------------------------------------------------------------------------------------------------------------*/
+// The encodings the wizard chose for the columns of the previous rowgroups, or of a file written before, keyed by
+// column name. The wizard tries a cached encoding first and keeps it if it is still a candidate for the column and
+// its size on a small sample stays within CFG::SchemaCache::MAX_SIZE_DRIFT; otherwise it searches the column again.
+class SchemaCache {
+public:
+	struct Decision {
+		DataType         data_type;
+		OperatorToken    operator_token;
+		vector<uint64_t> operand_tokens;
+		///! the size of the column encoded with `operator_token`, per value.
+		double bytes_per_value;
+	};
+
+public:
+	SchemaCache() = default;
+
+public:
+	///! the decision for the column, nullptr if there is none or it was made for another type.
+	[[nodiscard]] const Decision* Find(const string& name, DataType data_type) const;
+	///! replaces the decision for the column.
+	void Store(const string& name, Decision decision);
+	///! seeds the cache with the single-operator encodings of the last rowgroup of a table.
+	void Seed(const TableDescriptorT& table_descriptor);
+	///! drops all decisions.
+	void Clear();
+	///
+	[[nodiscard]] n_t Size() const;
+	///! counts a column that kept its cached encoding, or that was searched again.
+	void RecordHit();
+	void RecordMiss();
+	///
+	[[nodiscard]] n_t Hits() const;
+	///
+	[[nodiscard]] n_t Misses() const;
+
+private:
+	void Seed(const ColumnDescriptorT& column_descriptor, const RowgroupDescriptorT& rowgroup_descriptor);
+
+private:
+	std::unordered_map<string, Decision> m_decisions;
+	n_t                                  m_n_hits {0};
+	n_t                                  m_n_misses {0};
+};
+
+} // namespace fastlanes
+
+#endif // FLS_WIZARD_SCHEMA_CACHE_HPP
@@ -10,7 +10,7 @@
 #include "fls/std/filesystem.hpp"
 #include "fls/std/string.hpp"
 #include <cstdint>    // for int64_t
-#include <filesystem> // for std::filesystem::file_size, std::filesystem::exists
+#include <filesystem> // for std::filesystem::file_size, exists, last_write_time, weakly_canonical
 #include <fstream>    // for std::ifstream, std::ofstream
 #include <ios>        // for std::ios, std::streamoff, std::streamsize
 #include <memory>     // for std::make_unique
@@ -114,4 +114,11 @@ void File::append(const path& dir_path, const string& dump) {
 
 	FileSystem::close(file);
 }
+
+string File::identity(const path& file_path) {
+	const auto modification_time = std::filesystem::last_write_time(file_path).time_since_epoch().count();
+	return std::filesystem::weakly_canonical(file_path).string() + '|' +
+	       std::to_string(std::filesystem::file_size(file_path)) + '|' + std::to_string(modification_time);
+}
+
 } // namespace fastlanes
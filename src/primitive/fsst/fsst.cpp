@@ -154,6 +154,11 @@ _compressAuto(Encoder* e, size_t nstrings, u32 lenIn[], u8* strIn[], size_t size
 	return _compressImpl(e, nstrings, lenIn, strIn, size, output, out_offsets, noSuffixOpt, avoidBranch);
 }
 
+vector<uint8_t>& fsst_helper::decode_scratch() {
+	thread_local vector<uint8_t> scratch(CFG::String::max_bytes_per_string);
+	return scratch;
+}
+
 size_t fsst_helper::fsst_compress(fsst_encoder_t* encoder,
                                   size_t          nstrings,
                                   uint32_t        len_in[],
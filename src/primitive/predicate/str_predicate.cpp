@@ -0,0 +1,176 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/primitive/predicate/str_predicate.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/primitive/predicate/str_predicate.hpp"
+#include "fls/common/common.hpp"
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+namespace fastlanes {
+
+constexpr n_t N_BYTE_VALUES = 256;
+
+template <typename DECODER_T>
+FsstMatcher<DECODER_T>::FsstMatcher(const DECODER_T& decoder, const StrPredicate& predicate)
+    : m_predicate(predicate) {
+	const auto& pattern = m_predicate.pattern;
+	const n_t   m       = pattern.size();
+	if (m + 2 > std::numeric_limits<state_t>::max()) {
+		throw std::runtime_error("FsstMatcher: pattern of " + std::to_string(m) + " bytes is too long.");
+	}
+
+	// state i : the first i bytes of the pattern are matched.
+	m_accept_state     = static_cast<state_t>(m);
+	m_dead_state       = static_cast<state_t>(m + 1);
+	const n_t n_states = m + 2;
+
+	auto next_byte = [this](const n_t state, const uint8_t byte) -> state_t& {
+		return m_byte_transition_arr[state * N_BYTE_VALUES + byte];
+	};
+
+	/*----------------------------------------------------------------------------------------------------------------*\
+	 * byte automaton
+	\*----------------------------------------------------------------------------------------------------------------*/
+	m_byte_transition_arr.assign(n_states * N_BYTE_VALUES, m_dead_state);
+	switch (m_predicate.type) {
+	case StrPredicateT::EQUAL:
+	case StrPredicateT::PREFIX: {
+		for (n_t state {0}; state < m; ++state) {
+			next_byte(state, static_cast<uint8_t>(pattern[state])) = static_cast<state_t>(state + 1);
+		}
+		if (m_predicate.type == StrPredicateT::PREFIX) {
+			for (n_t byte {0}; byte < N_BYTE_VALUES; ++byte) {
+				next_byte(m_accept_state, static_cast<uint8_t>(byte)) = m_accept_state;
+			}
+		}
+		break;
+	}
+	case StrPredicateT::CONTAINS: {
+		// knuth-morris-pratt; `restart` is the state the automaton falls back to on a mismatch.
+		n_t restart {0};
+		for (n_t state {0}; state < m; ++state) {
+			for (n_t byte {0}; byte < N_BYTE_VALUES; ++byte) {
+				next_byte(state, static_cast<uint8_t>(byte)) =
+				    state == 0 ? 0 : next_byte(restart, static_cast<uint8_t>(byte));
+			}
+			const auto pattern_byte        = static_cast<uint8_t>(pattern[state]);
+			const auto restart_on_match    = next_byte(restart, pattern_byte);
+			next_byte(state, pattern_byte) = static_cast<state_t>(state + 1);
+			restart                        = state == 0 ? 0 : restart_on_match;
+		}
+		for (n_t byte {0}; byte < N_BYTE_VALUES; ++byte) {
+			next_byte(m_accept_state, static_cast<uint8_t>(byte)) = m_accept_state;
+		}
+		break;
+	}
+	default:
+		FLS_UNREACHABLE()
+	}
+
+	/*----------------------------------------------------------------------------------------------------------------*\
+	 * code automaton : every symbol of the table fed through the byte automaton
+	\*----------------------------------------------------------------------------------------------------------------*/
+	m_code_transition_arr.resize(n_states * N_CODES);
+	for (n_t state {0}; state < n_states; ++state) {
+		for (n_t code {0}; code < N_CODES; ++code) {
+			if constexpr (std::is_same_v<DECODER_T, fsst_decoder_t>) {
+				if (code == FSST_ESC) {
+					m_code_transition_arr[state * N_CODES + code] = m_dead_state;
+					continue;
+				}
+			}
+
+			auto       cur_state = static_cast<state_t>(state);
+			const auto symbol    = decoder.symbol[code];
+			for (n_t byte_idx {0}; byte_idx < decoder.len[code] && !IsFinal(cur_state); ++byte_idx) {
+				cur_state = next_byte(cur_state, static_cast<uint8_t>(symbol >> (8 * byte_idx)));
+			}
+			m_code_transition_arr[state * N_CODES + code] = cur_state;
+		}
+	}
+}
+
+template <typename DECODER_T>
+bool FsstMatcher<DECODER_T>::IsFinal(const state_t state) const {
+	return state == m_dead_state || (state == m_accept_state && m_predicate.type != StrPredicateT::EQUAL);
+}
+
+template <typename DECODER_T>
+bool FsstMatcher<DECODER_T>::Match(const uint8_t* in, const n_t n_bytes) const {
+	state_t state {0};
+	n_t     pos {0};
+
+	if constexpr (std::is_same_v<DECODER_T, fsst_decoder_t>) {
+		while (pos < n_bytes && !IsFinal(state)) {
+			const auto code = in[pos++];
+			if (code == FSST_ESC) {
+				state = m_byte_transition_arr[state * N_BYTE_VALUES + in[pos++]];
+			} else {
+				state = m_code_transition_arr[state * N_CODES + code];
+			}
+		}
+	} else {
+		// two 12-bit codes per 3 bytes; a trailing single code takes 2 bytes.
+		while (pos + 3 <= n_bytes && !IsFinal(state)) {
+			const uint32_t codes = in[pos] | (in[pos + 1] << 8) | (in[pos + 2] << 16);
+			pos += 3;
+			state = m_code_transition_arr[state * N_CODES + (codes & 4095)];
+			state = m_code_transition_arr[state * N_CODES + ((codes >> 12) & 4095)];
+		}
+		if (pos < n_bytes && !IsFinal(state)) {
+			const uint32_t code = (in[pos] | (in[pos + 1] << 8)) & 4095;
+			state               = m_code_transition_arr[state * N_CODES + code];
+		}
+	}
+
+	return state == m_accept_state;
+}
+
+template <typename DECODER_T>
+const StrPredicate& FsstMatcher<DECODER_T>::GetPredicate() const {
+	return m_predicate;
+}
+
+template class FsstMatcher<fsst_decoder_t>;
+template class FsstMatcher<fsst12_decoder_t>;
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * DictionaryMatcher
+\*--------------------------------------------------------------------------------------------------------------------*/
+const vector<uint8_t>& DictionaryMatcher::Match(const StrPredicate& predicate,
+                                                const ofs_t*        offsets,
+                                                const uint8_t*      bytes,
+                                                const n_t           n_entries) {
+	if (m_predicate != nullptr && *m_predicate == predicate && m_entry_match_arr.size() == n_entries) {
+		return m_entry_match_arr;
+	}
+
+	m_predicate = make_unique<StrPredicate>(predicate);
+	m_entry_match_arr.resize(n_entries);
+	ofs_t offset {0};
+	for (n_t entry_idx {0}; entry_idx < n_entries; ++entry_idx) {
+		const auto offset_next       = offsets[entry_idx];
+		m_entry_match_arr[entry_idx] = Matches(predicate, bytes + offset, offset_next - offset) ? 1 : 0;
+		offset                       = offset_next;
+	}
+	return m_entry_match_arr;
+}
+
+bool DictionaryMatcher::Matches(const StrPredicate& predicate, const uint8_t* in, const n_t n_bytes) {
+	const std::string_view value {reinterpret_cast<const char*>(in), n_bytes};
+	switch (predicate.type) {
+	case StrPredicateT::EQUAL:
+		return value == predicate.pattern;
+	case StrPredicateT::PREFIX:
+		return value.starts_with(predicate.pattern);
+	case StrPredicateT::CONTAINS:
+		return value.find(predicate.pattern) != std::string_view::npos;
+	default:
+		FLS_UNREACHABLE()
+	}
+}
+
+} // namespace fastlanes
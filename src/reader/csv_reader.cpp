@@ -78,6 +78,10 @@ up<Table> CsvReader::Read(const path& dir_path, const Connection& connection) {
 		}
 		n_tup = n_tup + 1;
 
+		// the first vector of a rowgroup tells how wide its rows are, and so how many of them fit the byte budget.
+		if (n_tup == CFG::VEC_SZ) {
+			cur_rowgroup->FitCapacity(n_tup);
+		}
 		if (n_tup == cur_rowgroup->capacity) {
 			cur_rowgroup->n_tup = n_tup;
 			table->m_rowgroups.push_back(std::move(cur_rowgroup));
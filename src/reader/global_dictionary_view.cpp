@@ -0,0 +1,49 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/reader/global_dictionary_view.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/reader/global_dictionary_view.hpp"
+#include "fls/cor/lyt/buf.hpp"
+#include <cstring>   // std::memcpy
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * GlobalDictionaryView
+\*--------------------------------------------------------------------------------------------------------------------*/
+GlobalDictionaryView::GlobalDictionaryView(sp<const Buf> buf, const n_t size)
+    : m_buf(std::move(buf))
+    , m_cardinality {0} {
+	if (size < sizeof(uint32_t)) {
+		throw std::runtime_error("GlobalDictionaryView: the dictionary is corrupt.");
+	}
+	uint32_t n_values {0};
+	std::memcpy(&n_values, m_buf->data(), sizeof(uint32_t));
+	m_cardinality = n_values;
+
+	// the offsets have to fit, and the last one has to end the bytes.
+	const n_t header_size = sizeof(uint32_t) + m_cardinality * sizeof(ofs_t);
+	if (header_size > size || (m_cardinality != 0 && header_size + Offsets()[m_cardinality - 1] != size)) {
+		throw std::runtime_error("GlobalDictionaryView: the dictionary is corrupt.");
+	}
+}
+
+n_t GlobalDictionaryView::Cardinality() const {
+	return m_cardinality;
+}
+
+const ofs_t* GlobalDictionaryView::Offsets() const {
+	return reinterpret_cast<const ofs_t*>(m_buf->data() + sizeof(uint32_t));
+}
+
+const uint8_t* GlobalDictionaryView::Bytes() const {
+	return m_buf->data() + sizeof(uint32_t) + m_cardinality * sizeof(ofs_t);
+}
+
+const vector<uint8_t>& GlobalDictionaryView::Match(const StrPredicate& predicate) {
+	return m_matcher.Match(predicate, Offsets(), Bytes(), m_cardinality);
+}
+
+} // namespace fastlanes
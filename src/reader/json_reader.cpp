@@ -4,6 +4,7 @@
 // src/reader/json_reader.cpp
 // ────────────────────────────────────────────────────────
 #include "fls/reader/json_reader.hpp"
+#include "fls/cfg/cfg.hpp"
 #include "fls/common/alias.hpp"
 #include "fls/common/common.hpp"
 #include "fls/connection.hpp"
@@ -134,6 +135,10 @@ up<Table> JsonReader::Read(const path& dir_path, const Connection& connection) {
 		parse_json_tuple(tuple, cur_rowgroup->internal_rowgroup, rowgroup_descriptor.m_column_descriptors);
 		n_tup = n_tup + 1;
 
+		// the first vector of a rowgroup tells how wide its rows are, and so how many of them fit the byte budget.
+		if (n_tup == CFG::VEC_SZ) {
+			cur_rowgroup->FitCapacity(n_tup);
+		}
 		if (n_tup == cur_rowgroup->capacity) {
 			cur_rowgroup->n_tup = n_tup;
 			table->m_rowgroups.push_back(std::move(cur_rowgroup));
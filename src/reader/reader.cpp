@@ -32,7 +32,7 @@ Reader::Reader(const path& dir_path, Connection& fls) {
 	// read file
 	{
 		// allocate buffer
-		m_buf = make_unique<Buf>(m_footer->m_rowgroup_size);       // todo[memory_pool]
+		m_buf = make_unique<Buf>(m_footer->m_rowgroup_size);       // from BufPool::Global()
 		io io = make_unique<File>(dir_path / FASTLANES_FILE_NAME); // todo[IO]
 		IO::read(io, *m_buf);
 		m_rowgroup_view = make_unique<RowgroupView>(m_buf->Span(), *m_footer);
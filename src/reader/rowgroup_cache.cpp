@@ -0,0 +1,110 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/reader/rowgroup_cache.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/reader/rowgroup_cache.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/cor/lyt/buf.hpp"
+#include <string>
+#include <utility>
+
+namespace fastlanes {
+
+RowgroupCache::RowgroupCache(const n_t budget)
+    : m_budget(budget)
+    , m_cached_bytes(0)
+    , m_hits(0)
+    , m_misses(0) {
+}
+
+sp<const Buf> RowgroupCache::Get(const string& file_identity, const n_t offset) {
+	const std::lock_guard lock(m_mutex);
+
+	const auto it = m_entries.find(Key(file_identity, offset));
+	if (it == m_entries.end()) {
+		m_misses++;
+		return nullptr;
+	}
+
+	m_hits++;
+	m_lru.splice(m_lru.begin(), m_lru, it->second);
+	return it->second->buf;
+}
+
+void RowgroupCache::Put(const string& file_identity, const n_t offset, sp<const Buf> buf, const n_t n_bytes) {
+	const std::lock_guard lock(m_mutex);
+
+	if (n_bytes > m_budget) {
+		return;
+	}
+
+	auto key = Key(file_identity, offset);
+	if (const auto it = m_entries.find(key); it != m_entries.end()) {
+		// another reader cached it first.
+		m_lru.splice(m_lru.begin(), m_lru, it->second);
+		return;
+	}
+
+	Evict(m_budget - n_bytes);
+	m_lru.push_front(Entry {key, std::move(buf), n_bytes});
+	m_entries.emplace(std::move(key), m_lru.begin());
+	m_cached_bytes += n_bytes;
+}
+
+void RowgroupCache::Clear() {
+	const std::lock_guard lock(m_mutex);
+
+	Evict(0);
+	m_hits   = 0;
+	m_misses = 0;
+}
+
+n_t RowgroupCache::CachedBytes() const {
+	const std::lock_guard lock(m_mutex);
+	return m_cached_bytes;
+}
+
+n_t RowgroupCache::Budget() const {
+	const std::lock_guard lock(m_mutex);
+	return m_budget;
+}
+
+void RowgroupCache::SetBudget(const n_t budget) {
+	const std::lock_guard lock(m_mutex);
+
+	m_budget = budget;
+	Evict(budget);
+}
+
+n_t RowgroupCache::Hits() const {
+	const std::lock_guard lock(m_mutex);
+	return m_hits;
+}
+
+n_t RowgroupCache::Misses() const {
+	const std::lock_guard lock(m_mutex);
+	return m_misses;
+}
+
+RowgroupCache& RowgroupCache::Global() {
+	// never destroyed, so readers alive during static destruction still find it.
+	static auto* cache = new RowgroupCache {CFG::RowgroupCache::BUDGET};
+	return *cache;
+}
+
+string RowgroupCache::Key(const string& file_identity, const n_t offset) {
+	return file_identity + '@' + std::to_string(offset);
+}
+
+// called with the mutex held.
+void RowgroupCache::Evict(const n_t budget) {
+	while (m_cached_bytes > budget) {
+		const auto& entry = m_lru.back();
+		m_cached_bytes -= entry.n_bytes;
+		m_entries.erase(entry.key);
+		m_lru.pop_back();
+	}
+}
+
+} // namespace fastlanes
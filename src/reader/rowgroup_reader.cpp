@@ -5,47 +5,147 @@
 // ────────────────────────────────────────────────────────
 #include "fls/reader/rowgroup_reader.hpp" //
 #include "fls/common/alias.hpp"
-#include "fls/connection.hpp"                     // for Connector (ptr only)
-#include "fls/cor/lyt/buf.hpp"                    // for Buf
-#include "fls/csv/csv.hpp"                        // for CSV
-#include "fls/encoder/materializer.hpp"           //
-#include "fls/expression/decoding_operator.hpp"   //
-#include "fls/expression/encoding_operator.hpp"   //
-#include "fls/expression/expression_executor.hpp" //
-#include "fls/expression/interpreter.hpp"         // for Interpreter
-#include "fls/expression/physical_expression.hpp" // for PhysicalExpr
-#include "fls/footer/rowgroup_descriptor.hpp"     // for Footer, ColumnMeta...
-#include "fls/io/file.hpp"                        // for File
-#include "fls/io/io.hpp"                          // for IO, io
+#include "fls/common/assert.hpp"
+#include "fls/connection.hpp"                        // for Connector (ptr only)
+#include "fls/cor/lyt/buf.hpp"                       // for Buf
+#include "fls/cor/lyt/buf_pool.hpp"                  // for BufPool
+#include "fls/cor/lyt/memory_tracker.hpp"            // for MemoryTracker
+#include "fls/csv/csv.hpp"                           // for CSV
+#include "fls/encoder/materializer.hpp"              //
+#include "fls/expression/aggregate.hpp"              // for Aggregate
+#include "fls/expression/data_type.hpp"              // for IsSigned
+#include "fls/expression/decoding_operator.hpp"      //
+#include "fls/expression/encoding_operator.hpp"      //
+#include "fls/expression/expression_executor.hpp"    //
+#include "fls/expression/interpreter.hpp"            // for Interpreter
+#include "fls/expression/physical_expression.hpp"    // for PhysicalExpr
+#include "fls/expression/selection_ds.hpp"           // for SelectionDS
+#include "fls/filter/bloom_filter.hpp"               // for BloomFilter
+#include "fls/footer/rowgroup_descriptor.hpp"        // for Footer, ColumnMeta...
+#include "fls/footer/table_descriptor_generated.h"   // for TableDescriptor
+#include "fls/io/file.hpp"                           // for File
+#include "fls/io/io.hpp"                             // for IO, io
+#include "fls/primitive/predicate/str_predicate.hpp" // for StrPredicate
 #include "fls/reader/column_view.hpp"
+#include "fls/reader/global_dictionary_view.hpp"
+#include "fls/reader/rowgroup_cache.hpp"
 #include "fls/reader/rowgroup_view.hpp"
+#include "fls/reader/symbol_table_view.hpp"
 #include "fls/std/filesystem.hpp"
-#include "fls/table/chunk.hpp" // for Chunk
-#include <cstdint>             // for std::uint32_t
-#include <memory>              // for make_unique, uniqu...
+#include "fls/table/chunk.hpp"    // for Chunk
+#include "fls/table/rowgroup.hpp" // for Rowgroup
+#include <algorithm>              // for std::min
+#include <cstdint>                // for std::uint32_t
+#include <memory>                 // for make_unique, uniqu...
+#include <stdexcept>              // for std::runtime_error, std::out_of_range
+#include <string>                 // for std::to_string
+#include <type_traits>            // for std::is_arithmetic_v
+#include <utility>                // for std::move
 
 namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+static const RowgroupDescriptor& GetRowgroupDescriptor(const TableDescriptor& table_descriptor,
+                                                       const n_t              rowgroup_idx) {
+	const auto* rowgroup_descriptors = table_descriptor.m_rowgroup_descriptors();
+	if (rowgroup_idx >= rowgroup_descriptors->size()) {
+		throw std::out_of_range("RowgroupReader: rowgroup index " + std::to_string(rowgroup_idx) + " is out of range.");
+	}
+	return *rowgroup_descriptors->Get(static_cast<flatbuffers::uoffset_t>(rowgroup_idx));
+}
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RowgroupReader
+\*--------------------------------------------------------------------------------------------------------------------*/
 RowgroupReader::RowgroupReader(const path&               file_path,
                                const RowgroupDescriptor& rowgroup_descriptor,
                                Connection&               connection)
     : m_connection(connection)
-    , m_rowgroup_descriptor(rowgroup_descriptor) {
+    , m_rowgroup_descriptor(&rowgroup_descriptor)
+    , m_table_descriptor(nullptr)
+    , m_file_path(file_path)
+    , m_io(make_unique<File>(file_path)) // todo[IO]
+    , m_n_operator_bytes(0)
+    , m_n_cached_bytes(0)
+    , m_n_cached_shared_bytes(0) {
+	try {
+		Read();
+	} catch (...) {
+		// the destructor does not run for a reader that was never built.
+		m_connection.get_memory_tracker().Release(m_n_cached_bytes + m_n_cached_shared_bytes + m_n_operator_bytes);
+		throw;
+	}
+}
+
+RowgroupReader::RowgroupReader(const path&            file_path,
+                               const TableDescriptor& table_descriptor,
+                               const n_t              rowgroup_idx,
+                               Connection&            connection)
+    : RowgroupReader(file_path, GetRowgroupDescriptor(table_descriptor, rowgroup_idx), connection) {
+	m_table_descriptor = &table_descriptor;
+}
+
+RowgroupReader::~RowgroupReader() {
+	m_connection.get_memory_tracker().Release(m_n_cached_bytes + m_n_cached_shared_bytes + m_n_operator_bytes);
+}
+
+void RowgroupReader::Read() {
+	auto& memory_tracker = m_connection.get_memory_tracker();
+
+	// the operators and the cached buffer of the previous rowgroup go first.
+	m_expressions.clear();
+	m_cached_buf.reset();
+	memory_tracker.Release(m_n_cached_bytes + m_n_operator_bytes);
+	m_n_cached_bytes   = 0;
+	m_n_operator_bytes = 0;
 
 	// read file
 	{
-		// allocate buffer
-		m_buf = make_unique<Buf>(m_rowgroup_descriptor.m_size()); // todo[memory_pool]
-		io io = make_unique<File>(file_path);                     // todo[IO]
-		IO::range_read(io, *m_buf, m_rowgroup_descriptor.m_offset(), m_rowgroup_descriptor.m_size());
-		m_rowgroup_view = make_unique<RowgroupView>(m_buf->Span(), m_rowgroup_descriptor);
+		const n_t offset = m_rowgroup_descriptor->m_offset();
+		const n_t size   = m_rowgroup_descriptor->m_size();
+
+		if (auto* rowgroup_cache = m_connection.get_rowgroup_cache(); rowgroup_cache != nullptr) {
+			if (m_file_identity.empty()) {
+				m_file_identity = File::identity(m_file_path);
+			}
+			// cached rowgroups can outlive the connection, so they are not tracked buffers; the reader counts the one
+			// it holds against the budget of the connection instead.
+			const n_t n_cached_bytes = BufPool::SizeClass(size);
+			memory_tracker.Reserve(n_cached_bytes);
+			try {
+				m_cached_buf = rowgroup_cache->Get(m_file_identity, offset);
+				if (m_cached_buf == nullptr) {
+					auto buf = make_shared<Buf>(size, m_connection.is_huge_pages_enabled()); // from BufPool::Local()
+					IO::range_read(m_io, *buf, offset, size);
+					rowgroup_cache->Put(m_file_identity, offset, buf, buf->Capacity());
+					m_cached_buf = std::move(buf);
+				}
+			} catch (...) {
+				memory_tracker.Release(n_cached_bytes);
+				throw;
+			}
+			m_n_cached_bytes = n_cached_bytes;
+			m_rowgroup_view = make_unique<RowgroupView>(m_cached_buf->Span(), *m_rowgroup_descriptor);
+		} else {
+			// the buffer of the previous rowgroup is kept and only grows.
+			if (m_buf == nullptr) {
+				// from BufPool::Local()
+				m_buf = make_unique<Buf>(size, memory_tracker, m_connection.is_huge_pages_enabled());
+			} else {
+				m_buf->Resize(size);
+			}
+			IO::range_read(m_io, *m_buf, offset, size);
+			m_rowgroup_view = make_unique<RowgroupView>(m_buf->Span(), *m_rowgroup_descriptor);
+		}
 	}
 
 	// init level 1 expression
 	{
-		m_expressions.reserve(m_rowgroup_descriptor.m_column_descriptors()->size());
-		for (n_t col_idx {0}; col_idx < m_rowgroup_descriptor.m_column_descriptors()->size(); ++col_idx) {
-			auto& column_descriptor = *(*m_rowgroup_descriptor.m_column_descriptors())[static_cast<uint32_t>(col_idx)];
+		// operators bind the segments of the buffer when they are built, so they are built again for every rowgroup.
+		m_expressions.reserve(m_rowgroup_descriptor->m_column_descriptors()->size());
+		for (n_t col_idx {0}; col_idx < m_rowgroup_descriptor->m_column_descriptors()->size(); ++col_idx) {
+			auto& column_descriptor = *(*m_rowgroup_descriptor->m_column_descriptors())[static_cast<uint32_t>(col_idx)];
 			auto& column_view       = (*m_rowgroup_view)[col_idx];
 
 			InterpreterState state;
@@ -53,34 +153,159 @@ RowgroupReader::RowgroupReader(const path&               file_path,
 			ExprExecutor::CountOperator(*physical_expr);
 			m_expressions.emplace_back(physical_expr);
 		}
+
+		const n_t n_operator_bytes = ExprExecutor::memory_usage(m_expressions);
+		memory_tracker.Reserve(n_operator_bytes);
+		m_n_operator_bytes = n_operator_bytes;
 	}
 }
 
 vector<sp<PhysicalExpr>>& RowgroupReader::get_chunk(const n_t vec_idx) {
-	for (n_t col_idx {0}; col_idx < m_rowgroup_descriptor.m_column_descriptors()->size(); ++col_idx) {
+	for (n_t col_idx {0}; col_idx < m_rowgroup_descriptor->m_column_descriptors()->size(); ++col_idx) {
 		auto& physical_expr = *m_expressions[col_idx];
 		ExprExecutor::smart_execute(physical_expr, vec_idx);
 	}
 	return m_expressions;
 }
 
-void RowgroupReader::reset() {
+bool RowgroupReader::gather_chunk(const n_t vec_idx, span<const vec_idx_t> selected_idxs) {
+	if (selected_idxs.empty()) {
+		return false;
+	}
+
+	const n_t n_cols = m_rowgroup_descriptor->m_column_descriptors()->size();
+	if (m_gathered_columns.size() != n_cols) {
+		m_gathered_columns.resize(n_cols);
+	}
+
+	for (n_t col_idx {0}; col_idx < n_cols; ++col_idx) {
+		auto& physical_expr   = *m_expressions[col_idx];
+		auto& gathered_column = m_gathered_columns[col_idx];
+
+		gathered_column.is_gathered =
+		    ExprExecutor::gather(physical_expr, vec_idx, selected_idxs, gathered_column.data);
+		if (!gathered_column.is_gathered) {
+			ExprExecutor::smart_execute(physical_expr, vec_idx);
+		}
+	}
+	return true;
+}
+
+bool RowgroupReader::gather_chunk(const n_t vec_idx, SelectionDS& selection) {
+	selection.ToIndices();
+	return gather_chunk(vec_idx, selection.Indices());
+}
+
+bool RowgroupReader::filter_chunk(const n_t           vec_idx,
+                                  const n_t           col_idx,
+                                  const StrPredicate& predicate,
+                                  SelectionDS&        selection) {
+	FLS_ASSERT_L(col_idx, m_expressions.size())
+	if (!may_match(col_idx, predicate)) {
+		// no row of the rowgroup can match, so no segment of the vector is touched.
+		selection.n_selected_values = 0;
+		selection.use_bitmap        = false;
+		return true;
+	}
+	return ExprExecutor::filter(*m_expressions[col_idx], vec_idx, value_count(vec_idx), predicate, selection);
+}
+
+n_t RowgroupReader::value_count(const n_t vec_idx) const {
+	return std::min(CFG::VEC_SZ, m_rowgroup_descriptor->m_n_tuples() - vec_idx * CFG::VEC_SZ);
+}
+
+bool RowgroupReader::may_match(const n_t col_idx, const StrPredicate& predicate) const {
+	if (predicate.type != StrPredicateT::EQUAL) {
+		return true;
+	}
+
+	const auto* column_descriptor =
+	    m_rowgroup_descriptor->m_column_descriptors()->Get(static_cast<flatbuffers::uoffset_t>(col_idx));
+	const auto* bloom_filter = column_descriptor->bloom_filter();
+	if (bloom_filter == nullptr) {
+		return true;
+	}
+
+	return BloomFilter::MayContain({bloom_filter->data(), bloom_filter->size()}, BloomFilter::Hash(predicate.pattern));
+}
+
+bool RowgroupReader::select_chunk(const n_t vec_idx, const n_t col_idx, SelectionDS& selection) {
+	FLS_ASSERT_L(col_idx, m_expressions.size())
+	return ExprExecutor::select(*m_expressions[col_idx], vec_idx, value_count(vec_idx), selection);
+}
+
+bool RowgroupReader::aggregate(const n_t col_idx, Aggregate& aggregate) {
+	FLS_ASSERT_L(col_idx, m_expressions.size())
+	const n_t n_tuples = m_rowgroup_descriptor->m_n_tuples();
+
+	if (aggregate.type == AggregateT::COUNT) {
+		aggregate.UpdateCount(n_tuples);
+		aggregate.n_pushed_down_rowgroups++;
+		return true;
+	}
+
+	auto&       expr              = m_expressions[col_idx];
+	const auto* column_descriptor = m_rowgroup_descriptor->m_column_descriptors()->Get(static_cast<uint32_t>(col_idx));
+	if (ExprExecutor::aggregate(*expr, IsSigned(column_descriptor->data_type()), n_tuples, aggregate)) {
+		aggregate.n_pushed_down_rowgroups++;
+		return true;
+	}
+
+	// fallback: decode this column alone.
+	auto               rg_native   = up<RowgroupDescriptorT>(m_rowgroup_descriptor->UnPack());
+	auto               rowgroup_up = make_unique<Rowgroup>(std::move(*rg_native), m_connection);
+	const Materializer materializer {*rowgroup_up};
+	for (n_t vec_idx {0}; vec_idx < m_rowgroup_descriptor->m_n_vec(); ++vec_idx) {
+		ExprExecutor::smart_execute(*expr, vec_idx);
+		materializer.Materialize(expr, col_idx, vec_idx);
+	}
+
+	visit(overloaded {
+	          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+		          if constexpr (std::is_arithmetic_v<PT>) {
+			          aggregate.Update<PT>(typed_col->data.data(), n_tuples);
+		          } else {
+			          throw std::runtime_error("SUM, MIN and MAX are only supported on numeric columns.");
+		          }
+	          },
+	          [&](const auto&) { throw std::runtime_error("SUM, MIN and MAX are only supported on numeric columns."); },
+	      },
+	      rowgroup_up->internal_rowgroup[col_idx]);
+	aggregate.n_decoded_rowgroups++;
+	return false;
+}
+
+const GatheredColumn& RowgroupReader::get_gathered_column(const n_t col_idx) const {
+	FLS_ASSERT_L(col_idx, m_gathered_columns.size())
+	return m_gathered_columns[col_idx];
+}
+
+void RowgroupReader::reset(const n_t rowgroup_idx) {
+	if (m_table_descriptor == nullptr) {
+		throw std::runtime_error("RowgroupReader: reset needs a reader created from the table descriptor.");
+	}
+	reset(GetRowgroupDescriptor(*m_table_descriptor, rowgroup_idx));
+}
+
+void RowgroupReader::reset(const RowgroupDescriptor& rowgroup_descriptor) {
+	m_rowgroup_descriptor = &rowgroup_descriptor;
+	Read();
 }
 
 const RowgroupDescriptor& RowgroupReader::get_descriptor() const {
-	return m_rowgroup_descriptor;
+	return *m_rowgroup_descriptor;
 }
 
 up<Rowgroup> RowgroupReader::materialize() {
 	// Convert FlatBuffers table -> native T
-	auto rg_native = up<RowgroupDescriptorT>(m_rowgroup_descriptor.UnPack());
+	auto rg_native = up<RowgroupDescriptorT>(m_rowgroup_descriptor->UnPack());
 
 	// Construct Rowgroup from the native descriptor
-	auto rowgroup_up = std::make_unique<Rowgroup>(*rg_native, m_connection);
+	auto rowgroup_up = std::make_unique<Rowgroup>(std::move(*rg_native), m_connection);
 
 	const Materializer materializer {*rowgroup_up};
 
-	const n_t n_vec = static_cast<n_t>(m_rowgroup_descriptor.m_n_vec());
+	const n_t n_vec = static_cast<n_t>(m_rowgroup_descriptor->m_n_vec());
 	for (n_t vec_idx {0}; vec_idx < n_vec; ++vec_idx) {
 		auto& expressions = get_chunk(vec_idx);
 		materializer.Materialize(expressions, vec_idx);
@@ -98,4 +323,68 @@ void RowgroupReader::to_csv(const path& dir_path) {
 	CSV::to_csv(dir_path, *materialized_rowgroup, materialized_rowgroup->m_descriptor);
 }
 
+sp<const Buf> RowgroupReader::ReadShared(const n_t offset, const n_t size) {
+	if (auto* rowgroup_cache = m_connection.get_rowgroup_cache(); rowgroup_cache != nullptr) {
+		if (m_file_identity.empty()) {
+			m_file_identity = File::identity(m_file_path);
+		}
+		// held until the reader goes, and counted against the budget of the connection until then, as in Read.
+		auto&     memory_tracker = m_connection.get_memory_tracker();
+		const n_t n_cached_bytes = BufPool::SizeClass(size);
+		memory_tracker.Reserve(n_cached_bytes);
+		try {
+			sp<const Buf> cached_buf = rowgroup_cache->Get(m_file_identity, offset);
+			if (cached_buf == nullptr) {
+				auto buf = make_shared<Buf>(size, m_connection.is_huge_pages_enabled()); // from BufPool::Local()
+				IO::range_read(m_io, *buf, offset, size);
+				rowgroup_cache->Put(m_file_identity, offset, buf, buf->Capacity());
+				cached_buf = std::move(buf);
+			}
+			m_n_cached_shared_bytes += n_cached_bytes;
+			return cached_buf;
+		} catch (...) {
+			memory_tracker.Release(n_cached_bytes);
+			throw;
+		}
+	}
+
+	auto buf = make_shared<Buf>(size, m_connection.get_memory_tracker(), m_connection.is_huge_pages_enabled());
+	IO::range_read(m_io, *buf, offset, size);
+	return buf;
+}
+
+GlobalDictionaryView& RowgroupReader::get_global_dictionary(const n_t offset, const n_t size) {
+	if (const auto it = m_global_dictionaries.find(offset); it != m_global_dictionaries.end()) {
+		return *it->second;
+	}
+
+	auto global_dictionary = make_unique<GlobalDictionaryView>(ReadShared(offset, size), size);
+	return *m_global_dictionaries.emplace(offset, std::move(global_dictionary)).first->second;
+}
+
+template <typename DECODER_T>
+SymbolTableView<DECODER_T>& RowgroupReader::get_symbol_table(const n_t offset, const n_t size) {
+	auto& symbol_tables = [this]() -> auto& {
+		if constexpr (std::is_same_v<DECODER_T, fsst_decoder_t>) {
+			return m_fsst_symbol_tables;
+		} else {
+			return m_fsst12_symbol_tables;
+		}
+	}();
+	if (const auto it = symbol_tables.find(offset); it != symbol_tables.end()) {
+		return *it->second;
+	}
+
+	// only the imported table is kept, so the bytes ReadShared counted against the budget go back once it is imported.
+	const n_t  n_cached_shared_bytes = m_n_cached_shared_bytes;
+	const auto buf                   = ReadShared(offset, size);
+	auto       symbol_table          = make_unique<SymbolTableView<DECODER_T>>(buf->data(), size);
+	m_connection.get_memory_tracker().Release(m_n_cached_shared_bytes - n_cached_shared_bytes);
+	m_n_cached_shared_bytes = n_cached_shared_bytes;
+	return *symbol_tables.emplace(offset, std::move(symbol_table)).first->second;
+}
+
+template SymbolTableView<fsst_decoder_t>&   RowgroupReader::get_symbol_table(n_t offset, n_t size);
+template SymbolTableView<fsst12_decoder_t>& RowgroupReader::get_symbol_table(n_t offset, n_t size);
+
 } // namespace fastlanes
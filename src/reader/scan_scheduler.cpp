@@ -0,0 +1,215 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/reader/scan_scheduler.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/reader/scan_scheduler.hpp"
+#include "fls/common/assert.hpp"
+#include "fls/cor/lyt/buf_pool.hpp"
+#include <algorithm> // std::min, std::max
+#include <atomic>
+#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <fstream>   // std::ifstream
+#include <memory>    // std::unique_ptr
+#include <mutex>
+#include <sstream> // std::stringstream
+#include <string>
+#include <thread>
+#if defined(__linux__)
+#include <pthread.h> // pthread_setaffinity_np
+#include <sched.h>   // cpu_set_t, CPU_SET
+#endif
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+static bool ReadLine(const string& file_path, string& line) {
+	std::ifstream file(file_path);
+	return file && std::getline(file, line);
+}
+
+// pins the calling thread.
+static void PinToCpus(const vector<int>& cpus) {
+#if defined(__linux__)
+	if (cpus.empty()) {
+		return;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (const int cpu : cpus) {
+		CPU_SET(cpu, &cpu_set);
+	}
+	// best effort: a cpuset that excludes the node leaves the worker unpinned.
+	pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#else
+	static_cast<void>(cpus);
+#endif
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * NumaTopology
+\*--------------------------------------------------------------------------------------------------------------------*/
+const NumaTopology& NumaTopology::Get() {
+	static const NumaTopology topology = [] {
+		NumaTopology result;
+		string       online;
+		if (ReadLine("/sys/devices/system/node/online", online)) {
+			for (const int node : ParseCpuList(online)) {
+				string cpu_list;
+				if (ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", cpu_list)) {
+					// memory-only nodes have no cpus to run a worker on.
+					if (auto cpus = ParseCpuList(cpu_list); !cpus.empty()) {
+						result.m_cpus_per_node.push_back(std::move(cpus));
+					}
+				}
+			}
+		}
+		if (result.m_cpus_per_node.empty()) {
+			result.m_cpus_per_node.emplace_back();
+		}
+		return result;
+	}();
+	return topology;
+}
+
+vector<int> NumaTopology::ParseCpuList(const string& cpu_list) {
+	vector<int>       cpus;
+	std::stringstream stream(cpu_list);
+	string            range;
+	while (std::getline(stream, range, ',')) {
+		if (range.empty() || range == "\n") {
+			continue;
+		}
+		const auto dash  = range.find('-');
+		const int  first = std::stoi(range.substr(0, dash));
+		const int  last  = dash == string::npos ? first : std::stoi(range.substr(dash + 1));
+		for (int cpu {first}; cpu <= last; ++cpu) {
+			cpus.push_back(cpu);
+		}
+	}
+	return cpus;
+}
+
+n_t NumaTopology::NodeCount() const {
+	return m_cpus_per_node.size();
+}
+
+const vector<int>& NumaTopology::Cpus(const n_t node) const {
+	FLS_ASSERT_L(node, m_cpus_per_node.size())
+	return m_cpus_per_node[node];
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * ScanScheduler
+\*--------------------------------------------------------------------------------------------------------------------*/
+ScanScheduler::ScanScheduler(const n_t n_workers)
+    : m_topology(NumaTopology::Get())
+    , m_n_workers(std::max<n_t>(n_workers, 1))
+    , m_n_nodes(std::min(m_topology.NodeCount(), m_n_workers))
+    , m_n_stolen_morsels(0) {
+}
+
+n_t ScanScheduler::WorkerCount() const {
+	return m_n_workers;
+}
+
+n_t ScanScheduler::WorkerNode(const n_t worker_idx) const {
+	return worker_idx % m_n_nodes;
+}
+
+n_t ScanScheduler::MorselNode(const n_t morsel_idx, const n_t n_morsels) const {
+	FLS_ASSERT_L(morsel_idx, n_morsels)
+	return morsel_idx * m_n_nodes / n_morsels;
+}
+
+n_t ScanScheduler::StolenMorsels() const {
+	return m_n_stolen_morsels;
+}
+
+void ScanScheduler::Run(const n_t n_morsels, const task_t& task) {
+	m_n_stolen_morsels = 0;
+	if (n_morsels == 0) {
+		return;
+	}
+
+	// the morsels of node `n` are [node_begin[n], node_begin[n + 1]); node_next[n] is the next one to hand out.
+	vector<n_t> node_begin(m_n_nodes + 1, n_morsels);
+	for (n_t morsel_idx {n_morsels}; morsel_idx-- > 0;) {
+		node_begin[MorselNode(morsel_idx, n_morsels)] = morsel_idx;
+	}
+	for (n_t node {m_n_nodes}; node-- > 0;) {
+		node_begin[node] = std::min(node_begin[node], node_begin[node + 1]);
+	}
+	const std::unique_ptr<std::atomic<n_t>[]> node_next(new std::atomic<n_t>[m_n_nodes]);
+	for (n_t node {0}; node < m_n_nodes; ++node) {
+		node_next[node] = node_begin[node];
+	}
+
+	std::atomic<bool>  is_failed {false};
+	std::atomic<n_t>   n_stolen_morsels {0};
+	std::exception_ptr first_exception;
+	std::mutex         exception_mutex;
+
+	// the next morsel of `node`, or n_morsels once its range is drained.
+	const auto take = [&](const n_t node) -> n_t {
+		const n_t morsel_idx = node_next[node].fetch_add(1);
+		return morsel_idx < node_begin[node + 1] ? morsel_idx : n_morsels;
+	};
+
+	const auto work = [&](const n_t worker_idx) {
+		// pinned before the first allocation, so every page the worker touches is placed on its node.
+		const n_t home_node = WorkerNode(worker_idx);
+		if (m_topology.NodeCount() > 1) {
+			PinToCpus(m_topology.Cpus(home_node));
+		}
+		BufPool::SetLocal(&BufPool::ForNode(home_node));
+		try {
+			for (n_t offset {0}; offset < m_n_nodes && !is_failed; ++offset) {
+				const n_t node = (home_node + offset) % m_n_nodes;
+				for (n_t morsel_idx = take(node); morsel_idx != n_morsels && !is_failed; morsel_idx = take(node)) {
+					if (node != home_node) {
+						n_stolen_morsels++;
+					}
+					task(worker_idx, morsel_idx);
+				}
+			}
+		} catch (...) {
+			const std::lock_guard lock(exception_mutex);
+			if (!is_failed.exchange(true)) {
+				first_exception = std::current_exception();
+			}
+		}
+		BufPool::SetLocal(nullptr);
+	};
+
+	vector<std::thread> workers;
+	workers.reserve(m_n_workers);
+	for (n_t worker_idx {0}; worker_idx < m_n_workers; ++worker_idx) {
+		workers.emplace_back(work, worker_idx);
+	}
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	m_n_stolen_morsels = n_stolen_morsels;
+	if (first_exception) {
+		std::rethrow_exception(first_exception);
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * ParallelFor
+\*--------------------------------------------------------------------------------------------------------------------*/
+void ParallelFor(const n_t n_threads, const n_t n, const std::function<void(n_t idx)>& task) {
+	if (n_threads <= 1 || n <= 1) {
+		for (n_t idx {0}; idx < n; ++idx) {
+			task(idx);
+		}
+		return;
+	}
+	ScanScheduler scheduler {std::min(n_threads, n)};
+	scheduler.Run(n, [&](n_t, const n_t idx) { task(idx); });
+}
+
+} // namespace fastlanes
@@ -4,6 +4,7 @@
 // src/reader/segment.cpp
 // ────────────────────────────────────────────────────────
 #include "fls/reader/segment.hpp"
+#include "fls/cfg/cfg.hpp"
 #include "fls/common/alias.hpp"
 #include "fls/common/assert.hpp"
 #include "fls/common/common.hpp"
@@ -102,7 +103,7 @@ n_t SegmentView::Size() const {
 Segment::Segment()
     : persistent(true)
     , is_block_based(false) {
-	buf = make_unique<Buf>();
+	buf = make_unique<Buf>(CFG::BufPool::SEGMENT_CAPACITY);
 	//
 }
 
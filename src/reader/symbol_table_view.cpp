@@ -0,0 +1,45 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/reader/symbol_table_view.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/reader/symbol_table_view.hpp"
+#include <stdexcept> // std::runtime_error
+#include <type_traits>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * SymbolTableView
+\*--------------------------------------------------------------------------------------------------------------------*/
+template <typename DECODER_T>
+SymbolTableView<DECODER_T>::SymbolTableView(const uint8_t* header, const n_t size)
+    : m_decoder {} {
+	n_t n_imported_bytes {0};
+	if constexpr (std::is_same_v<DECODER_T, fsst_decoder_t>) {
+		n_imported_bytes = fsst_import(&m_decoder, header);
+	} else {
+		n_imported_bytes = fsst12_import(&m_decoder, header);
+	}
+
+	if (n_imported_bytes == 0 || n_imported_bytes != size) {
+		throw std::runtime_error("SymbolTableView: the symbol table is corrupt.");
+	}
+}
+
+template <typename DECODER_T>
+DECODER_T& SymbolTableView<DECODER_T>::Decoder() {
+	return m_decoder;
+}
+
+template <typename DECODER_T>
+const FsstMatcher<DECODER_T>& SymbolTableView<DECODER_T>::Matcher(const StrPredicate& predicate) {
+	if (!m_matcher || m_matcher->GetPredicate() != predicate) {
+		m_matcher = make_unique<FsstMatcher<DECODER_T>>(m_decoder, predicate);
+	}
+	return *m_matcher;
+}
+
+template class SymbolTableView<fsst_decoder_t>;
+template class SymbolTableView<fsst12_decoder_t>;
+
+} // namespace fastlanes
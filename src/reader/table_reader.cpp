@@ -5,28 +5,32 @@
 // ────────────────────────────────────────────────────────
 #include "fls/reader/table_reader.hpp"
 #include "fls/common/alias.hpp"
+#include "fls/connection.hpp"
+#include "fls/cor/lyt/buf_pool.hpp"
+#include "fls/cor/lyt/memory_tracker.hpp"
 #include "fls/csv/csv.hpp"
 #include "fls/encoder/materializer.hpp"
-#include "fls/file/file_footer.hpp"
-#include "fls/file/file_header.hpp"
+#include "fls/expression/aggregate.hpp"
+#include "fls/filter/bloom_filter.hpp"
+#include "fls/footer/footer_cache.hpp"
+#include "fls/footer/rowgroup_descriptor.hpp"
 #include "fls/footer/table_descriptor.hpp"
 #include "fls/footer/table_descriptor_generated.h"
 #include "fls/reader/rowgroup_reader.hpp"
+#include "fls/reader/scan_scheduler.hpp"
 #include "fls/std/filesystem.hpp"
 #include "fls/std/string.hpp"
+#include <algorithm>          // std::sort, std::upper_bound, std::min, std::max, std::clamp
 #include <filesystem>         // std::filesystem::path, exists, is_directory, is_regular_file
 #include <flatbuffers/base.h> // flatbuffers::uoffset_t
+#include <stdexcept>          // std::out_of_range
 #include <utility>            // std::move
 
 namespace fastlanes {
 
-constexpr static auto const* TABLE_DESCRIPTOR_FILE_NAME {"table_descriptor.fbb"};
-
 up<RowgroupReader> TableReader::get_rowgroup_reader(const n_t rowgroup_idx) const {
-	const TableDescriptor* td     = m_table_descriptor_handle->Get();
-	const auto             fb_idx = static_cast<flatbuffers::uoffset_t>(rowgroup_idx);
-	const auto*            rg     = td->m_rowgroup_descriptors()->Get(fb_idx); // pointer to RowgroupDescriptor (table)
-	return make_unique<RowgroupReader>(m_file_path, *rg, m_connection);
+	const TableDescriptor* td = m_table_descriptor_handle->Get();
+	return make_unique<RowgroupReader>(m_file_path, *td, rowgroup_idx, m_connection);
 }
 
 up<Table> TableReader::materialize() const {
@@ -34,21 +38,266 @@ up<Table> TableReader::materialize() const {
 
 	const TableDescriptor* td    = m_table_descriptor_handle->Get();
 	const auto             n_rgs = td->m_rowgroup_descriptors()->size(); // uoffset_t
+	if (n_rgs == 0) {
+		return table_up;
+	}
+
+	auto&              memory_tracker = m_connection.get_memory_tracker();
+	n_t                n_workers      = std::min<n_t>(m_connection.get_n_scan_threads(), n_rgs);
+	up<RowgroupReader> first_rowgroup_reader;
+	if (n_workers > 1 && memory_tracker.Budget() != 0) {
+		// backpressure: the reader of the first, full, rowgroup tells what one reader holds, and only as many readers
+		// are live as fit in what is left of the budget.
+		const n_t used_before  = memory_tracker.Used();
+		first_rowgroup_reader  = get_rowgroup_reader(0);
+		const n_t reader_bytes = std::max<n_t>(memory_tracker.Used() - used_before, 1);
+		const n_t budget_left  = memory_tracker.Budget() - std::min(memory_tracker.Budget(), memory_tracker.Used());
+		n_workers              = std::clamp<n_t>(1 + budget_left / reader_bytes, 1, n_workers);
+	}
 
+	if (n_workers > 1) {
+		// every worker re-targets its own reader; the rowgroups are put in order once all are read.
+		ScanScheduler              scan_scheduler {n_workers};
+		vector<up<RowgroupReader>> rowgroup_readers(scan_scheduler.WorkerCount());
+		vector<up<Rowgroup>>       rowgroups(n_rgs);
+		rowgroup_readers[0] = std::move(first_rowgroup_reader);
+		scan_scheduler.Run(n_rgs, [&](const n_t worker_idx, const n_t rowgroup_idx) {
+			rowgroups[rowgroup_idx] = materialize_rowgroup(rowgroup_readers[worker_idx], rowgroup_idx);
+		});
+		for (auto& rowgroup : rowgroups) {
+			table_up->m_rowgroups.push_back(std::move(rowgroup));
+		}
+		return table_up;
+	}
+
+	// one reader is re-targeted to every rowgroup, so the file is opened and the buffer allocated once.
+	up<RowgroupReader> rowgroup_reader = std::move(first_rowgroup_reader);
 	for (flatbuffers::uoffset_t i = 0; i < n_rgs; ++i) {
-		auto rowgroup_up = get_rowgroup_reader(static_cast<n_t>(i))->materialize();
+		auto rowgroup_up = materialize_rowgroup(rowgroup_reader, static_cast<n_t>(i));
 		table_up->m_rowgroups.push_back(std::move(rowgroup_up));
 	}
 
 	return table_up;
 }
 
+up<Rowgroup> TableReader::materialize_rowgroup(up<RowgroupReader>& rowgroup_reader, const n_t rowgroup_idx) const {
+	const auto* rowgroup_descriptor = m_table_descriptor_handle->Get()->m_rowgroup_descriptors()->Get(
+	    static_cast<flatbuffers::uoffset_t>(rowgroup_idx));
+	if (rowgroup_reader != nullptr && &rowgroup_reader->get_descriptor() != rowgroup_descriptor) {
+		try {
+			rowgroup_reader->reset(rowgroup_idx);
+		} catch (const MemoryBudgetException&) {
+			// backpressure: a reader that cannot grow within the budget lets go of all it holds and starts over.
+			rowgroup_reader.reset();
+		}
+	}
+	if (rowgroup_reader == nullptr) {
+		rowgroup_reader = get_rowgroup_reader(rowgroup_idx);
+	}
+	return rowgroup_reader->materialize();
+}
+
+n_t TableReader::get_n_rowgroups() const {
+	return m_table_descriptor_handle->Get()->m_rowgroup_descriptors()->size();
+}
+
+template <typename PT>
+bool TableReader::may_contain(const n_t rowgroup_idx, const n_t col_idx, const PT& value) const {
+	const TableDescriptor* td = m_table_descriptor_handle->Get();
+	const auto* rg = td->m_rowgroup_descriptors()->Get(static_cast<flatbuffers::uoffset_t>(rowgroup_idx));
+	const auto* column_descriptor = rg->m_column_descriptors()->Get(static_cast<flatbuffers::uoffset_t>(col_idx));
+	const auto* bloom_filter      = column_descriptor->bloom_filter();
+	if (bloom_filter == nullptr) {
+		return true;
+	}
+
+	return BloomFilter::MayContain({bloom_filter->data(), bloom_filter->size()}, BloomFilter::Hash(value));
+}
+
+template <typename PT>
+vector<n_t> TableReader::get_candidate_rowgroups(const n_t col_idx, const PT& value) const {
+	vector<n_t> candidate_rowgroups;
+	for (n_t rowgroup_idx {0}; rowgroup_idx < get_n_rowgroups(); ++rowgroup_idx) {
+		if (may_contain(rowgroup_idx, col_idx, value)) {
+			candidate_rowgroups.push_back(rowgroup_idx);
+		}
+	}
+	return candidate_rowgroups;
+}
+
+n_t TableReader::get_n_tuples() const {
+	n_t n_tuples {0};
+	for (const auto* rowgroup_descriptor : *m_table_descriptor_handle->Get()->m_rowgroup_descriptors()) {
+		n_tuples += rowgroup_descriptor->m_n_tuples();
+	}
+	return n_tuples;
+}
+
+fls_value_t TableReader::aggregate(const n_t col_idx, const AggregateT type) const {
+	Aggregate aggregate {type};
+	if (type == AggregateT::COUNT) {
+		// the footer knows the row count; no rowgroup is read.
+		aggregate.UpdateCount(get_n_tuples());
+		return aggregate.Result();
+	}
+
+	up<RowgroupReader> rowgroup_reader;
+	for (n_t rowgroup_idx {0}; rowgroup_idx < get_n_rowgroups(); ++rowgroup_idx) {
+		if (rowgroup_reader == nullptr) {
+			rowgroup_reader = get_rowgroup_reader(rowgroup_idx);
+		} else {
+			rowgroup_reader->reset(rowgroup_idx);
+		}
+		rowgroup_reader->aggregate(col_idx, aggregate);
+	}
+	return aggregate.Result();
+}
+
+std::pair<n_t, n_t> TableReader::locate_row(const n_t row_id) {
+	if (m_rowgroup_first_row_ids.empty()) {
+		const auto* rowgroup_descriptors = m_table_descriptor_handle->Get()->m_rowgroup_descriptors();
+		m_rowgroup_first_row_ids.push_back(0);
+		for (const auto* rowgroup_descriptor : *rowgroup_descriptors) {
+			m_rowgroup_first_row_ids.push_back(m_rowgroup_first_row_ids.back() + rowgroup_descriptor->m_n_tuples());
+		}
+	}
+
+	if (row_id >= m_rowgroup_first_row_ids.back()) {
+		throw std::out_of_range("row " + std::to_string(row_id) + " is out of range; the table has " +
+		                        std::to_string(m_rowgroup_first_row_ids.back()) + " rows.");
+	}
+
+	const auto it = std::upper_bound(m_rowgroup_first_row_ids.begin(), m_rowgroup_first_row_ids.end(), row_id) - 1;
+	const auto rowgroup_idx = static_cast<n_t>(it - m_rowgroup_first_row_ids.begin());
+	return {rowgroup_idx, row_id - *it};
+}
+
+RandomAccessor& TableReader::get_random_accessor(const n_t rowgroup_idx) {
+	if (m_random_accessors.size() != get_n_rowgroups()) {
+		m_random_accessors.resize(get_n_rowgroups());
+	}
+
+	auto& random_accessor = m_random_accessors[rowgroup_idx];
+	if (random_accessor == nullptr) {
+		// backpressure: under a memory budget, the oldest accessors make room for the new rowgroup.
+		const auto* rg = m_table_descriptor_handle->Get()->m_rowgroup_descriptors()->Get(
+		    static_cast<flatbuffers::uoffset_t>(rowgroup_idx));
+		const auto& memory_tracker = m_connection.get_memory_tracker();
+		while (!m_random_accessor_order.empty() && !memory_tracker.Fits(BufPool::SizeClass(rg->m_size()))) {
+			evict_oldest_random_accessor();
+		}
+		// the operators are only known once they are built; evict further if they do not fit either.
+		while (random_accessor == nullptr) {
+			try {
+				random_accessor = make_unique<RandomAccessor>(get_rowgroup_reader(rowgroup_idx));
+			} catch (const MemoryBudgetException&) {
+				if (m_random_accessor_order.empty()) {
+					throw;
+				}
+				evict_oldest_random_accessor();
+			}
+		}
+		m_random_accessor_order.push_back(rowgroup_idx);
+	}
+	return *random_accessor;
+}
+
+void TableReader::evict_oldest_random_accessor() {
+	m_random_accessors[m_random_accessor_order.front()].reset();
+	m_random_accessor_order.pop_front();
+}
+
+fls_value_t TableReader::get_value(const n_t row_id, const n_t col_idx) {
+	const auto [rowgroup_idx, row_idx] = locate_row(row_id);
+	const auto idx                     = static_cast<vec_idx_t>(row_idx % CFG::VEC_SZ);
+
+	fls_value_t value;
+	get_random_accessor(rowgroup_idx).RandomAccess(col_idx, row_idx / CFG::VEC_SZ, {&idx, 1}, &value);
+	return value;
+}
+
+vector<fls_value_t> TableReader::get_rows(span<const n_t> row_ids, span<const n_t> col_idxs) {
+	const n_t           n_cols = col_idxs.size();
+	vector<fls_value_t> result(row_ids.size() * n_cols);
+
+	// visit the rows in table order, so every vector is decoded at most once per column.
+	vector<n_t> order(row_ids.size());
+	for (n_t idx {0}; idx < order.size(); ++idx) {
+		order[idx] = idx;
+	}
+	std::sort(order.begin(), order.end(), [&](const n_t l, const n_t r) { return row_ids[l] < row_ids[r]; });
+
+	vector<vec_idx_t>   idxs;
+	vector<n_t>         targets;
+	vector<fls_value_t> values(CFG::VEC_SZ);
+	for (n_t begin {0}; begin < order.size();) {
+		const auto [rowgroup_idx, first_row_idx] = locate_row(row_ids[order[begin]]);
+		const n_t vec_idx                        = first_row_idx / CFG::VEC_SZ;
+		const n_t vec_first_row_id               = row_ids[order[begin]] - first_row_idx % CFG::VEC_SZ;
+
+		// the distinct rows of this vector, and for every requested row the slot its value lands in.
+		idxs.clear();
+		targets.clear();
+		n_t end {begin};
+		for (; end < order.size() && row_ids[order[end]] < vec_first_row_id + CFG::VEC_SZ; ++end) {
+			const auto idx = static_cast<vec_idx_t>(row_ids[order[end]] - vec_first_row_id);
+			if (idxs.empty() || idxs.back() != idx) {
+				idxs.push_back(idx);
+			}
+			targets.push_back(idxs.size() - 1);
+		}
+
+		auto& random_accessor = get_random_accessor(rowgroup_idx);
+		for (n_t col_pos {0}; col_pos < n_cols; ++col_pos) {
+			random_accessor.RandomAccess(col_idxs[col_pos], vec_idx, idxs, values.data());
+			for (n_t pos {begin}; pos < end; ++pos) {
+				result[order[pos] * n_cols + col_pos] = values[targets[pos - begin]];
+			}
+		}
+		begin = end;
+	}
+
+	return result;
+}
+
+template bool TableReader::may_contain<i08_pt>(n_t, n_t, const i08_pt&) const;
+template bool TableReader::may_contain<i16_pt>(n_t, n_t, const i16_pt&) const;
+template bool TableReader::may_contain<i32_pt>(n_t, n_t, const i32_pt&) const;
+template bool TableReader::may_contain<i64_pt>(n_t, n_t, const i64_pt&) const;
+template bool TableReader::may_contain<u08_pt>(n_t, n_t, const u08_pt&) const;
+template bool TableReader::may_contain<u16_pt>(n_t, n_t, const u16_pt&) const;
+template bool TableReader::may_contain<u32_pt>(n_t, n_t, const u32_pt&) const;
+template bool TableReader::may_contain<u64_pt>(n_t, n_t, const u64_pt&) const;
+template bool TableReader::may_contain<flt_pt>(n_t, n_t, const flt_pt&) const;
+template bool TableReader::may_contain<dbl_pt>(n_t, n_t, const dbl_pt&) const;
+template bool TableReader::may_contain<string>(n_t, n_t, const string&) const;
+template bool TableReader::may_contain<string_view>(n_t, n_t, const string_view&) const;
+
+template vector<n_t> TableReader::get_candidate_rowgroups<i08_pt>(n_t, const i08_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<i16_pt>(n_t, const i16_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<i32_pt>(n_t, const i32_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<i64_pt>(n_t, const i64_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<u08_pt>(n_t, const u08_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<u16_pt>(n_t, const u16_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<u32_pt>(n_t, const u32_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<u64_pt>(n_t, const u64_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<flt_pt>(n_t, const flt_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<dbl_pt>(n_t, const dbl_pt&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<string>(n_t, const string&) const;
+template vector<n_t> TableReader::get_candidate_rowgroups<string_view>(n_t, const string_view&) const;
+
 void TableReader::to_csv(const path& file_path) const {
 	const TableDescriptor* td    = m_table_descriptor_handle->Get();
 	const auto             n_rgs = td->m_rowgroup_descriptors()->size();
 
+	up<RowgroupReader> rowgroup_reader;
 	for (flatbuffers::uoffset_t i = 0; i < n_rgs; ++i) {
-		auto rowgroup_up = get_rowgroup_reader(static_cast<n_t>(i))->materialize();
+		if (rowgroup_reader == nullptr) {
+			rowgroup_reader = get_rowgroup_reader(static_cast<n_t>(i));
+		} else {
+			rowgroup_reader->reset(static_cast<n_t>(i));
+		}
+		auto rowgroup_up = rowgroup_reader->materialize();
 		CSV::to_csv(file_path, *rowgroup_up, rowgroup_up->m_descriptor);
 	}
 }
@@ -64,20 +313,9 @@ void TableReader::to_csv(const char* file_path) const {
 TableReader::TableReader(const path& file_path, Connection& connection)
     : m_connection(connection)
     , m_file_path(file_path) {
-	FileFooter file_footer {};
-	FileHeader file_header {};
-
-	FileHeader::Load(file_header, file_path);
-	FileFooter::Load(file_footer, file_path);
-
-	if (file_header.settings.inline_footer) {
-		// Inline footer: read slice
-		m_table_descriptor_handle =
-		    make_table_descriptor(file_path, file_footer.table_descriptor_offset, file_footer.table_descriptor_size);
-	} else {
-		// External footer file
-		m_table_descriptor_handle = make_table_descriptor(file_path.parent_path() / TABLE_DESCRIPTOR_FILE_NAME);
-	}
+	auto* footer_cache        = connection.get_footer_cache();
+	m_table_descriptor_handle = make_unique<TableDescriptorHandle>(footer_cache != nullptr ? footer_cache->Get(file_path)
+	                                                                                       : FooterCache::Load(file_path));
 }
 
 up<RowgroupReader> TableReader::operator[](const n_t rowgroup_idx) const {
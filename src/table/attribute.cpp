@@ -221,6 +221,7 @@ void TypedIngest(TypedCol<PT>& typed_column, const string& val_str, const Column
 	auto& min                = typed_column.m_stats.min;
 	auto& max                = typed_column.m_stats.max;
 	auto& is_double_castable = typed_column.m_stats.is_double_castable;
+	auto& is_constant        = typed_column.m_stats.is_constant;
 
 	if (typed_column.data.size() == 0) {
 		typed_column.m_stats.last_seen_val = TypedNull<PT>();
@@ -253,11 +254,21 @@ void TypedIngest(TypedCol<PT>& typed_column, const string& val_str, const Column
 	} else {
 		current_val = typed_column.m_stats.last_seen_val;
 	}
+	// a value that differs from the previous one starts a run
+	if (typed_column.data.empty() || current_val != typed_column.data.back()) {
+		typed_column.m_stats.n_runs++;
+	}
 	typed_column.data.push_back(current_val);
 
 	min = std::min(min, current_val);
 	max = std::max(max, current_val);
 
+	// constness and cardinality, so that preparing the rowgroup needs no pass of its own for them
+	if (is_constant && current_val != typed_column.data.front()) {
+		is_constant = false;
+	}
+	typed_column.m_stats.sketch.Add(HyperLogLog::Hash(current_val));
+
 	// is_double_castable
 	if constexpr (std::is_same_v<PT, dbl_pt>) {
 		if (typed_column.data.empty()) {
@@ -401,6 +412,7 @@ void FLSStringIngest(FLSStrColumn& fls_str_column, const string& val_str) {
 	auto& max_n_bytes_p_value = fls_str_column.m_stats.maximum_n_bytes_p_value;
 	auto& length_arr          = fls_str_column.length_arr;
 	auto& is_numeric          = fls_str_column.m_stats.is_numeric;
+	auto& is_constant         = fls_str_column.m_stats.is_constant;
 
 	auto& fsst_byte_arr   = fls_str_column.fsst_byte_arr;
 	auto& fsst_length_arr = fls_str_column.fsst_length_arr;
@@ -424,6 +436,19 @@ void FLSStringIngest(FLSStrColumn& fls_str_column, const string& val_str) {
 		is_numeric = false;
 	}
 
+	// constness and runs against the previous value, before this one is pushed
+	const bool is_equal_to_previous =
+	    !length_arr.empty() && length_arr.back() == current_val.size() &&
+	    (current_val.empty() ||
+	     std::memcmp(byte_arr.data() + ofs_arr.back(), current_val.data(), current_val.size()) == 0);
+	if (!length_arr.empty()) {
+		is_constant = is_constant && is_equal_to_previous;
+	}
+	if (!is_equal_to_previous) {
+		fls_str_column.m_stats.n_runs++;
+	}
+	fls_str_column.m_stats.sketch.Add(HyperLogLog::Hash(current_val));
+
 	// push
 	const size_t old_size = byte_arr.size(); // Save the current size
 	ofs_arr.push_back(static_cast<ofs_t>(byte_arr.size()));
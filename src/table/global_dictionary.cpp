@@ -0,0 +1,113 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/table/global_dictionary.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/table/global_dictionary.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/common/assert.hpp"
+#include "fls/cor/lyt/buf.hpp"
+#include "fls/footer/operator_token_generated.h"
+#include "fls/table/rowgroup.hpp"
+#include "fls/table/table.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * GlobalDictionary
+\*--------------------------------------------------------------------------------------------------------------------*/
+GlobalDictionary::GlobalDictionary()
+    : n_value_bytes {0}
+    , offset {0} {
+}
+
+sp<GlobalDictionary> GlobalDictionary::Build(const Table& table, const n_t col_idx) {
+	auto dictionary = make_shared<GlobalDictionary>();
+	auto& bimap      = dictionary->bimap;
+
+	// what the rowgroups would store: every dictionary with its end offsets.
+	n_t n_rowgroup_bytes {0};
+	for (const auto& rowgroup : table.m_rowgroups) {
+		const auto* str_col = std::get_if<up<FLSStrColumn>>(&rowgroup->internal_rowgroup[col_idx]);
+		if (str_col == nullptr) {
+			return nullptr;
+		}
+
+		// the values keep pointing into the rowgroups, which outlive the encoding of the table.
+		const auto& rowgroup_bimap = (*str_col)->m_stats.bimap;
+		for (n_t code {0}; code < rowgroup_bimap.size(); ++code) {
+			const fls_string_t value = rowgroup_bimap.get_key(code);
+			n_rowgroup_bytes += sizeof(ofs_t) + value.length;
+			if (!bimap.contains_key(value)) {
+				bimap.insert(value, bimap.size());
+				dictionary->n_value_bytes += value.length;
+			}
+		}
+		if (dictionary->Size() > CFG::GlobalDictionary::MAX_SIZE) {
+			return nullptr;
+		}
+	}
+
+	if (bimap.empty() || dictionary->Size() >= n_rowgroup_bytes) {
+		return nullptr;
+	}
+	return dictionary;
+}
+
+vector<sp<GlobalDictionary>> GlobalDictionary::Collect(const Table& table) {
+	vector<sp<GlobalDictionary>> dictionaries;
+	if (table.m_rowgroups.empty()) {
+		return dictionaries;
+	}
+
+	// a shared dictionary is attached to the column in every rowgroup, so the first rowgroup has them all.
+	for (const auto& column : table.m_rowgroups[0]->internal_rowgroup) {
+		if (const auto* str_col = std::get_if<up<FLSStrColumn>>(&column);
+		    str_col != nullptr && (*str_col)->m_stats.global_dictionary != nullptr) {
+			dictionaries.push_back((*str_col)->m_stats.global_dictionary);
+		}
+	}
+	return dictionaries;
+}
+
+const GlobalDictionary& GlobalDictionary::Of(const col_pt& column) {
+	const auto* str_col = std::get_if<up<FLSStrColumn>>(&column);
+	if (str_col == nullptr || (*str_col)->m_stats.global_dictionary == nullptr) {
+		throw std::runtime_error("GlobalDictionary: the column does not share a dictionary with the other rowgroups.");
+	}
+	return *(*str_col)->m_stats.global_dictionary;
+}
+
+OperatorToken GlobalDictionary::Token() const {
+	const n_t n_values = bimap.size();
+	if (n_values <= n_t {std::numeric_limits<uint8_t>::max()} + 1) {
+		return OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U08;
+	}
+	if (n_values <= n_t {std::numeric_limits<uint16_t>::max()} + 1) {
+		return OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U16;
+	}
+	return OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U32;
+}
+
+n_t GlobalDictionary::Size() const {
+	return sizeof(uint32_t) + bimap.size() * sizeof(ofs_t) + n_value_bytes;
+}
+
+void GlobalDictionary::Write(Buf& buf) const {
+	const auto n_values = static_cast<uint32_t>(bimap.size());
+	buf.Append(&n_values, sizeof(uint32_t));
+
+	ofs_t end_offset {0};
+	for (n_t code {0}; code < n_values; ++code) {
+		end_offset += bimap.get_key(code).length;
+		buf.Append(&end_offset, sizeof(ofs_t));
+	}
+	for (n_t code {0}; code < n_values; ++code) {
+		const fls_string_t value = bimap.get_key(code);
+		buf.Append(value.p, value.length);
+	}
+	FLS_ASSERT_EQUALITY(buf.Size(), Size())
+}
+
+} // namespace fastlanes
@@ -22,6 +22,7 @@
 #include "fls/std/vector.hpp"
 #include "fls/table/attribute.hpp"
 #include "fls/table/chunk.hpp"
+#include <algorithm>   // std::min, std::max
 #include <cassert>     // if you use asserts, or your macros depend on it
 #include <cstdint>     // int8_t, int16_t, int32_t, uint8_t, uint16_t, uint32_t, uint64_t
 #include <fstream>     // std::ifstream
@@ -37,7 +38,7 @@ namespace fastlanes {
 
 void init_logical_columns(const ColumnDescriptors& footer, rowgroup_pt& columns);
 
-// TODO [COPY] All return values here are copied to be put inside col_t variant. They should be moved.
+// the returned columns are empty; they are moved into the col_pt variant, never copied.
 col_pt init_logical_columns(const ColumnDescriptorT& col_descriptor) {
 	switch (static_cast<DataType>(col_descriptor.data_type)) {
 	case DataType::LIST: {
@@ -61,6 +62,8 @@ col_pt init_logical_columns(const ColumnDescriptorT& col_descriptor) {
 	}
 	case DataType::UINT8:
 		return make_unique<u08_col_t>();
+	case DataType::UINT16:
+		return make_unique<u16_col_t>();
 	case DataType::UINT32:
 		return make_unique<u32_col_t>();
 	case DataType::UINT64:
@@ -113,58 +116,104 @@ Rowgroup::Rowgroup(const RowgroupDescriptorT& footer, const Connection& connecti
     , n_tup(footer.m_n_tuples)
     , m_connection(connection)
     , capacity(connection.m_config->n_vector_per_rowgroup * CFG::VEC_SZ) {
-	init_logical_columns(footer.m_column_descriptors, internal_rowgroup);
+	init_logical_columns(m_descriptor.m_column_descriptors, internal_rowgroup);
+}
+
+Rowgroup::Rowgroup(RowgroupDescriptorT&& footer, const Connection& connection)
+    : m_descriptor(std::move(footer))
+    , n_tup(m_descriptor.m_n_tuples)
+    , m_connection(connection)
+    , capacity(connection.m_config->n_vector_per_rowgroup * CFG::VEC_SZ) {
+	init_logical_columns(m_descriptor.m_column_descriptors, internal_rowgroup);
 }
 
 up<Rowgroup> Rowgroup::Project(const vector<idx_t>& idxs, const Connection& connection) {
-	/**/
-	FLS_IMPLEMENT_THIS()
-	// auto  result = make_unique<Rowgroup>(*m_descriptor.Project(idxs), connection);
-	// idx_t c      = {0};
-	// for (const auto idx : idxs) {
-	// 	result->internal_rowgroup[c++] = std::move(internal_rowgroup[idx]);
-	// }
-	// result->n_tup = n_tup;
-	// return result;
+	vector<bool> is_projected(ColCount(), false);
+	for (const auto idx : idxs) {
+		if (idx >= ColCount()) {
+			throw std::out_of_range("column " + std::to_string(idx) + " is out of range; the rowgroup has " +
+			                        std::to_string(ColCount()) + " columns.");
+		}
+		if (is_projected[idx]) {
+			throw std::runtime_error("column " + std::to_string(idx) + " is projected twice.");
+		}
+		is_projected[idx] = true;
+	}
+
+	// the descriptors and the data of the projected columns are moved out; this rowgroup keeps the rest.
+	RowgroupDescriptorT projected_descriptor;
+	projected_descriptor.m_n_vec    = m_descriptor.m_n_vec;
+	projected_descriptor.m_size     = m_descriptor.m_size;
+	projected_descriptor.m_offset   = m_descriptor.m_offset;
+	projected_descriptor.m_n_tuples = m_descriptor.m_n_tuples;
+	projected_descriptor.m_column_descriptors.reserve(idxs.size());
+	for (n_t new_idx {0}; new_idx < idxs.size(); ++new_idx) {
+		auto& column_descriptor = m_descriptor.m_column_descriptors[idxs[new_idx]];
+		column_descriptor->idx  = new_idx;
+		projected_descriptor.m_column_descriptors.push_back(std::move(column_descriptor));
+	}
+
+	// the empty columns made by the constructor are replaced, not filled.
+	auto result = make_unique<Rowgroup>(std::move(projected_descriptor), connection);
+	for (n_t new_idx {0}; new_idx < idxs.size(); ++new_idx) {
+		result->internal_rowgroup[new_idx] = std::move(internal_rowgroup[idxs[new_idx]]);
+	}
+	result->n_tup = n_tup;
+
+	return result;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*\
  * GetStatistics
 \*--------------------------------------------------------------------------------------------------------------------*/
+// folds the value at `val_idx` into min, max, constness and runs.
+template <typename PT>
+static void Observe(TypedStats<PT>& stats, const vector<PT>& data, const n_t val_idx) {
+	const auto& current_val = data[val_idx];
+	stats.min               = std::min(stats.min, current_val);
+	stats.max               = std::max(stats.max, current_val);
+	stats.is_constant       = stats.is_constant && current_val == data[0];
+	if (val_idx == 0 || current_val != data[val_idx - 1]) {
+		stats.n_runs++;
+	}
+}
+
+// the statistics that Attribute::Ingest keeps while values are appended, gathered from the values of a rowgroup that
+// was filled otherwise, e.g. by materializing a file.
 struct get_statistics_visitor {
 
 	explicit get_statistics_visitor() = default;
 
 	template <typename PT>
 	void operator()(up<TypedCol<PT>>& typed_col) {
+		auto& stats = typed_col->m_stats;
+		for (n_t val_idx {0}; val_idx < typed_col->data.size(); ++val_idx) {
+			Observe(stats, typed_col->data, val_idx);
+			stats.sketch.Add(HyperLogLog::Hash(typed_col->data[val_idx]));
+		}
 	}
 
 	void operator()(up<FLSStrColumn>& str_col) {
 		auto& is_constant = str_col->m_stats.is_constant;
-		auto& hashtable   = str_col->m_stats.bimap;
-		auto& str_p_arr   = str_col->str_p_arr;
-		auto& length_arr  = str_col->length_arr;
+		auto& n_runs      = str_col->m_stats.n_runs;
+		auto& sketch      = str_col->m_stats.sketch;
 
-		// check constness
-		for (auto val_idx {0}; val_idx < str_col->length_arr.size(); ++val_idx) {
+		for (n_t val_idx {0}; val_idx < str_col->length_arr.size(); ++val_idx) {
+			const bool is_equal_to_previous = val_idx != 0 && Str::Equal(*str_col, *str_col, val_idx, val_idx - 1);
 			if (val_idx != 0) {
-				is_constant = is_constant && Str::Equal(*str_col, *str_col, val_idx, val_idx - 1);
+				is_constant = is_constant && is_equal_to_previous;
 			}
-
-			// into the hashtable
-			const fls_string_t current_fls_str = {str_p_arr[val_idx], length_arr[val_idx]};
-			if (!hashtable.contains_key(current_fls_str)) {
-				n_t current_idx = hashtable.size();
-				hashtable.insert(current_fls_str, current_idx);
+			if (!is_equal_to_previous) {
+				n_runs++;
 			}
-			// else {
-			// 	dict_element->repetition = dict_element->repetition + 1;
-			// }
+			sketch.Add(HyperLogLog::Hash(str_col->str_p_arr[val_idx], str_col->length_arr[val_idx]));
 		}
-		//
 	}
 
-	void operator()(up<Struct>& str_col) const {
+	void operator()(up<Struct>& struct_col) const {
+		for (auto& col : struct_col->internal_rowgroup) {
+			visit(get_statistics_visitor {}, col);
+		}
 	}
 
 	void operator()(auto& col) const {
@@ -181,37 +230,48 @@ void Rowgroup::GetStatistics() {
 /*--------------------------------------------------------------------------------------------------------------------*\
  * Finalize
 \*--------------------------------------------------------------------------------------------------------------------*/
+// one pass over the values of each column: the string pointers and the exact dictionaries the dictionary and
+// frequency encodings need. the dictionaries are sized up front by the cardinality sketch, so they never rehash.
 struct finalize_visitor {
 	explicit finalize_visitor() = default;
 
 	template <typename PT>
 	void operator()(up<TypedCol<PT>>& typed_column) const {
-		auto& min             = typed_column->m_stats.min;
-		auto& max             = typed_column->m_stats.max;
-		auto& bimap_frequency = typed_column->m_stats.bimap_frequency;
+		auto&     bimap_frequency = typed_column->m_stats.bimap_frequency;
+		const n_t n_tup           = typed_column->data.size();
 
+		bimap_frequency.reserve(std::min(typed_column->m_stats.sketch.Estimate(), n_tup));
 		// into the dictionary
-		for (n_t val_idx {0}; val_idx < typed_column->data.size(); val_idx++) {
+		for (n_t val_idx {0}; val_idx < n_tup; val_idx++) {
 			const auto current_val = typed_column->data[val_idx];
 			if (!bimap_frequency.contains_value(current_val)) {
 				n_t current_idx = bimap_frequency.size();
 				bimap_frequency.insert(current_idx, {current_val});
 			}
-
-			min = std::min(min, current_val);
-			max = std::max(max, current_val);
 		}
 	}
 
 	void operator()(up<FLSStrColumn>& str_col) const {
-		str_col->str_p_arr.resize(str_col->length_arr.size());
+		auto&     bimap = str_col->m_stats.bimap;
+		const n_t n_tup = str_col->length_arr.size();
+
+		bimap.reserve(std::min(str_col->m_stats.sketch.Estimate(), n_tup));
+		str_col->str_p_arr.resize(n_tup);
+		str_col->fls_str_arr.reserve(n_tup);
 		len_t cur_offset = 0;
-		for (idx_t val_idx {0}; val_idx < str_col->length_arr.size(); ++val_idx) {
+		for (idx_t val_idx {0}; val_idx < n_tup; ++val_idx) {
 			// set pointer into byte array
 			str_col->str_p_arr[val_idx] = &str_col->byte_arr[cur_offset];
 
 			// construct fls_string_t in‐place, no temporary
-			str_col->fls_str_arr.emplace_back(&str_col->byte_arr[cur_offset], str_col->length_arr[val_idx]);
+			const auto& current_fls_str =
+			    str_col->fls_str_arr.emplace_back(&str_col->byte_arr[cur_offset], str_col->length_arr[val_idx]);
+
+			// into the dictionary, while the bytes are in cache
+			if (!bimap.contains_key(current_fls_str)) {
+				n_t current_idx = bimap.size();
+				bimap.insert(current_fls_str, current_idx);
+			}
 
 			cur_offset += str_col->length_arr[val_idx];
 		}
@@ -260,10 +320,12 @@ struct col_cast_visitor {
 			                str_col->length_arr[val_idx]);
 			auto        casted_string = std::stol(str);
 			casted_col->data[val_idx] = static_cast<i32_pt>(casted_string);
+			Observe(casted_col->m_stats, casted_col->data, val_idx);
 			cur_offset += str_col->length_arr[val_idx];
 		}
 
-		casted_col->null_map_arr = str_col->null_map_arr;
+		casted_col->null_map_arr   = std::move(str_col->null_map_arr);
+		casted_col->m_stats.sketch = std::move(str_col->m_stats.sketch);
 
 		return casted_col;
 	}
@@ -271,46 +333,22 @@ struct col_cast_visitor {
 	col_pt operator()(up<TypedCol<PT>>& col) {
 		if constexpr (!std::is_same_v<PT, str_pt> && !std::is_same_v<PT, bol_pt>) {
 			switch (column_descriptor.data_type) {
-			case DataType::INT8: {
-				auto       casted_col = make_unique<col_i08>();
-				const auto n_tup      = col->data.size();
-				casted_col->data.resize(n_tup);
-				for (n_t val_idx {0}; val_idx < n_tup; val_idx++) {
-					casted_col->data[val_idx] = static_cast<i08_pt>(col->data[val_idx]);
-				}
-				casted_col->null_map_arr = col->null_map_arr;
-				return casted_col;
-			}
-			case DataType::INT16: {
-				auto       casted_col = make_unique<col_i16>();
-				const auto n_tup      = col->data.size();
-				casted_col->data.resize(n_tup);
-				for (n_t val_idx {0}; val_idx < n_tup; val_idx++) {
-					casted_col->data[val_idx] = static_cast<i16_pt>(col->data[val_idx]);
-				}
-				casted_col->null_map_arr = col->null_map_arr;
-				return casted_col;
-			}
-			case DataType::INT32: {
-				auto       casted_col = make_unique<col_i32>();
-				const auto n_tup      = col->data.size();
-				casted_col->data.resize(n_tup);
-				for (n_t val_idx {0}; val_idx < n_tup; val_idx++) {
-					casted_col->data[val_idx] = static_cast<i32_pt>(col->data[val_idx]);
-				}
-				casted_col->null_map_arr = col->null_map_arr;
-				return casted_col;
-			}
-			case DataType::INT64: {
-				auto       casted_col = make_unique<col_i64>();
-				const auto n_tup      = col->data.size();
-				casted_col->data.resize(n_tup);
-				for (n_t val_idx {0}; val_idx < n_tup; val_idx++) {
-					casted_col->data[val_idx] = static_cast<i64_pt>(col->data[val_idx]);
-				}
-				casted_col->null_map_arr = col->null_map_arr;
-				return casted_col;
-			}
+			case DataType::INT8:
+				return CastTo<i08_pt>(*col);
+			case DataType::INT16:
+				return CastTo<i16_pt>(*col);
+			case DataType::INT32:
+				return CastTo<i32_pt>(*col);
+			case DataType::INT64:
+				return CastTo<i64_pt>(*col);
+			case DataType::UINT8:
+				return CastTo<u08_pt>(*col);
+			case DataType::UINT16:
+				return CastTo<u16_pt>(*col);
+			case DataType::UINT32:
+				return CastTo<u32_pt>(*col);
+			case DataType::UINT64:
+				return CastTo<u64_pt>(*col);
 			default:
 				FLS_UNREACHABLE();
 			}
@@ -319,6 +357,25 @@ struct col_cast_visitor {
 		}
 	}
 
+	// the source column is replaced by the result: its null map is moved over and its data is freed right away, so
+	// only one column is held twice at a time. min, max, constness and runs are taken while the values are written;
+	// casts keep distinct values distinct, so the sketch is carried over.
+	template <typename TARGET_PT, typename PT>
+	static col_pt CastTo(TypedCol<PT>& col) {
+		auto       casted_col = make_unique<TypedCol<TARGET_PT>>();
+		const auto n_tup      = col.data.size();
+		casted_col->data.resize(n_tup);
+		for (n_t val_idx {0}; val_idx < n_tup; val_idx++) {
+			casted_col->data[val_idx] = static_cast<TARGET_PT>(col.data[val_idx]);
+			Observe(casted_col->m_stats, casted_col->data, val_idx);
+		}
+		casted_col->null_map_arr    = std::move(col.null_map_arr);
+		casted_col->m_stats.n_nulls = col.m_stats.n_nulls;
+		casted_col->m_stats.sketch  = std::move(col.m_stats.sketch);
+		vector<PT>().swap(col.data);
+		return casted_col;
+	}
+
 	col_pt operator()(std::monostate&) {
 		FLS_UNREACHABLE();
 	}
@@ -351,6 +408,21 @@ DataType getSmallestSignedType(PT min, PT max) {
 	}
 }
 
+// unsigned columns stay unsigned: a value above the signed maximum of its width would otherwise wrap around.
+template <typename PT>
+DataType getSmallestUnsignedType(PT max) {
+	if (max <= std::numeric_limits<uint8_t>::max()) {
+		return DataType::UINT8;
+	}
+	if (max <= std::numeric_limits<uint16_t>::max()) {
+		return DataType::UINT16;
+	}
+	if (max <= std::numeric_limits<uint32_t>::max()) {
+		return DataType::UINT32;
+	}
+	return DataType::UINT64;
+}
+
 void cast(rowgroup_pt& rowgroup, ColumnDescriptorT& column_descriptor) {
 	switch (column_descriptor.data_type) {
 	case DataType::BOOLEAN:
@@ -368,12 +440,17 @@ void cast(rowgroup_pt& rowgroup, ColumnDescriptorT& column_descriptor) {
 			          }
 		          },
 		          [&]<typename PT>(up<TypedCol<PT>>& typed_col) {
+			          // a decimal is ingested as its unscaled integer, already in an int64 column.
 			          if (column_descriptor.data_type == DataType::DECIMAL) {
 				          column_descriptor.data_type = DataType::INT64;
-				          should_be_cast              = true;
 			          }
 
-			          auto casted_data_type = getSmallestSignedType<PT>(typed_col->m_stats.min, typed_col->m_stats.max);
+			          DataType casted_data_type;
+			          if constexpr (std::is_unsigned_v<PT>) {
+				          casted_data_type = getSmallestUnsignedType<PT>(typed_col->m_stats.max);
+			          } else {
+				          casted_data_type = getSmallestSignedType<PT>(typed_col->m_stats.min, typed_col->m_stats.max);
+			          }
 			          if (casted_data_type != column_descriptor.data_type) {
 				          should_be_cast              = true;
 				          column_descriptor.data_type = casted_data_type;
@@ -462,17 +539,22 @@ void Rowgroup::FillMissingValues(const n_t how_many_to_fill) {
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
-void cast_from_logical_to_physical(const Rowgroup& old_table, Rowgroup& new_table) {
+// the source rowgroup is consumed: a column of the same type is moved, any other is converted and then freed.
+void cast_from_logical_to_physical(Rowgroup& old_table, Rowgroup& new_table) {
 	for (idx_t idx {0}; idx < old_table.ColCount(); ++idx) {
 		visit( //
 		    overloaded {
 		        [](auto&, auto&) { throw std::runtime_error("Incompatible type"); },
-		        [&]<typename LT, typename PT>(const up<TypedCol<LT>>& source_col, up<TypedCol<PT>>& target_col) {
-			        if constexpr (is_numeric<LT>() && is_numeric<PT>()) {
+		        [&]<typename LT, typename PT>(up<TypedCol<LT>>& source_col, up<TypedCol<PT>>& target_col) {
+			        if constexpr (std::is_same_v<LT, PT>) {
+				        target_col->data         = std::move(source_col->data);
+				        target_col->null_map_arr = std::move(source_col->null_map_arr);
+			        } else if constexpr (is_numeric<LT>() && is_numeric<PT>()) {
+				        target_col->data.reserve(target_col->data.size() + source_col->data.size());
 				        for (const auto item : source_col->data) {
-					        auto tmp = item;
-					        target_col->data.push_back(static_cast<PT>(tmp));
+					        target_col->data.push_back(static_cast<PT>(item));
 				        }
+				        vector<LT>().swap(source_col->data);
 			        }
 		        }},
 		    old_table.internal_rowgroup[idx],
@@ -647,6 +729,66 @@ n_t Rowgroup::VecCount() const {
 	return (n_tup + CFG::VEC_SZ - 1) / CFG::VEC_SZ;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * MemorySize
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct memory_size_visitor {
+	template <typename PT>
+	n_t operator()(const up<TypedCol<PT>>& typed_col) const {
+		n_t size = typed_col->data.size() * sizeof(PT) + typed_col->null_map_arr.size();
+		if constexpr (std::is_same_v<PT, str_pt>) {
+			for (const auto& value : typed_col->data) {
+				size += value.size();
+			}
+		}
+		return size;
+	}
+
+	n_t operator()(const up<FLSStrColumn>& str_col) const {
+		return str_col->byte_arr.size() + str_col->fsst_byte_arr.size() + str_col->ofs_arr.size() * sizeof(ofs_t) +
+		       (str_col->length_arr.size() + str_col->fsst_length_arr.size()) * sizeof(len_t) +
+		       str_col->null_map_arr.size();
+	}
+
+	n_t operator()(const up<List>& list_col) const {
+		return list_col->ofs_arr.size() * sizeof(ofs_t) + list_col->length_arr.size() * sizeof(len_t) +
+		       list_col->null_map_arr.size() + visit(*this, list_col->child);
+	}
+
+	n_t operator()(const up<Struct>& struct_col) const {
+		n_t size = struct_col->null_map_arr.size();
+		for (const auto& col : struct_col->internal_rowgroup) {
+			size += visit(*this, col);
+		}
+		return size;
+	}
+
+	n_t operator()(const std::monostate&) const {
+		return 0;
+	}
+};
+
+n_t Rowgroup::MemorySize() const {
+	n_t size {0};
+	for (const auto& col : internal_rowgroup) {
+		size += visit(memory_size_visitor {}, col);
+	}
+	return size;
+}
+
+void Rowgroup::FitCapacity(const n_t n_ingested_tuples) {
+	const n_t byte_budget = m_connection.m_config->rowgroup_byte_budget;
+	if (byte_budget == 0 || n_ingested_tuples == 0) {
+		return;
+	}
+
+	// the encoded size is only known once the wizard chose the encodings, so the budget is spent on the size in memory.
+	const n_t n_bytes_per_vector = std::max<n_t>(1, MemorySize() * CFG::VEC_SZ / n_ingested_tuples);
+	const n_t n_vectors =
+	    std::clamp<n_t>(byte_budget / n_bytes_per_vector, CFG::RowGroup::MIN_N_VECTORS, CFG::RowGroup::MAX_N_VECTORS);
+	capacity = n_vectors * CFG::VEC_SZ;
+}
+
 n_t Rowgroup::ColCount() const {
 	/**/
 	return m_descriptor.m_column_descriptors.size();
@@ -0,0 +1,179 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/table/shared_symbol_table.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/table/shared_symbol_table.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/common/assert.hpp"
+#include "fls/cor/lyt/buf.hpp"
+#include "fls/footer/operator_token_generated.h"
+#include "fls/primitive/fsst/fsst.hpp"
+#include "fls/primitive/fsst12/fsst12.hpp"
+#include "fls/table/rowgroup.hpp"
+#include "fls/table/table.hpp"
+#include <algorithm> // std::max
+#include <stdexcept>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+// appends about `n_values` strings of `str_col`, evenly spread over it.
+static void
+Sample(const FLSStrColumn& str_col, const n_t n_values, vector<len_t>& lengths, vector<uint8_t*>& strings) {
+	const n_t n_tuples = str_col.fsst_length_arr.size();
+	const n_t stride   = std::max<n_t>(1, n_tuples / std::max<n_t>(1, n_values));
+	for (n_t value_idx {0}; value_idx < n_tuples; value_idx += stride) {
+		lengths.push_back(str_col.fsst_length_arr[value_idx]);
+		strings.push_back(str_col.fsst_str_p_arr[value_idx]);
+	}
+}
+
+static sp<SharedSymbolTable> Train(const bool is_fsst12, vector<len_t>& lengths, vector<uint8_t*>& strings) {
+	auto symbol_table = make_shared<SharedSymbolTable>(is_fsst12, lengths.size(), lengths.data(), strings.data());
+	symbol_table->sample_ratio = symbol_table->CompressionRatio(lengths.size(), lengths.data(), strings.data());
+	return symbol_table;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * SharedSymbolTable
+\*--------------------------------------------------------------------------------------------------------------------*/
+SharedSymbolTable::SharedSymbolTable(const bool a_is_fsst12,
+                                     const n_t  n_strings,
+                                     len_t*     lengths,
+                                     uint8_t**  strings)
+    : is_fsst12(a_is_fsst12)
+    , fsst_encoder(nullptr)
+    , fsst12_encoder(nullptr)
+    , sample_ratio {1.0}
+    , offset {0} {
+	if (is_fsst12) {
+		fsst12_encoder = fsst12_create(n_strings, lengths, strings, CFG::FSST::NULL_TERMINATED);
+		header.resize(FSST12_MAXHEADER);
+		header.resize(fsst12_export(fsst12_encoder, header.data()));
+	} else {
+		fsst_encoder = fsst_create(n_strings, lengths, strings, CFG::FSST::NULL_TERMINATED);
+		header.resize(FSST_MAXHEADER);
+		header.resize(fsst_export(fsst_encoder, header.data()));
+	}
+}
+
+SharedSymbolTable::~SharedSymbolTable() {
+	if (fsst_encoder != nullptr) {
+		fsst_destroy(fsst_encoder);
+	}
+	if (fsst12_encoder != nullptr) {
+		fsst12_destroy(fsst12_encoder);
+	}
+}
+
+bool SharedSymbolTable::Assign(const Table& table, const n_t col_idx, const bool is_fsst12) {
+	vector<FLSStrColumn*> str_cols;
+	for (const auto& rowgroup : table.m_rowgroups) {
+		const auto* str_col = std::get_if<up<FLSStrColumn>>(&rowgroup->internal_rowgroup[col_idx]);
+		if (str_col == nullptr) {
+			return false;
+		}
+		str_cols.push_back(str_col->get());
+	}
+	if (str_cols.empty()) {
+		return false;
+	}
+
+	// the sample of every rowgroup is kept apart, so a rowgroup is checked against the table on its own part.
+	const n_t n_values_per_rowgroup = CFG::SharedSymbolTable::N_SAMPLE_VALUES / str_cols.size();
+
+	vector<len_t>    lengths;
+	vector<uint8_t*> strings;
+	vector<n_t>      sample_begin_arr;
+	for (const auto* str_col : str_cols) {
+		sample_begin_arr.push_back(lengths.size());
+		Sample(*str_col, n_values_per_rowgroup, lengths, strings);
+	}
+	sample_begin_arr.push_back(lengths.size());
+
+	auto symbol_table = Train(is_fsst12, lengths, strings);
+	for (n_t rowgroup_idx {0}; rowgroup_idx < str_cols.size(); ++rowgroup_idx) {
+		const n_t  begin = sample_begin_arr[rowgroup_idx];
+		const n_t  n     = sample_begin_arr[rowgroup_idx + 1] - begin;
+		const auto ratio = symbol_table->CompressionRatio(n, lengths.data() + begin, strings.data() + begin);
+
+		// the values drifted away from what the table was trained on: the rowgroup trains a table of its own.
+		if (n != 0 && ratio > symbol_table->sample_ratio * (1 + CFG::SharedSymbolTable::MAX_DRIFT)) {
+			const auto&      str_col = *str_cols[rowgroup_idx];
+			vector<len_t>    rowgroup_lengths;
+			vector<uint8_t*> rowgroup_strings;
+			Sample(str_col, CFG::SharedSymbolTable::N_SAMPLE_VALUES, rowgroup_lengths, rowgroup_strings);
+			symbol_table = Train(is_fsst12, rowgroup_lengths, rowgroup_strings);
+		}
+		str_cols[rowgroup_idx]->m_stats.symbol_table = symbol_table;
+	}
+	return true;
+}
+
+vector<sp<SharedSymbolTable>> SharedSymbolTable::Collect(const Table& table) {
+	vector<sp<SharedSymbolTable>> symbol_tables;
+	for (const auto& rowgroup : table.m_rowgroups) {
+		for (const auto& column : rowgroup->internal_rowgroup) {
+			const auto* str_col = std::get_if<up<FLSStrColumn>>(&column);
+			if (str_col == nullptr || (*str_col)->m_stats.symbol_table == nullptr) {
+				continue;
+			}
+			// the rowgroups that share a table follow each other, but the columns interleave.
+			const auto& symbol_table = (*str_col)->m_stats.symbol_table;
+			if (std::ranges::find(symbol_tables, symbol_table) == symbol_tables.end()) {
+				symbol_tables.push_back(symbol_table);
+			}
+		}
+	}
+	return symbol_tables;
+}
+
+const SharedSymbolTable& SharedSymbolTable::Of(const col_pt& column) {
+	const auto* str_col = std::get_if<up<FLSStrColumn>>(&column);
+	if (str_col == nullptr || (*str_col)->m_stats.symbol_table == nullptr) {
+		throw std::runtime_error("SharedSymbolTable: the column does not share a symbol table with other rowgroups.");
+	}
+	return *(*str_col)->m_stats.symbol_table;
+}
+
+OperatorToken SharedSymbolTable::Token() const {
+	return is_fsst12 ? OperatorToken::EXP_SHARED_FSST12_DELTA : OperatorToken::EXP_SHARED_FSST_DELTA;
+}
+
+n_t SharedSymbolTable::Size() const {
+	return header.size();
+}
+
+void SharedSymbolTable::Write(Buf& buf) const {
+	buf.Append(header.data(), header.size());
+	FLS_ASSERT_EQUALITY(buf.Size(), Size())
+}
+
+double SharedSymbolTable::CompressionRatio(const n_t n_strings, len_t* lengths, uint8_t** strings) const {
+	n_t n_bytes {0};
+	for (n_t string_idx {0}; string_idx < n_strings; ++string_idx) {
+		n_bytes += lengths[string_idx];
+	}
+	if (n_bytes == 0) {
+		return 1.0;
+	}
+
+	// fsst12 codes take 12 bits, so a string can grow to twice its size; fsst escapes double it at most.
+	vector<uint8_t> out(n_bytes * 4 + 16);
+	vector<ofs_t>   out_offsets(n_strings + 1);
+	n_t             n_compressed {0};
+	if (is_fsst12) {
+		n_compressed = fsst12_helper::fsst12_compress(
+		    fsst12_encoder, n_strings, lengths, strings, out.size(), out.data(), out_offsets.data());
+	} else {
+		n_compressed = fsst_helper::fsst_compress(
+		    fsst_encoder, n_strings, lengths, strings, out.size(), out.data(), out_offsets.data());
+	}
+	FLS_ASSERT_E(n_compressed, n_strings)
+
+	return static_cast<double>(out_offsets[n_compressed]) / static_cast<double>(n_bytes);
+}
+
+} // namespace fastlanes
@@ -0,0 +1,285 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/table/sorter.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/table/sorter.hpp"
+#include "fls/common/common.hpp" // for FLS_UNREACHABLE
+#include "fls/reader/scan_scheduler.hpp"
+#include "fls/std/string.hpp"
+#include "fls/std/variant.hpp"
+#include "fls/table/rowgroup.hpp"
+#include <algorithm> // std::stable_sort, std::ranges::max_element
+#include <bit>       // std::bit_width
+#include <cmath>     // std::isnan
+#include <numeric> // std::iota
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility> // std::move
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+// a strict weak order also for floating point values: NaNs go last.
+template <typename PT>
+static bool Less(const PT& left, const PT& right) {
+	if constexpr (std::is_floating_point_v<PT>) {
+		if (std::isnan(left) || std::isnan(right)) {
+			return !std::isnan(left) && std::isnan(right);
+		}
+	}
+	return left < right;
+}
+
+static bool IsNull(const BaseCol& column, const n_t row_idx) {
+	return row_idx < column.null_map_arr.size() && column.null_map_arr[row_idx] != 0;
+}
+
+// the dense rank of each of the first `n_rows` values of `column`: equal values share a rank and nulls rank lowest.
+template <typename LESS_T>
+static void Rank(const BaseCol& column, const n_t n_rows, const LESS_T& less, vector<uint32_t>& ranks) {
+	const auto compare = [&](const uint32_t left, const uint32_t right) {
+		const bool is_left_null  = IsNull(column, left);
+		const bool is_right_null = IsNull(column, right);
+		if (is_left_null || is_right_null) {
+			return is_left_null && !is_right_null;
+		}
+		return less(left, right);
+	};
+
+	vector<uint32_t> order(n_rows);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), compare);
+
+	ranks.resize(n_rows);
+	uint32_t rank {0};
+	for (n_t order_idx {0}; order_idx < n_rows; ++order_idx) {
+		if (order_idx != 0 && compare(order[order_idx - 1], order[order_idx])) {
+			++rank;
+		}
+		ranks[order[order_idx]] = rank;
+	}
+}
+
+static std::string_view View(const byte_arr_t& bytes, const ofs_t offset, const len_t length) {
+	return {reinterpret_cast<const char*>(bytes.data()) + offset, length};
+}
+
+struct rank_visitor {
+	const n_t         n_rows;
+	vector<uint32_t>& ranks;
+
+	template <typename PT>
+	void operator()(const up<TypedCol<PT>>& typed_col) const {
+		const auto& data = typed_col->data;
+		Rank(
+		    *typed_col,
+		    n_rows,
+		    [&](const uint32_t left, const uint32_t right) { return Less(data[left], data[right]); },
+		    ranks);
+	}
+
+	void operator()(const up<FLSStrColumn>& str_col) const {
+		const auto& bytes   = str_col->byte_arr;
+		const auto& ofs_arr = str_col->ofs_arr;
+		const auto& lengths = str_col->length_arr;
+		Rank(
+		    *str_col,
+		    n_rows,
+		    [&](const uint32_t left, const uint32_t right) {
+			    return View(bytes, ofs_arr[left], lengths[left]) < View(bytes, ofs_arr[right], lengths[right]);
+		    },
+		    ranks);
+	}
+
+	void operator()(const auto&) const {
+		throw std::runtime_error("RowgroupSorter: only flat columns can be sort keys.");
+	}
+};
+
+// interleaves the ranks of all keys bit by bit, the most significant bit of the first key first. every key is
+// stretched or cut to the same number of bits, so a key with few distinct values weighs as much as one with many.
+static vector<uint64_t> ZOrderKeys(const vector<vector<uint32_t>>& ranks, const n_t n_rows) {
+	const n_t n_keys = ranks.size();
+	const n_t n_bits = std::min<n_t>(32, 64 / n_keys);
+
+	vector<uint64_t> z_keys(n_rows, 0);
+	for (n_t key_idx {0}; key_idx < n_keys; ++key_idx) {
+		const auto& key_ranks = ranks[key_idx];
+		const n_t   rank_bits = std::bit_width(*std::ranges::max_element(key_ranks));
+		for (n_t row_idx {0}; row_idx < n_rows; ++row_idx) {
+			uint64_t rank = key_ranks[row_idx];
+			rank          = rank_bits < n_bits ? rank << (n_bits - rank_bits) : rank >> (rank_bits - n_bits);
+			for (n_t bit_idx {0}; bit_idx < n_bits; ++bit_idx) {
+				z_keys[row_idx] |= ((rank >> bit_idx) & 1) << (bit_idx * n_keys + (n_keys - 1 - key_idx));
+			}
+		}
+	}
+	return z_keys;
+}
+
+// moves the values to their sorted positions, the ones past the permutation stay where they are.
+template <typename T>
+static void Gather(vector<T>& values, const vector<uint32_t>& permutation) {
+	if (values.empty()) {
+		return;
+	}
+
+	vector<T> gathered;
+	gathered.reserve(values.size());
+	for (const auto row_idx : permutation) {
+		gathered.push_back(std::move(values[row_idx]));
+	}
+	for (n_t row_idx {permutation.size()}; row_idx < values.size(); ++row_idx) {
+		gathered.push_back(std::move(values[row_idx]));
+	}
+	values.swap(gathered);
+}
+
+// the same for strings stored back to back, whose offsets follow from their lengths.
+static void GatherStrings(byte_arr_t& bytes, length_arr_t& lengths, const vector<uint32_t>& permutation) {
+	vector<ofs_t> offsets(lengths.size());
+	for (n_t row_idx {1}; row_idx < lengths.size(); ++row_idx) {
+		offsets[row_idx] = offsets[row_idx - 1] + lengths[row_idx - 1];
+	}
+
+	byte_arr_t   gathered_bytes;
+	length_arr_t gathered_lengths;
+	gathered_bytes.reserve(bytes.size());
+	gathered_lengths.reserve(lengths.size());
+	const auto append = [&](const n_t row_idx) {
+		const auto begin = bytes.begin() + offsets[row_idx];
+		gathered_bytes.insert(gathered_bytes.end(), begin, begin + lengths[row_idx]);
+		gathered_lengths.push_back(lengths[row_idx]);
+	};
+	for (const auto row_idx : permutation) {
+		append(row_idx);
+	}
+	for (n_t row_idx {permutation.size()}; row_idx < lengths.size(); ++row_idx) {
+		append(row_idx);
+	}
+	bytes.swap(gathered_bytes);
+	lengths.swap(gathered_lengths);
+}
+
+// applies the permutation to a whole column, and counts its runs again, as they were counted in ingest order.
+struct gather_visitor {
+	const vector<uint32_t>& permutation;
+
+	template <typename PT>
+	void operator()(up<TypedCol<PT>>& typed_col) const {
+		Gather(typed_col->data, permutation);
+		Gather(typed_col->null_map_arr, permutation);
+
+		const auto& data   = typed_col->data;
+		auto&       n_runs = typed_col->m_stats.n_runs;
+		n_runs             = 0;
+		for (n_t row_idx {0}; row_idx < permutation.size(); ++row_idx) {
+			if (row_idx == 0 || data[row_idx] != data[row_idx - 1]) {
+				n_runs++;
+			}
+		}
+	}
+
+	void operator()(up<FLSStrColumn>& str_col) const {
+		Gather(str_col->null_map_arr, permutation);
+		GatherStrings(str_col->byte_arr, str_col->length_arr, permutation);
+		GatherStrings(str_col->fsst_byte_arr, str_col->fsst_length_arr, permutation);
+
+		const auto& bytes   = str_col->byte_arr;
+		const auto& lengths = str_col->length_arr;
+		auto&       ofs_arr = str_col->ofs_arr;
+		auto&       n_runs  = str_col->m_stats.n_runs;
+		n_runs              = 0;
+
+		ofs_t offset {0};
+		for (n_t row_idx {0}; row_idx < ofs_arr.size(); ++row_idx) {
+			ofs_arr[row_idx] = offset;
+			offset += lengths[row_idx];
+			if (row_idx < permutation.size() &&
+			    (row_idx == 0 || View(bytes, ofs_arr[row_idx], lengths[row_idx]) !=
+			                         View(bytes, ofs_arr[row_idx - 1], lengths[row_idx - 1]))) {
+				n_runs++;
+			}
+		}
+	}
+
+	void operator()(up<Struct>& struct_col) const {
+		Gather(struct_col->null_map_arr, permutation);
+		for (auto& child : struct_col->internal_rowgroup) {
+			visit(*this, child);
+		}
+	}
+
+	void operator()(up<List>&) const {
+		throw std::runtime_error("RowgroupSorter: rowgroups with list columns cannot be sorted.");
+	}
+
+	void operator()(auto&) const {
+		FLS_UNREACHABLE()
+	}
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * RowgroupSorter
+\*--------------------------------------------------------------------------------------------------------------------*/
+void RowgroupSorter::Sort(Rowgroup&            rowgroup,
+                          const vector<idx_t>& key_idxs,
+                          const SortOrder      order,
+                          const n_t            n_threads) {
+	if (key_idxs.empty() || rowgroup.n_tup <= 1) {
+		return;
+	}
+
+	const auto permutation = Permutation(rowgroup, key_idxs, order, n_threads);
+	ParallelFor(n_threads, rowgroup.internal_rowgroup.size(), [&](const n_t col_idx) {
+		visit(gather_visitor {permutation}, rowgroup.internal_rowgroup[col_idx]);
+	});
+}
+
+vector<uint32_t> RowgroupSorter::Permutation(const Rowgroup&      rowgroup,
+                                             const vector<idx_t>& key_idxs,
+                                             const SortOrder      order,
+                                             const n_t            n_threads) {
+	for (const auto key_idx : key_idxs) {
+		if (key_idx >= rowgroup.internal_rowgroup.size()) {
+			throw std::runtime_error("RowgroupSorter: sort key " + std::to_string(key_idx) + " is out of range.");
+		}
+	}
+
+	const n_t                n_rows = rowgroup.n_tup;
+	vector<vector<uint32_t>> ranks(key_idxs.size());
+	ParallelFor(n_threads, key_idxs.size(), [&](const n_t key_idx) {
+		visit(rank_visitor {n_rows, ranks[key_idx]}, rowgroup.internal_rowgroup[key_idxs[key_idx]]);
+	});
+
+	vector<uint32_t> permutation(n_rows);
+	std::iota(permutation.begin(), permutation.end(), 0);
+	switch (order) {
+	case SortOrder::LEXICOGRAPHIC: {
+		std::stable_sort(permutation.begin(), permutation.end(), [&](const uint32_t left, const uint32_t right) {
+			for (const auto& key_ranks : ranks) {
+				if (key_ranks[left] != key_ranks[right]) {
+					return key_ranks[left] < key_ranks[right];
+				}
+			}
+			return false;
+		});
+		break;
+	}
+	case SortOrder::Z_ORDER: {
+		const auto z_keys = ZOrderKeys(ranks, n_rows);
+		std::stable_sort(permutation.begin(), permutation.end(), [&](const uint32_t left, const uint32_t right) {
+			return z_keys[left] < z_keys[right];
+		});
+		break;
+	}
+	default:
+		FLS_UNREACHABLE()
+	}
+	return permutation;
+}
+
+} // namespace fastlanes
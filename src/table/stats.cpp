@@ -16,7 +16,9 @@ TypedStats<PT>::TypedStats()
     , max {std::numeric_limits<PT>::lowest()} //
     , last_seen_val(0)                        // NOLINT
     , n_nulls(0)
-    , is_double_castable(false) {
+    , is_double_castable(false)
+    , is_constant(true)
+    , n_runs(0) {
 }
 
 template <typename PT>
@@ -24,9 +26,7 @@ TypedStats<PT>::~TypedStats() = default;
 
 template <typename PT>
 bool TypedStats<PT>::IsConstant() {
-	FLS_ASSERT_FALSE(bimap_frequency.empty())
-
-	return bimap_frequency.size() == 1;
+	return is_constant;
 };
 
 FLS_ALL_CTS(TypedStats)
@@ -35,7 +35,8 @@ FlsStringStats::FlsStringStats()
     : is_constant {true}
     , maximum_n_bytes_p_value(std::numeric_limits<n_t>::lowest())
     , is_numeric(false)
-    , last_seen_val("NULL") {
+    , last_seen_val("NULL")
+    , n_runs(0) {
 }
 
 } // namespace fastlanes
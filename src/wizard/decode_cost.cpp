@@ -0,0 +1,93 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/wizard/decode_cost.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/wizard/decode_cost.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/footer/operator_token_generated.h"
+#include "fls/std/vector.hpp"
+#include <iterator> // std::size
+#include <string_view>
+
+namespace fastlanes {
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * helpers
+\*--------------------------------------------------------------------------------------------------------------------*/
+struct EncodingFamily {
+	std::string_view name_part;
+	double           cycles_per_value;
+};
+
+// the first family whose name part occurs in the name of a token decides its cost, so more specific names come first.
+static constexpr EncodingFamily ENCODING_FAMILIES[] = {
+    {"FSST12_DICT", 6.0},  // decompresses every value from the dictionary
+    {"FSST_DICT", 4.0},    //
+    {"FSST12", 12.0},      // 12-bit codes, decoded byte by byte
+    {"FSST", 8.0},         //
+    {"CROSS_RLE", 2.0},    // runs across vectors, resolved per value
+    {"RLE", 1.0},          // run index unpacked, then a gather of the run values
+    {"ALP_RD", 1.5},       // two unpacked parts glued back together
+    {"GALP", 1.0},         //
+    {"ALP", 0.6},          // one unpack and a fused multiply per value
+    {"DICT", 0.8},         // index unpacked, then a gather of the dictionary
+    {"FREQUENCY", 0.8},    // the most frequent value plus exceptions
+    {"BOOLEAN", 0.1},      // eight bits spread into eight bytes per multiply
+    {"DELTA2", 0.6},       // unpack and two prefix sums in one pass
+    {"DELTA", 0.5},        // unpack and a prefix sum
+    {"FFOR", 0.3},         // one unpack
+    {"UNCOMPRESSED", 0.1}, // a copy
+    {"CONSTANT", 0.05},    //
+    {"EQUAL", 0.05},       //
+    {"NULL", 0.05},        //
+};
+// patches are applied to the decoded vector afterwards.
+static constexpr double PATCH_CYCLES_PER_VALUE = 0.3;
+// string values are copied out one by one.
+static constexpr double STRING_CYCLES_PER_VALUE = 1.0;
+// tokens outside every family.
+static constexpr double DEFAULT_CYCLES_PER_VALUE = 1.0;
+
+static double Calibrate(const OperatorToken token) {
+	const std::string_view name = EnumNameOperatorToken(token);
+
+	double cycles_per_value = DEFAULT_CYCLES_PER_VALUE;
+	for (const auto& family : ENCODING_FAMILIES) {
+		if (name.find(family.name_part) != std::string_view::npos) {
+			cycles_per_value = family.cycles_per_value;
+			break;
+		}
+	}
+	if (name.find("SLPATCH") != std::string_view::npos) {
+		cycles_per_value += PATCH_CYCLES_PER_VALUE;
+	}
+	if (name.find("_STR") != std::string_view::npos || name.find("FSST") != std::string_view::npos) {
+		cycles_per_value += STRING_CYCLES_PER_VALUE;
+	}
+	return cycles_per_value;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * DecodeCost
+\*--------------------------------------------------------------------------------------------------------------------*/
+double DecodeCost::CyclesPerValue(const OperatorToken token) {
+	static const auto table = [] {
+		const auto n_tokens = static_cast<n_t>(std::size(EnumValuesOperatorToken()));
+
+		vector<double> result(n_tokens);
+		for (n_t token_idx {0}; token_idx < n_tokens; ++token_idx) {
+			result[token_idx] = Calibrate(static_cast<OperatorToken>(token_idx));
+		}
+		return result;
+	}();
+
+	const auto token_idx = static_cast<n_t>(token);
+	return token_idx < table.size() ? table[token_idx] : DEFAULT_CYCLES_PER_VALUE;
+}
+
+double DecodeCost::ScanCycles(const OperatorToken token, const n_t size, const n_t n_values) {
+	return static_cast<double>(size) / CFG::CostModel::BYTES_PER_CYCLE +
+	       static_cast<double>(n_values) * CyclesPerValue(token);
+}
+
+} // namespace fastlanes
@@ -0,0 +1,108 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// src/wizard/schema_cache.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/wizard/schema_cache.hpp"
+#include "fls/cfg/cfg.hpp"
+#include "fls/footer/column_descriptor_generated.h"
+#include "fls/footer/operator_token_generated.h"
+#include "fls/footer/rowgroup_descriptor_generated.h"
+#include "fls/footer/table_descriptor_generated.h"
+#include <utility> // std::move
+
+namespace fastlanes {
+
+// encodings that refer to data stored elsewhere in the file they were written to, so they mean nothing in another file.
+static bool IsFileBound(const OperatorToken token) {
+	switch (token) {
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U32:
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U16:
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U08:
+	case OperatorToken::EXP_SHARED_FSST_DELTA:
+	case OperatorToken::EXP_SHARED_FSST12_DELTA:
+		return true;
+	default:
+		return false;
+	}
+}
+
+const SchemaCache::Decision* SchemaCache::Find(const string& name, const DataType data_type) const {
+	const auto it = m_decisions.find(name);
+	if (it == m_decisions.end() || it->second.data_type != data_type) {
+		return nullptr;
+	}
+	return &it->second;
+}
+
+void SchemaCache::Store(const string& name, Decision decision) {
+	m_decisions.insert_or_assign(name, std::move(decision));
+}
+
+void SchemaCache::Seed(const TableDescriptorT& table_descriptor) {
+	if (table_descriptor.m_rowgroup_descriptors.empty()) {
+		return;
+	}
+
+	const auto& rowgroup_descriptor = *table_descriptor.m_rowgroup_descriptors.back();
+	for (const auto& column_descriptor : rowgroup_descriptor.m_column_descriptors) {
+		Seed(*column_descriptor, rowgroup_descriptor);
+	}
+}
+
+void SchemaCache::Seed(const ColumnDescriptorT& column_descriptor, const RowgroupDescriptorT& rowgroup_descriptor) {
+	for (const auto& child_column_descriptor : column_descriptor.children) {
+		Seed(*child_column_descriptor, rowgroup_descriptor);
+	}
+
+	const auto& encoding_rpn = column_descriptor.encoding_rpn;
+	const n_t   n_values     = rowgroup_descriptor.m_n_vec * CFG::VEC_SZ;
+	if (encoding_rpn == nullptr || encoding_rpn->operator_tokens.size() != 1 || n_values == 0) {
+		return;
+	}
+
+	// the estimate the wizard chose by, if the file kept it; the size it was written with otherwise.
+	const auto token = encoding_rpn->operator_tokens.front();
+	if (IsFileBound(token)) {
+		return;
+	}
+
+	n_t size = column_descriptor.total_size;
+	for (const auto& expr : column_descriptor.expr_space) {
+		if (expr->operator_token == token) {
+			size = expr->size;
+		}
+	}
+
+	Store(column_descriptor.name,
+	      {column_descriptor.data_type,
+	       token,
+	       encoding_rpn->operand_tokens,
+	       static_cast<double>(size) / static_cast<double>(n_values)});
+}
+
+void SchemaCache::Clear() {
+	m_decisions.clear();
+}
+
+n_t SchemaCache::Size() const {
+	return m_decisions.size();
+}
+
+void SchemaCache::RecordHit() {
+	++m_n_hits;
+}
+
+void SchemaCache::RecordMiss() {
+	++m_n_misses;
+}
+
+n_t SchemaCache::Hits() const {
+	return m_n_hits;
+}
+
+n_t SchemaCache::Misses() const {
+	return m_n_misses;
+}
+
+} // namespace fastlanes
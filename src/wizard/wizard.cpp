@@ -4,10 +4,12 @@
 // src/wizard/wizard.cpp
 // ────────────────────────────────────────────────────────
 #include "fls/wizard/wizard.hpp"
+#include "alp/config.hpp"
 #include "fls/cfg/cfg.hpp"
 #include "fls/common/alias.hpp" // for n_t, up, idx_t, make_unique
 #include "fls/common/assert.hpp"
 #include "fls/common/common.hpp" // for FLS_UNREACHABLE
+#include "fls/common/hyperloglog.hpp"
 #include "fls/common/string.hpp"
 #include "fls/connection.hpp"           // for Connector
 #include "fls/expression/data_type.hpp" // for DataType, get_physical_type
@@ -19,19 +21,26 @@
 #include "fls/footer/operator_token_generated.h"
 #include "fls/footer/rowgroup_descriptor.hpp" // for ColumnMetadata, RowgroupDescriptor
 #include "fls/footer/table_descriptor.hpp"
+#include "fls/reader/scan_scheduler.hpp"
 #include "fls/std/unordered_map.hpp"
 #include "fls/std/variant.hpp"    // for visit
 #include "fls/std/vector.hpp"     // for vector
+#include "fls/table/global_dictionary.hpp"
+#include "fls/table/shared_symbol_table.hpp"
 #include "fls/table/rowgroup.hpp" // for Rowgroup, TypedCol (ptr ...
+#include "fls/table/table.hpp"
+#include "fls/wizard/decode_cost.hpp"
 #include "fls/wizard/sampling_layout.hpp"
+#include "fls/wizard/schema_cache.hpp"
 #include <algorithm> // std::min_element
+#include <cmath>     // std::abs
 #include <cstdint>   // int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t
 #include <cstring>
 #include <limits>        // std::numeric_limits
 #include <memory>        // for unique_ptr, make_unique
 #include <type_traits>   // std::conditional_t
 #include <unordered_map> // std::unordered_map
-#include <utility>       // std::move
+#include <utility>       // std::move, std::pair
 #include <variant>
 
 namespace fastlanes {
@@ -128,6 +137,18 @@ struct constant_visitor {
 				column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_CONSTANT_U08);
 				break;
 			}
+			case DataType::UINT16: {
+				column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_CONSTANT_U16);
+				break;
+			}
+			case DataType::UINT32: {
+				column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_CONSTANT_U32);
+				break;
+			}
+			case DataType::UINT64: {
+				column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_CONSTANT_U64);
+				break;
+			}
 			case DataType::BOOLEAN: {
 				column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_CONSTANT_BOOL);
 				break;
@@ -284,37 +305,155 @@ bool Equal(const col_pt& first_col, const col_pt& second_col) {
 	return true;
 }
 
-void equality_check(const rowgroup_pt& rowgroup, vector<up<ColumnDescriptorT>>& column_descriptors) {
-	const auto n_col = rowgroup.size();
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Column Fingerprints
+\*--------------------------------------------------------------------------------------------------------------------*/
+// equal columns have the same value hash, and columns that map 1:1 onto each other the same mapping hash: it is taken
+// over the null map and over the order in which each value first appears. the cross-column checks therefore only run
+// the exact comparison on columns whose hashes match, instead of on every pair.
+struct ColumnFingerprint {
+	///! typed and string columns; the others never equal or map onto another column.
+	bool is_comparable {false};
+	///! false if the null map does not cover every value, e.g. after FillMissingValues; the mapping hash is then unset
+	///! and such columns are compared exactly with every candidate.
+	bool     is_mapping_hashed {false};
+	uint64_t value_hash {0};
+	uint64_t mapping_hash {0};
+
+	[[nodiscard]] bool MayMap1t1(const ColumnFingerprint& other) const {
+		return is_comparable && other.is_comparable &&
+		       (!is_mapping_hashed || !other.is_mapping_hashed || mapping_hash == other.mapping_hash);
+	}
+};
 
-	// brute_force
-	for (n_t first_col_idx {0}; first_col_idx < n_col; first_col_idx++) {
-		for (n_t second_col_idx {first_col_idx + 1}; second_col_idx < n_col; second_col_idx++) {
-			auto& column_descriptor = column_descriptors[second_col_idx];
-			if (IsDetermined(*column_descriptor)) {
-				continue;
+static uint64_t Combine(const uint64_t hash, const uint64_t value_hash) {
+	return HyperLogLog::Hash(hash ^ value_hash);
+}
+
+template <typename KEY_T>
+static uint64_t MappingCode(unordered_map<KEY_T, n_t>& codes, const KEY_T& key, const bool is_null) {
+	// the 1:1 checks skip nulls, so a null only has to sit at the same row.
+	if (is_null) {
+		return std::numeric_limits<uint64_t>::max();
+	}
+	return codes.try_emplace(key, codes.size()).first->second;
+}
+
+struct fingerprint_visitor {
+	template <typename PT>
+	ColumnFingerprint operator()(const up<TypedCol<PT>>& typed_col) const {
+		const n_t         n_rows = typed_col->data.size();
+		ColumnFingerprint fingerprint {true, typed_col->null_map_arr.size() == n_rows, n_rows, n_rows};
+
+		unordered_map<PT, n_t> codes;
+		for (n_t row_idx {0}; row_idx < n_rows; ++row_idx) {
+			const auto& value = typed_col->data[row_idx];
+			if constexpr (std::is_floating_point_v<PT>) {
+				// -0.0 and 0.0 compare equal, so they must hash the same.
+				fingerprint.value_hash = Combine(fingerprint.value_hash, HyperLogLog::Hash(value + PT {0}));
+			} else {
+				fingerprint.value_hash = Combine(fingerprint.value_hash, HyperLogLog::Hash(value));
+			}
+			if (fingerprint.is_mapping_hashed) {
+				fingerprint.mapping_hash = Combine(fingerprint.mapping_hash,
+				                                   MappingCode(codes, value, typed_col->null_map_arr[row_idx] != 0));
 			}
+		}
+		return fingerprint;
+	}
 
-			if (const auto is_equal = Equal(rowgroup[first_col_idx], rowgroup[second_col_idx]); is_equal) {
-				switch (column_descriptor->data_type) {
-				case DataType::DOUBLE:
-				case DataType::FLS_STR:
-				case DataType::INT64:
-				case DataType::INT32:
-				case DataType::INT16:
-				case DataType::FLOAT:
-				case DataType::INT8: {
-					column_descriptor->encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_EQUAL);
-					column_descriptor->encoding_rpn->operand_tokens.emplace_back(first_col_idx);
-					break;
-				}
-				case DataType::INVALID:
-				default: {
-					FLS_UNREACHABLE();
-				}
-				}
+	ColumnFingerprint operator()(const up<FLSStrColumn>& str_col) const {
+		const n_t         n_rows = str_col->length_arr.size();
+		ColumnFingerprint fingerprint {true, str_col->null_map_arr.size() == n_rows, n_rows, n_rows};
+
+		unordered_map<fls_string_t, n_t> codes;
+		for (n_t row_idx {0}; row_idx < n_rows; ++row_idx) {
+			const fls_string_t value {str_col->str_p_arr[row_idx], str_col->length_arr[row_idx]};
+			fingerprint.value_hash =
+			    Combine(fingerprint.value_hash, HyperLogLog::Hash(str_col->str_p_arr[row_idx], value.length));
+			if (fingerprint.is_mapping_hashed) {
+				fingerprint.mapping_hash = Combine(fingerprint.mapping_hash,
+				                                   MappingCode(codes, value, str_col->null_map_arr[row_idx] != 0));
 			}
 		}
+		return fingerprint;
+	}
+
+	ColumnFingerprint operator()(const auto&) const {
+		return {};
+	}
+};
+
+vector<ColumnFingerprint> fingerprint_columns(const rowgroup_pt& rowgroup, const n_t n_threads) {
+	vector<ColumnFingerprint> fingerprints(rowgroup.size());
+	ParallelFor(n_threads, rowgroup.size(), [&](const n_t col_idx) {
+		fingerprints[col_idx] = visit(fingerprint_visitor {}, rowgroup[col_idx]);
+		// only columns of the same type are equal.
+		fingerprints[col_idx].value_hash = Combine(fingerprints[col_idx].value_hash, rowgroup[col_idx].index());
+	});
+	return fingerprints;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+void equality_check(const rowgroup_pt&               rowgroup,
+                    vector<up<ColumnDescriptorT>>&   column_descriptors,
+                    const vector<ColumnFingerprint>& fingerprints,
+                    const n_t                        n_threads) {
+	const auto n_col = rowgroup.size();
+
+	// columns of the same value hash, in column order.
+	std::unordered_map<uint64_t, vector<n_t>> buckets;
+	for (n_t col_idx {0}; col_idx < n_col; col_idx++) {
+		if (fingerprints[col_idx].is_comparable) {
+			buckets[fingerprints[col_idx].value_hash].push_back(col_idx);
+		}
+	}
+
+	// every column is equal to the first earlier column of its bucket that compares equal, if any.
+	vector<n_t> equal_col_idxs(n_col, n_col);
+	ParallelFor(n_threads, n_col, [&](const n_t second_col_idx) {
+		if (!fingerprints[second_col_idx].is_comparable || IsDetermined(*column_descriptors[second_col_idx])) {
+			return;
+		}
+		for (const n_t first_col_idx : buckets.at(fingerprints[second_col_idx].value_hash)) {
+			if (first_col_idx >= second_col_idx) {
+				return;
+			}
+			if (Equal(rowgroup[first_col_idx], rowgroup[second_col_idx])) {
+				equal_col_idxs[second_col_idx] = first_col_idx;
+				return;
+			}
+		}
+	});
+
+	for (n_t second_col_idx {0}; second_col_idx < n_col; second_col_idx++) {
+		const n_t first_col_idx = equal_col_idxs[second_col_idx];
+		if (first_col_idx == n_col) {
+			continue;
+		}
+
+		auto& column_descriptor = column_descriptors[second_col_idx];
+		switch (column_descriptor->data_type) {
+		case DataType::DOUBLE:
+		case DataType::FLS_STR:
+		case DataType::INT64:
+		case DataType::INT32:
+		case DataType::INT16:
+		case DataType::FLOAT:
+		case DataType::INT8:
+		case DataType::UINT8:
+		case DataType::UINT16:
+		case DataType::UINT32:
+		case DataType::UINT64: {
+			column_descriptor->encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_EQUAL);
+			column_descriptor->encoding_rpn->operand_tokens.emplace_back(first_col_idx);
+			break;
+		}
+		case DataType::INVALID:
+		default: {
+			FLS_UNREACHABLE();
+		}
+		}
 	}
 }
 
@@ -409,6 +548,14 @@ vector<OperatorToken>& get_dict_encoding_pool(n_t index_data_type) {
 		    OperatorToken::EXP_FSST12_DICT_STR_FFOR_SLPATCH_U32, //
 		};
 
+		static vector<OperatorToken> U64_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U64_FFOR_U32, //
+		};
+
+		static vector<OperatorToken> U32_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U32_FFOR_U32, //
+		};
+
 		if constexpr (std::is_same_v<PT, fls_string_t>) {
 			return FLS_STR_POOL;
 		} else if constexpr (std::is_same_v<PT, i64_pt>) {
@@ -423,6 +570,10 @@ vector<OperatorToken>& get_dict_encoding_pool(n_t index_data_type) {
 			return DBL_DICT_POOL;
 		} else if constexpr (std::is_same_v<PT, flt_pt>) {
 			return DBL_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u64_pt>) {
+			return U64_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u32_pt>) {
+			return U32_DICT_POOL;
 		} else {
 			FLS_UNREACHABLE()
 		}
@@ -465,6 +616,19 @@ vector<OperatorToken>& get_dict_encoding_pool(n_t index_data_type) {
 		    OperatorToken::EXP_FSST_DICT_STR_FFOR_SLPATCH_U16,   //
 		    OperatorToken::EXP_FSST12_DICT_STR_FFOR_SLPATCH_U16, //
 		};
+
+		static vector<OperatorToken> U64_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U64_FFOR_U16, //
+		};
+
+		static vector<OperatorToken> U32_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U32_FFOR_U16, //
+		};
+
+		static vector<OperatorToken> U16_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U16_FFOR_U16, //
+		};
+
 		if constexpr (std::is_same_v<PT, fls_string_t>) {
 			return FLS_STR_POOL;
 		} else if constexpr (std::is_same_v<PT, i64_pt>) {
@@ -479,6 +643,12 @@ vector<OperatorToken>& get_dict_encoding_pool(n_t index_data_type) {
 			return DBL_DICT_POOL;
 		} else if constexpr (std::is_same_v<PT, flt_pt>) {
 			return FLT_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u64_pt>) {
+			return U64_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u32_pt>) {
+			return U32_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u16_pt>) {
+			return U16_DICT_POOL;
 		} else {
 			FLS_UNREACHABLE()
 		}
@@ -528,6 +698,18 @@ vector<OperatorToken>& get_dict_encoding_pool(n_t index_data_type) {
 		    // TODO
 		};
 
+		static vector<OperatorToken> U64_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U64_FFOR_U08, //
+		};
+
+		static vector<OperatorToken> U32_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U32_FFOR_U08, //
+		};
+
+		static vector<OperatorToken> U16_DICT_POOL = {
+		    OperatorToken::EXP_DICT_U16_FFOR_U08, //
+		};
+
 		if constexpr (std::is_same_v<PT, fls_string_t>) {
 			return FLS_STR_POOL;
 		} else if constexpr (std::is_same_v<PT, i64_pt>) {
@@ -544,6 +726,12 @@ vector<OperatorToken>& get_dict_encoding_pool(n_t index_data_type) {
 			return FLT_DICT_POOL;
 		} else if constexpr (std::is_same_v<PT, u08_pt>) {
 			return U08_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u16_pt>) {
+			return U16_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u32_pt>) {
+			return U32_DICT_POOL;
+		} else if constexpr (std::is_same_v<PT, u64_pt>) {
+			return U64_DICT_POOL;
 		} else {
 			FLS_UNREACHABLE()
 		}
@@ -565,7 +753,7 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 	switch (data_typ) {
 	case DataType::BOOLEAN: {
 		static vector<OperatorToken> BOOLEAN_POOL = {
-		    OperatorToken::EXP_VALIDITY_MASK,
+		    OperatorToken::EXP_BOOLEAN,
 		};
 		return BOOLEAN_POOL;
 	}
@@ -574,6 +762,7 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 		    OperatorToken::EXP_RLE_I64_SLPATCH_U16,
 		    OperatorToken::EXP_FFOR_SLPATCH_I64,
 		    OperatorToken::EXP_DELTA_I64,
+		    OperatorToken::EXP_DELTA2_I64,
 		    OperatorToken::EXP_RLE_I64_U16,
 		    OperatorToken::EXP_UNCOMPRESSED_I64,
 		    OperatorToken::EXP_FFOR_I64,
@@ -585,6 +774,7 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 		    OperatorToken::EXP_RLE_I32_SLPATCH_U16,
 		    OperatorToken::EXP_FFOR_SLPATCH_I32,
 		    OperatorToken::EXP_DELTA_I32,
+		    OperatorToken::EXP_DELTA2_I32,
 		    OperatorToken::EXP_RLE_I32_U16,
 		    OperatorToken::EXP_UNCOMPRESSED_I32,
 		    OperatorToken::EXP_FFOR_I32,
@@ -596,6 +786,7 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 		    OperatorToken::EXP_RLE_I16_SLPATCH_U16,
 		    OperatorToken::EXP_FFOR_SLPATCH_I16,
 		    OperatorToken::EXP_DELTA_I16,
+		    OperatorToken::EXP_DELTA2_I16,
 		    OperatorToken::EXP_RLE_I16_U16,
 		    OperatorToken::EXP_UNCOMPRESSED_I16,
 		    OperatorToken::EXP_FFOR_I16,
@@ -626,6 +817,30 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 		    OperatorToken::EXP_RLE_U08_U16,
 		};
 
+		static vector<OperatorToken> U64_POOL = {
+		    OperatorToken::EXP_RLE_U64_U16,
+		    OperatorToken::EXP_FFOR_SLPATCH_U64,
+		    OperatorToken::EXP_DELTA_U64,
+		    OperatorToken::EXP_UNCOMPRESSED_U64,
+		    OperatorToken::EXP_FFOR_U64, //
+		};
+
+		static vector<OperatorToken> U32_POOL = {
+		    OperatorToken::EXP_RLE_U32_U16,
+		    OperatorToken::EXP_FFOR_SLPATCH_U32,
+		    OperatorToken::EXP_DELTA_U32,
+		    OperatorToken::EXP_UNCOMPRESSED_U32,
+		    OperatorToken::EXP_FFOR_U32, //
+		};
+
+		static vector<OperatorToken> U16_POOL = {
+		    OperatorToken::EXP_RLE_U16_U16,
+		    OperatorToken::EXP_FFOR_SLPATCH_U16,
+		    OperatorToken::EXP_DELTA_U16,
+		    OperatorToken::EXP_UNCOMPRESSED_U16,
+		    OperatorToken::EXP_FFOR_U16, //
+		};
+
 		static vector<OperatorToken> DBL_POOL = {
 		    OperatorToken::EXP_RLE_DBL_SLPATCH_U16,
 		    OperatorToken::EXP_RLE_DBL_U16,
@@ -674,6 +889,12 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 			return FLT_POOL;
 		} else if constexpr (std::is_same_v<PT, u08_pt>) {
 			return U08_POOL;
+		} else if constexpr (std::is_same_v<PT, u16_pt>) {
+			return U16_POOL;
+		} else if constexpr (std::is_same_v<PT, u32_pt>) {
+			return U32_POOL;
+		} else if constexpr (std::is_same_v<PT, u64_pt>) {
+			return U64_POOL;
 		} else {
 			FLS_UNREACHABLE()
 		}
@@ -682,11 +903,22 @@ vector<OperatorToken>& get_pool(const DataType data_typ) {
 	}
 } // namespace fastlanes
 
+n_t GetSampleSize(const RowgroupDescriptorT& footer, const Connection& con) {
+	auto sample_size = con.get_sample_size();
+
+	if (sample_size == 0 || sample_size > footer.m_n_vec) {
+		sample_size = footer.m_n_vec;
+	}
+	return sample_size;
+}
+
+///! the estimated size of the rowgroup encoded with `token`, extrapolated from the first `sample_size` vectors of the
+///! sampling layout.
 n_t TryExpr(const rowgroup_pt&       col,
             const ColumnDescriptorT& column_descriptor,
             const OperatorToken&     token,
             RowgroupDescriptorT&     footer,
-            const Connection&        con) {
+            const n_t                sample_size) {
 	n_t size {0};
 
 	// interpret
@@ -696,12 +928,6 @@ n_t TryExpr(const rowgroup_pt&       col,
 
 	const auto physical_expr_up = Interpreter::Encoding::Interpret(new_column_descriptor, col, state);
 
-	auto sample_size = con.get_sample_size();
-
-	if (sample_size == 0 || sample_size > footer.m_n_vec) {
-		sample_size = footer.m_n_vec;
-	}
-
 	const n_t*  vec_idxs;
 	vector<n_t> dyn_layout; // keeps data alive if we fall back
 
@@ -731,7 +957,9 @@ n_t TryExpr(const rowgroup_pt&       col,
 	return size;
 }
 
-OperatorToken ChooseBestExpr(const vector<up<ExpressionResultT>>& options) {
+OperatorToken ChooseBestExpr(const vector<up<ExpressionResultT>>& options,
+                             const OptimizeFor                    optimize_for,
+                             const n_t                            n_values) {
 	FLS_ASSERT_FALSE(options.empty()); // make sure to add the semicolon
 
 	// Find the element with the smallest 'size' member
@@ -739,6 +967,25 @@ OperatorToken ChooseBestExpr(const vector<up<ExpressionResultT>>& options) {
 	    options.begin(), options.end(), [](const up<ExpressionResultT>& a, const up<ExpressionResultT>& b) {
 		    return a->size < b->size;
 	    });
+	if (optimize_for == OptimizeFor::SIZE) {
+		return (*bestIt)->operator_token;
+	}
+
+	// the fastest to scan, among all options or, for BALANCED, among those close to the smallest.
+	const double max_size = optimize_for == OptimizeFor::BALANCED
+	                            ? static_cast<double>((*bestIt)->size) * (1.0 + CFG::CostModel::BALANCED_SIZE_SLACK)
+	                            : std::numeric_limits<double>::max();
+	double best_scan_cycles = DecodeCost::ScanCycles((*bestIt)->operator_token, (*bestIt)->size, n_values);
+	for (auto it = options.begin(); it != options.end(); ++it) {
+		if (static_cast<double>((*it)->size) > max_size) {
+			continue;
+		}
+		if (const double scan_cycles = DecodeCost::ScanCycles((*it)->operator_token, (*it)->size, n_values);
+		    scan_cycles < best_scan_cycles) {
+			best_scan_cycles = scan_cycles;
+			bestIt           = it;
+		}
+	}
 
 	// Dereference the unique_ptr to get the operator_token
 	return (*bestIt)->operator_token;
@@ -771,43 +1018,354 @@ bool IsDictionaryChoosingRequired(const ColumnDescriptorT& column_descriptor) {
 	return false;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Candidate Search
+\*--------------------------------------------------------------------------------------------------------------------*/
+// what the statistics of a column tell about the encodings worth trying.
+struct ColumnShape {
+	n_t n_values {0};
+	n_t n_runs {0};
+	n_t n_unique_values {0};
+};
+
+ColumnShape GetColumnShape(const col_pt& col) {
+	ColumnShape shape;
+	visit(overloaded {
+	          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+		          const auto& stats = typed_col->m_stats;
+		          shape             = {typed_col->data.size(), stats.n_runs, stats.bimap_frequency.size()};
+	          },
+	          [&](const up<FLSStrColumn>& str_col) {
+		          shape = {str_col->length_arr.size(), str_col->m_stats.n_runs, str_col->m_stats.bimap.size()};
+	          },
+	          [](const auto&) {},
+	      },
+	      col);
+	return shape;
+}
+
+bool IsRle(const OperatorToken token) {
+	switch (token) {
+	case OperatorToken::EXP_RLE_I64_U16:
+	case OperatorToken::EXP_RLE_I32_U16:
+	case OperatorToken::EXP_RLE_I16_U16:
+	case OperatorToken::EXP_RLE_DBL_U16:
+	case OperatorToken::EXP_RLE_STR_U16:
+	case OperatorToken::EXP_RLE_I64_SLPATCH_U16:
+	case OperatorToken::EXP_RLE_I32_SLPATCH_U16:
+	case OperatorToken::EXP_RLE_I16_SLPATCH_U16:
+	case OperatorToken::EXP_RLE_DBL_SLPATCH_U16:
+	case OperatorToken::EXP_RLE_STR_SLPATCH_U16:
+	case OperatorToken::EXP_RLE_I08_U16:
+	case OperatorToken::EXP_RLE_I08_SLPATCH_U16:
+	case OperatorToken::EXP_CROSS_RLE_I08:
+	case OperatorToken::EXP_CROSS_RLE_I16:
+	case OperatorToken::EXP_CROSS_RLE_I32:
+	case OperatorToken::EXP_CROSS_RLE_I64:
+	case OperatorToken::EXP_CROSS_RLE_DBL:
+	case OperatorToken::EXP_CROSS_RLE_STR:
+	case OperatorToken::EXP_RLE_FLT_U16:
+	case OperatorToken::EXP_RLE_FLT_SLPATCH_U16:
+	case OperatorToken::EXP_CROSS_RLE_FLT:
+	case OperatorToken::EXP_CROSS_RLE_U08:
+	case OperatorToken::EXP_RLE_U08_SLPATCH_U16:
+	case OperatorToken::EXP_RLE_U08_U16:
+	case OperatorToken::EXP_RLE_U16_U16:
+	case OperatorToken::EXP_RLE_U32_U16:
+	case OperatorToken::EXP_RLE_U64_U16:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool IsDict(const OperatorToken token) {
+	switch (token) {
+	case OperatorToken::EXP_DICT_I64_FFOR_U32:
+	case OperatorToken::EXP_DICT_I64_FFOR_U16:
+	case OperatorToken::EXP_DICT_I64_FFOR_U08:
+	case OperatorToken::EXP_DICT_I32_FFOR_U32:
+	case OperatorToken::EXP_DICT_I32_FFOR_U16:
+	case OperatorToken::EXP_DICT_I32_FFOR_U08:
+	case OperatorToken::EXP_DICT_I16_FFOR_U16:
+	case OperatorToken::EXP_DICT_I16_FFOR_U08:
+	case OperatorToken::EXP_DICT_DBL_FFOR_U32:
+	case OperatorToken::EXP_DICT_DBL_FFOR_U16:
+	case OperatorToken::EXP_DICT_DBL_FFOR_U08:
+	case OperatorToken::EXP_DICT_STR_FFOR_U32:
+	case OperatorToken::EXP_DICT_STR_FFOR_U16:
+	case OperatorToken::EXP_DICT_STR_FFOR_U08:
+	case OperatorToken::EXP_FSST_DICT_STR_FFOR_U32:
+	case OperatorToken::EXP_FSST_DICT_STR_FFOR_U16:
+	case OperatorToken::EXP_FSST_DICT_STR_FFOR_U08:
+	case OperatorToken::EXP_FSST12_DICT_STR_FFOR_U32:
+	case OperatorToken::EXP_FSST12_DICT_STR_FFOR_U16:
+	case OperatorToken::EXP_FSST12_DICT_STR_FFOR_U08:
+	case OperatorToken::EXP_DICT_I64_U32:
+	case OperatorToken::EXP_DICT_I64_U16:
+	case OperatorToken::EXP_DICT_I64_U08:
+	case OperatorToken::EXP_DICT_I32_U32:
+	case OperatorToken::EXP_DICT_I32_U16:
+	case OperatorToken::EXP_DICT_I32_U08:
+	case OperatorToken::EXP_DICT_I16_U16:
+	case OperatorToken::EXP_DICT_I16_U08:
+	case OperatorToken::EXP_DICT_DBL_U32:
+	case OperatorToken::EXP_DICT_DBL_U16:
+	case OperatorToken::EXP_DICT_DBL_U08:
+	case OperatorToken::EXP_DICT_STR_U32:
+	case OperatorToken::EXP_DICT_STR_U16:
+	case OperatorToken::EXP_DICT_STR_U08:
+	case OperatorToken::EXP_DICT_I64_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_DICT_I64_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_I64_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_DICT_I32_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_DICT_I32_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_I32_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_DICT_I16_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_I16_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_DICT_DBL_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_DICT_DBL_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_DBL_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_DICT_STR_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_DICT_STR_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_STR_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_FSST_DICT_STR_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_FSST_DICT_STR_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_FSST_DICT_STR_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_FSST12_DICT_STR_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_FSST12_DICT_STR_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_FSST12_DICT_STR_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_FSST_DICT_STR_U32:
+	case OperatorToken::EXP_FSST_DICT_STR_U16:
+	case OperatorToken::EXP_FSST_DICT_STR_U08:
+	case OperatorToken::EXP_FSST12_DICT_STR_U32:
+	case OperatorToken::EXP_FSST12_DICT_STR_U16:
+	case OperatorToken::EXP_FSST12_DICT_STR_U08:
+	case OperatorToken::EXP_DICT_I08_U08:
+	case OperatorToken::EXP_DICT_I08_FFOR_U08:
+	case OperatorToken::EXP_DICT_I08_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_DICT_FLT_FFOR_U16:
+	case OperatorToken::EXP_DICT_FLT_FFOR_U08:
+	case OperatorToken::EXP_DICT_FLT_FFOR_SLPATCH_U08:
+	case OperatorToken::EXP_DICT_FLT_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_FLT_FFOR_U32:
+	case OperatorToken::EXP_DICT_FLT_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_DICT_U08_U08:
+	case OperatorToken::EXP_DICT_FLT_U08:
+	case OperatorToken::EXP_DICT_U16_FFOR_U16:
+	case OperatorToken::EXP_DICT_U16_FFOR_U08:
+	case OperatorToken::EXP_DICT_U32_FFOR_U32:
+	case OperatorToken::EXP_DICT_U32_FFOR_U16:
+	case OperatorToken::EXP_DICT_U32_FFOR_U08:
+	case OperatorToken::EXP_DICT_U64_FFOR_U32:
+	case OperatorToken::EXP_DICT_U64_FFOR_U16:
+	case OperatorToken::EXP_DICT_U64_FFOR_U08:
+	case OperatorToken::EXP_DICT_U16_U16:
+	case OperatorToken::EXP_DICT_U16_U08:
+	case OperatorToken::EXP_DICT_U32_U32:
+	case OperatorToken::EXP_DICT_U32_U16:
+	case OperatorToken::EXP_DICT_U32_U08:
+	case OperatorToken::EXP_DICT_U64_U32:
+	case OperatorToken::EXP_DICT_U64_U16:
+	case OperatorToken::EXP_DICT_U64_U08:
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U32:
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U16:
+	case OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U08:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// whether `token` cannot win on a column of this shape: runs of about one value leave RLE nothing to collapse, and a
+// dictionary of mostly unique values is as large as the column itself.
+bool IsPrunable(const OperatorToken token, const ColumnShape& shape) {
+	if (shape.n_values == 0 || shape.n_runs == 0) {
+		return false;
+	}
+
+	const double avg_run_length = static_cast<double>(shape.n_values) / static_cast<double>(shape.n_runs);
+	if (IsRle(token) && avg_run_length < CFG::CCC::MIN_AVG_RUN_LENGTH_FOR_RLE) {
+		return true;
+	}
+
+	const double uniqueness_ratio = static_cast<double>(shape.n_unique_values) / static_cast<double>(shape.n_values);
+	if (IsDict(token) && uniqueness_ratio >= CFG::CCC::MAX_UNIQUENESS_RATIO_FOR_DICTIONARY_ENCODING) {
+		return true;
+	}
+	return false;
+}
+
+bool IsAlp(const OperatorToken token) {
+	return token == OperatorToken::EXP_ALP_DBL || token == OperatorToken::EXP_ALP_FLT;
+}
+
+bool IsAlpRd(const OperatorToken token) {
+	return token == OperatorToken::EXP_ALP_RD_DBL || token == OperatorToken::EXP_ALP_RD_FLT;
+}
+
+// evaluates the candidates on a growing prefix of the sample and keeps the better half after every round, so most of
+// them are only tried on a vector or a few; the survivors are evaluated on the whole sample and kept in expr_space.
+// candidates that are not `is_halved` are all evaluated on the whole sample.
+template <typename PT>
+void SearchCandidates(const rowgroup_pt&    rowgroup,
+                      ColumnDescriptorT&    column_descriptor,
+                      vector<OperatorToken> candidates,
+                      const bool            is_halved,
+                      RowgroupDescriptorT&  footer,
+                      const Connection&     fls) {
+	const n_t  sample_size  = GetSampleSize(footer, fls);
+	const auto optimize_for = fls.get_optimize_for();
+
+	for (n_t n_sample_vecs {CFG::SAMPLER::HALVING_FIRST_SAMPLE_SIZE};
+	     is_halved && candidates.size() > CFG::SAMPLER::HALVING_MIN_CANDIDATES && n_sample_vecs < sample_size;
+	     n_sample_vecs = 2 * n_sample_vecs + 1) {
+		// TryExpr scales the block-based segments of a sample of `n_sample_vecs` vectors by `n_sample_vecs / m_n_vec`,
+		// so the value count every size of this round is compared against is scaled the same way.
+		const n_t n_values = n_sample_vecs * CFG::VEC_SZ * n_sample_vecs / footer.m_n_vec;
+
+		vector<std::pair<double, OperatorToken>> ranked;
+		n_t                                      alp_size {std::numeric_limits<n_t>::max()};
+		for (const auto token : candidates) {
+			const n_t size = TryExpr(rowgroup, column_descriptor, token, footer, n_sample_vecs);
+			ranked.emplace_back(optimize_for == OptimizeFor::SPEED ? DecodeCost::ScanCycles(token, size, n_values)
+			                                                       : static_cast<double>(size),
+			                    token);
+			if (IsAlp(token)) {
+				alp_size = size;
+			}
+		}
+		std::stable_sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		// ALP_RD keeps the bits below its cutting limit verbatim, so ALP beats it once it is smaller than those.
+		const n_t alp_rd_min_size = n_values * (8 * sizeof(PT) - alp::config::CUTTING_LIMIT) / 8;
+
+		candidates.clear();
+		for (n_t rank {0}; rank < (ranked.size() + 1) / 2; ++rank) {
+			if (IsAlpRd(ranked[rank].second) && alp_size <= alp_rd_min_size) {
+				continue;
+			}
+			candidates.push_back(ranked[rank].second);
+		}
+	}
+
+	for (const auto token : candidates) {
+		auto res = std::make_unique<ExpressionResultT>();
+
+		res->operator_token = token;
+		res->size           = TryExpr(rowgroup, column_descriptor, token, footer, sample_size);
+
+		column_descriptor.expr_space.push_back(std::move(res));
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Schema Cache
+\*--------------------------------------------------------------------------------------------------------------------*/
+// the size per value of the column encoded with `token`, estimated from the few vectors a cached decision is
+// validated on; decisions are stored and validated with the same estimate, so they compare like with like.
+double ValidationBytesPerValue(const rowgroup_pt&       rowgroup,
+                               const ColumnDescriptorT& column_descriptor,
+                               const OperatorToken      token,
+                               RowgroupDescriptorT&     footer,
+                               const Connection&        fls) {
+	const n_t sample_size = std::min(CFG::SchemaCache::VALIDATION_SAMPLE_SIZE, GetSampleSize(footer, fls));
+	const n_t size        = TryExpr(rowgroup, column_descriptor, token, footer, sample_size);
+	return static_cast<double>(size) / static_cast<double>(footer.m_n_vec * CFG::VEC_SZ);
+}
+
+// encodes the column as it was the last time, if that encoding is still among its candidates, refers to the same
+// columns, and compresses about as well as it did. the candidates guard correctness: a dictionary index type or a
+// forced pool the column outgrew is never reused.
+bool ReuseDecision(const rowgroup_pt&           rowgroup,
+                   ColumnDescriptorT&           column_descriptor,
+                   const vector<OperatorToken>& candidates,
+                   RowgroupDescriptorT&         footer,
+                   const Connection&            fls,
+                   SchemaCache&                 schema_cache) {
+	const auto* decision = schema_cache.Find(column_descriptor.name, column_descriptor.data_type);
+	if (decision == nullptr || decision->operand_tokens != column_descriptor.encoding_rpn->operand_tokens ||
+	    std::find(candidates.begin(), candidates.end(), decision->operator_token) == candidates.end()) {
+		schema_cache.RecordMiss();
+		return false;
+	}
+
+	const auto   token           = decision->operator_token;
+	const double bytes_per_value = ValidationBytesPerValue(rowgroup, column_descriptor, token, footer, fls);
+	if (std::abs(bytes_per_value - decision->bytes_per_value) >
+	    CFG::SchemaCache::MAX_SIZE_DRIFT * decision->bytes_per_value) {
+		schema_cache.RecordMiss();
+		return false;
+	}
+
+	auto res            = std::make_unique<ExpressionResultT>();
+	res->operator_token = token;
+	res->size           = static_cast<n_t>(bytes_per_value * static_cast<double>(footer.m_n_vec * CFG::VEC_SZ));
+	column_descriptor.expr_space.push_back(std::move(res));
+	column_descriptor.encoding_rpn->operator_tokens.emplace_back(token);
+
+	schema_cache.RecordHit();
+	return true;
+}
+
 template <typename PT>
 void TypedDecide(const rowgroup_pt&   rowgroup,
                  ColumnDescriptorT&   column_descriptor,
                  RowgroupDescriptorT& footer,
                  const Connection&    fls) {
 
-	auto evaluate_expressions = [&](const auto& operator_token_list) {
-		for (const auto& expr : operator_token_list) {
-			n_t  size = TryExpr(rowgroup, column_descriptor, expr, footer, fls);
-			auto res  = std::make_unique<ExpressionResultT>();
-
-			res->operator_token = expr;
-			res->size           = size;
-
-			column_descriptor.expr_space.push_back(std::move(res));
-		}
-	};
-
+	vector<OperatorToken> candidates;
+	bool                  is_free_choice {false};
 	if (fls.is_forced_schema_pool()) {
-		evaluate_expressions(fls.get_forced_schema_pool());
+		candidates = fls.get_forced_schema_pool();
 	} else if (IsDictionaryEncodingRequired(column_descriptor)) {
 		column_descriptor.encoding_rpn->operator_tokens.clear();
 		const n_t index_type = column_descriptor.encoding_rpn->operand_tokens.back();
 		column_descriptor.encoding_rpn->operand_tokens.clear();
-		evaluate_expressions(get_dict_encoding_pool<PT>(index_type));
+		candidates = get_dict_encoding_pool<PT>(index_type);
 	} else if (IsDictionaryChoosingRequired(column_descriptor)) {
 		column_descriptor.encoding_rpn->operator_tokens.clear();
 		const n_t index_type = column_descriptor.encoding_rpn->operand_tokens.back();
 		column_descriptor.encoding_rpn->operand_tokens.pop_back();
-		evaluate_expressions(get_dict_pool<PT>(index_type));
+		candidates = get_dict_pool<PT>(index_type);
 	} else {
-		const n_t index_type = static_cast<n_t>(FindBestDataTypeForColumn(rowgroup[column_descriptor.idx]));
-		evaluate_expressions(get_dict_encoding_pool<PT>(index_type));
-		evaluate_expressions(get_pool<PT>(column_descriptor.data_type));
+		// only the free choice is pruned and halved; the pools above are what the column has to be encoded with, so
+		// every one of their encodings is evaluated on the whole sample.
+		is_free_choice = true;
+
+		const n_t  index_type = static_cast<n_t>(FindBestDataTypeForColumn(rowgroup[column_descriptor.idx]));
+		const auto shape      = GetColumnShape(rowgroup[column_descriptor.idx]);
+		for (const auto* pool : {&get_dict_encoding_pool<PT>(index_type), &get_pool<PT>(column_descriptor.data_type)}) {
+			for (const auto token : *pool) {
+				if (!IsPrunable(token, shape)) {
+					candidates.push_back(token);
+				}
+			}
+		}
+		if (candidates.empty()) {
+			candidates = get_dict_encoding_pool<PT>(index_type);
+			candidates.insert(candidates.end(),
+			                  get_pool<PT>(column_descriptor.data_type).begin(),
+			                  get_pool<PT>(column_descriptor.data_type).end());
+		}
+	}
+
+	auto* schema_cache = fls.get_schema_cache();
+	if (schema_cache != nullptr && ReuseDecision(rowgroup, column_descriptor, candidates, footer, fls, *schema_cache)) {
+		return;
 	}
 
-	auto best_expr = ChooseBestExpr(column_descriptor.expr_space);
+	SearchCandidates<PT>(rowgroup, column_descriptor, std::move(candidates), is_free_choice, footer, fls);
+
+	auto best_expr =
+	    ChooseBestExpr(column_descriptor.expr_space, fls.get_optimize_for(), footer.m_n_vec * CFG::VEC_SZ);
+	if (schema_cache != nullptr) {
+		schema_cache->Store(column_descriptor.name,
+		                    {column_descriptor.data_type,
+		                     best_expr,
+		                     column_descriptor.encoding_rpn->operand_tokens,
+		                     ValidationBytesPerValue(rowgroup, column_descriptor, best_expr, footer, fls)});
+	}
 	column_descriptor.encoding_rpn->operator_tokens.emplace_back(best_expr);
 }
 
@@ -838,6 +1396,18 @@ void expression_check_column(const rowgroup_pt&   rowgroup,
 		TypedDecide<uint8_t>(rowgroup, column_descriptor, footer, fls);
 		break;
 	}
+	case DataType::UINT16: {
+		TypedDecide<uint16_t>(rowgroup, column_descriptor, footer, fls);
+		break;
+	}
+	case DataType::UINT32: {
+		TypedDecide<uint32_t>(rowgroup, column_descriptor, footer, fls);
+		break;
+	}
+	case DataType::UINT64: {
+		TypedDecide<uint64_t>(rowgroup, column_descriptor, footer, fls);
+		break;
+	}
 	case DataType::DOUBLE: {
 		TypedDecide<dbl_pt>(rowgroup, column_descriptor, footer, fls);
 		break;
@@ -1236,6 +1806,59 @@ void PushExternalDictionaryEncoding(ColumnDescriptorT& second_column_descriptor,
 		}
 		break;
 	}
+	case DataType::UINT16: {
+		switch (common_data_type_for_index) {
+		case DataType::UINT16: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U16_U16);
+			break;
+		}
+		case DataType::UINT8: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U16_U08);
+			break;
+		}
+		default:
+			FLS_UNREACHABLE();
+		}
+		break;
+	}
+	case DataType::UINT32: {
+		switch (common_data_type_for_index) {
+		case DataType::UINT32: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U32_U32);
+			break;
+		}
+		case DataType::UINT16: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U32_U16);
+			break;
+		}
+		case DataType::UINT8: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U32_U08);
+			break;
+		}
+		default:
+			FLS_UNREACHABLE();
+		}
+		break;
+	}
+	case DataType::UINT64: {
+		switch (common_data_type_for_index) {
+		case DataType::UINT32: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U64_U32);
+			break;
+		}
+		case DataType::UINT16: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U64_U16);
+			break;
+		}
+		case DataType::UINT8: {
+			second_column_descriptor.encoding_rpn->operator_tokens.emplace_back(OperatorToken::EXP_DICT_U64_U08);
+			break;
+		}
+		default:
+			FLS_UNREACHABLE();
+		}
+		break;
+	}
 	case DataType::FLOAT: {
 		switch (common_data_type_for_index) {
 		case DataType::UINT8: {
@@ -1292,39 +1915,55 @@ DataType FindBestDataTypeForIndex(const col_pt& right, const col_pt& left) {
 	return FindBestDataTypeForColumn(left_col_cardinality > right_col_cardinality ? left : right);
 }
 
-void map_1t1_check(const rowgroup_pt& rowgroup, vector<up<ColumnDescriptorT>>& footer) {
+void map_1t1_check(const rowgroup_pt&               rowgroup,
+                   vector<up<ColumnDescriptorT>>&   footer,
+                   const vector<ColumnFingerprint>& fingerprints,
+                   const n_t                        n_threads) {
 	const auto n_col = rowgroup.size();
 
-	// brute_force
+	// every undetermined column and a later undetermined column with a matching mapping hash are checked exactly, all
+	// pairs in one parallel pass.
+	vector<std::pair<n_t, n_t>> candidate_col_idxs;
 	for (n_t first_col_idx {0}; first_col_idx < n_col; first_col_idx++) {
-		auto& first_column_descriptor = footer[first_col_idx];
-		if (IsDetermined(*first_column_descriptor)) {
+		if (IsDetermined(*footer[first_col_idx])) {
+			continue;
+		}
+		if (!fingerprints[first_col_idx].is_comparable || !is_good_for_dictionary_encoding(rowgroup[first_col_idx])) {
 			continue;
 		}
-
 		for (n_t second_col_idx {first_col_idx + 1}; second_col_idx < n_col; second_col_idx++) {
-			auto& second_column_descriptor = footer[second_col_idx];
-			if (IsDetermined(*second_column_descriptor)) {
-				continue;
-			}
-			if (!is_good_for_dictionary_encoding(rowgroup[first_col_idx])) {
-				continue;
+			if (!IsDetermined(*footer[second_col_idx]) &&
+			    fingerprints[first_col_idx].MayMap1t1(fingerprints[second_col_idx])) {
+				candidate_col_idxs.emplace_back(first_col_idx, second_col_idx);
 			}
+		}
+	}
+	vector<uint8_t> is_map_1t1(candidate_col_idxs.size(), 0);
+	ParallelFor(n_threads, candidate_col_idxs.size(), [&](const n_t candidate_idx) {
+		const auto [first_col_idx, second_col_idx] = candidate_col_idxs[candidate_idx];
+		is_map_1t1[candidate_idx]                  = IsMap1t1(rowgroup[first_col_idx], rowgroup[second_col_idx]);
+	});
+
+	// in column order: a column mapped to an earlier one is neither mapped to nor mapped from again.
+	vector<uint8_t> is_mapped(n_col, 0);
+	for (n_t candidate_idx {0}; candidate_idx < candidate_col_idxs.size(); candidate_idx++) {
+		const auto [first_col_idx, second_col_idx] = candidate_col_idxs[candidate_idx];
+		if (is_map_1t1[candidate_idx] == 0 || is_mapped[first_col_idx] != 0 || is_mapped[second_col_idx] != 0) {
+			continue;
+		}
+		is_mapped[second_col_idx] = 1;
 
-			if (const auto is_map_1t1 = IsMap1t1(rowgroup[first_col_idx], rowgroup[second_col_idx]); is_map_1t1) {
+		auto& first_column_descriptor  = footer[first_col_idx];
+		auto& second_column_descriptor = footer[second_col_idx];
 
-				auto common_data_type_for_index =
-				    FindBestDataTypeForIndex(rowgroup[first_col_idx], rowgroup[second_col_idx]);
+		auto common_data_type_for_index = FindBestDataTypeForIndex(rowgroup[first_col_idx], rowgroup[second_col_idx]);
 
-				first_column_descriptor->encoding_rpn->operator_tokens.emplace_back(
-				    OperatorToken::WIZARD_DICTIONARY_ENCODE);
-				first_column_descriptor->encoding_rpn->operand_tokens.emplace_back(
-				    static_cast<n_t>(common_data_type_for_index));
+		first_column_descriptor->encoding_rpn->operator_tokens.emplace_back(OperatorToken::WIZARD_DICTIONARY_ENCODE);
+		first_column_descriptor->encoding_rpn->operand_tokens.emplace_back(
+		    static_cast<n_t>(common_data_type_for_index));
 
-				second_column_descriptor->encoding_rpn->operand_tokens.emplace_back(first_col_idx);
-				PushExternalDictionaryEncoding(*second_column_descriptor, common_data_type_for_index);
-			}
-		}
+		second_column_descriptor->encoding_rpn->operand_tokens.emplace_back(first_col_idx);
+		PushExternalDictionaryEncoding(*second_column_descriptor, common_data_type_for_index);
 	}
 }
 
@@ -1350,15 +1989,134 @@ void rowgroup_check(const rowgroup_pt& rowgroup, RowgroupDescriptorT& footer, co
 		return;
 	}
 
+	const n_t  n_threads    = fls.get_n_scan_threads();
+	const auto fingerprints = fingerprint_columns(rowgroup, n_threads);
+
 	init(column_descriptors);
 	gather_statistics(rowgroup, column_descriptors);
 	constant_check(rowgroup, column_descriptors);
-	equality_check(rowgroup, column_descriptors);
+	equality_check(rowgroup, column_descriptors, fingerprints, n_threads);
 	null_check(rowgroup, column_descriptors);
-	map_1t1_check(rowgroup, column_descriptors);
+	map_1t1_check(rowgroup, column_descriptors, fingerprints, n_threads);
 	expression_check(rowgroup, footer, fls); // all left over columns are expression encoded.
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Global Dictionaries
+\*--------------------------------------------------------------------------------------------------------------------*/
+bool IsStrDictFfor(const ColumnDescriptorT& column_descriptor) {
+	const auto& [operator_tokens, operand_tokens] = *column_descriptor.encoding_rpn;
+	if (operator_tokens.size() != 1 || !operand_tokens.empty()) {
+		return false;
+	}
+
+	switch (operator_tokens[0]) {
+	case OperatorToken::EXP_DICT_STR_FFOR_U32:
+	case OperatorToken::EXP_DICT_STR_FFOR_U16:
+	case OperatorToken::EXP_DICT_STR_FFOR_U08:
+	case OperatorToken::EXP_DICT_STR_FFOR_SLPATCH_U32:
+	case OperatorToken::EXP_DICT_STR_FFOR_SLPATCH_U16:
+	case OperatorToken::EXP_DICT_STR_FFOR_SLPATCH_U08:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// another column that borrows the dictionary codes of column `col_idx` as its own index; equal columns only borrow
+// the decoded values, so they do not care which codes those are.
+bool IsDictionaryBorrowed(const RowgroupDescriptorT& footer, const n_t col_idx) {
+	for (n_t other_col_idx {0}; other_col_idx < footer.m_column_descriptors.size(); ++other_col_idx) {
+		const auto& [operator_tokens, operand_tokens] = *footer.m_column_descriptors[other_col_idx]->encoding_rpn;
+		if (other_col_idx != col_idx && !operand_tokens.empty() && operand_tokens[0] == col_idx &&
+		    (operator_tokens.empty() || operator_tokens[0] != OperatorToken::EXP_EQUAL)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// a string column that the wizard dictionary-encoded in every rowgroup gets one dictionary for the whole table, if
+// that is smaller than the rowgroup dictionaries together. its rowgroups are then encoded into the one code space.
+void global_dictionary_check(const Table& table, TableDescriptorT& table_descriptor) {
+	const auto& rowgroup_descriptors = table_descriptor.m_rowgroup_descriptors;
+	if (rowgroup_descriptors.size() < 2) {
+		return;
+	}
+
+	const n_t n_cols = rowgroup_descriptors[0]->m_column_descriptors.size();
+	for (n_t col_idx {0}; col_idx < n_cols; ++col_idx) {
+		const bool is_shareable = std::ranges::all_of(rowgroup_descriptors, [&](const auto& footer) {
+			return IsStrDictFfor(*footer->m_column_descriptors[col_idx]) && !IsDictionaryBorrowed(*footer, col_idx);
+		});
+		if (!is_shareable) {
+			continue;
+		}
+
+		const auto dictionary = GlobalDictionary::Build(table, col_idx);
+		if (dictionary == nullptr) {
+			continue;
+		}
+
+		for (n_t rowgroup_idx {0}; rowgroup_idx < table.get_n_rowgroups(); ++rowgroup_idx) {
+			auto& column_descriptor = *rowgroup_descriptors[rowgroup_idx]->m_column_descriptors[col_idx];
+			column_descriptor.encoding_rpn->operator_tokens = {dictionary->Token()};
+
+			auto& str_col = std::get<up<FLSStrColumn>>(table.m_rowgroups[rowgroup_idx]->internal_rowgroup[col_idx]);
+			str_col->m_stats.global_dictionary = dictionary;
+		}
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Shared Symbol Tables
+\*--------------------------------------------------------------------------------------------------------------------*/
+// the single fsst encoding the column has, INVALID if it has another one.
+OperatorToken GetFsstDelta(const ColumnDescriptorT& column_descriptor) {
+	const auto& [operator_tokens, operand_tokens] = *column_descriptor.encoding_rpn;
+	if (operator_tokens.size() != 1 || !operand_tokens.empty()) {
+		return OperatorToken::INVALID;
+	}
+
+	switch (operator_tokens[0]) {
+	case OperatorToken::EXP_FSST_DELTA:
+	case OperatorToken::EXP_FSST12_DELTA:
+		return operator_tokens[0];
+	default:
+		return OperatorToken::INVALID;
+	}
+}
+
+// a string column that the wizard fsst-encoded the same way in every rowgroup gets its symbol tables trained once for
+// the table instead of once per rowgroup; see SharedSymbolTable::Assign.
+void shared_symbol_table_check(const Table& table, TableDescriptorT& table_descriptor) {
+	const auto& rowgroup_descriptors = table_descriptor.m_rowgroup_descriptors;
+	if (rowgroup_descriptors.size() < 2) {
+		return;
+	}
+
+	const n_t n_cols = rowgroup_descriptors[0]->m_column_descriptors.size();
+	for (n_t col_idx {0}; col_idx < n_cols; ++col_idx) {
+		const auto token = GetFsstDelta(*rowgroup_descriptors[0]->m_column_descriptors[col_idx]);
+		if (token == OperatorToken::INVALID) {
+			continue;
+		}
+
+		const bool is_shareable = std::ranges::all_of(rowgroup_descriptors, [&](const auto& footer) {
+			return GetFsstDelta(*footer->m_column_descriptors[col_idx]) == token;
+		});
+		if (!is_shareable || !SharedSymbolTable::Assign(table, col_idx, token == OperatorToken::EXP_FSST12_DELTA)) {
+			continue;
+		}
+
+		for (n_t rowgroup_idx {0}; rowgroup_idx < table.get_n_rowgroups(); ++rowgroup_idx) {
+			const auto& column            = table.m_rowgroups[rowgroup_idx]->internal_rowgroup[col_idx];
+			auto&       column_descriptor = *rowgroup_descriptors[rowgroup_idx]->m_column_descriptors[col_idx];
+			column_descriptor.encoding_rpn->operator_tokens = {SharedSymbolTable::Of(column).Token()};
+		}
+	}
+}
+
 up<TableDescriptorT> Wizard::Spell(const Connection& fls) {
 	// init
 	const auto& table = fls.get_table();
@@ -1371,6 +2129,14 @@ up<TableDescriptorT> Wizard::Spell(const Connection& fls) {
 		               fls);
 	}
 
+	if (fls.is_global_dictionaries_enabled() && !fls.is_forced_schema()) {
+		global_dictionary_check(table, *table_descriptor);
+	}
+
+	if (fls.is_shared_symbol_tables_enabled() && !fls.is_forced_schema()) {
+		shared_symbol_table_check(table, *table_descriptor);
+	}
+
 	return table_descriptor;
 }
 
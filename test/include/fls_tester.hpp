@@ -9,8 +9,15 @@
 #include "data/fastlanes_data.hpp"
 #include "fastlanes.hpp"
 #include "fls/connection.hpp"
+#include "fls/expression/aggregate.hpp"
+#include "fls/expression/logical_expression.hpp"
+#include "fls/expression/selection_ds.hpp"
+#include "fls/primitive/predicate/str_predicate.hpp"
 #include "gtest/gtest.h"
+#include <algorithm>  // std::min, std::max
+#include <cmath>      // std::abs
 #include <filesystem> // std::filesystem::exists, create_directories, remove_all
+#include <functional> // std::function
 #include <fls/table/dir.hpp>
 
 #if defined(_WIN32)
@@ -23,6 +30,7 @@
 namespace fastlanes {
 
 class FastLanesReaderTester : public ::testing::Test {
+protected:
 	const path fastlanes_repo_data_path {FLS_CMAKE_SOURCE_DIR};
 	const path fls_dir_path = fastlanes_repo_data_path / "data" / "fls";
 	path       fls_file_path_process_specific;
@@ -48,17 +56,26 @@ public:
 	                     const vector<OperatorToken>& expressions    = {},
 	                     const n_t                    rowgroup_size  = CFG::RowGroup::N_VECTORS_PER_ROWGROUP,
 	                     bool                         inlined_footer = false) const {
+		TestCorrectness<DATA_TYPE>(table, [&](Connection& con) {
+			con.set_n_vectors_per_rowgroup(rowgroup_size);
+			if (inlined_footer) {
+				con.inline_footer();
+			}
+			if (!expressions.empty()) {
+				con.force_schema_pool(expressions);
+			}
+		});
+	}
+
+	// the same, with the connection that writes the file set up by `configure`.
+	template <FileT DATA_TYPE = FileT::CSV>
+	void TestCorrectness(const string_view table, const std::function<void(Connection&)>& configure) const {
 		const path dir_path = fastlanes_repo_data_path / string(table);
 
 		// original table
 		Connection con1;
-		con1.reset().set_n_vectors_per_rowgroup(rowgroup_size);
-		if (inlined_footer) {
-			con1.inline_footer();
-		}
-		if (!expressions.empty()) {
-			con1.force_schema_pool(expressions);
-		}
+		con1.reset();
+		configure(con1);
 		if constexpr (DATA_TYPE == FileT::CSV) {
 			con1.read_csv(dir_path);
 		} else {
@@ -166,6 +183,129 @@ public:
 		TestEquality(equal_cols);
 	}
 
+	// the naive evaluation of `predicate`, on a decoded string.
+	static bool IsMatch(const StrPredicate& predicate, const string_view value) {
+		switch (predicate.type) {
+		case StrPredicateT::EQUAL:
+			return value == predicate.pattern;
+		case StrPredicateT::PREFIX:
+			return value.starts_with(predicate.pattern);
+		case StrPredicateT::CONTAINS:
+			return value.find(predicate.pattern) != string_view::npos;
+		}
+		return false;
+	}
+
+	void TestAggregate(const string_view            table,
+	                   const vector<OperatorToken>& expressions,
+	                   const bool                   is_pushed_down) const {
+		TestCorrectness(table, expressions);
+
+		Connection con;
+		const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+		const auto decoded    = fls_reader->materialize();
+
+		ASSERT_EQ(std::get<u64_pt>(fls_reader->aggregate(0, AggregateT::COUNT)), fls_reader->get_n_tuples());
+
+		visit(overloaded {
+		          [&]<typename PT>(const up<TypedCol<PT>>&) {
+			          if constexpr (std::is_arithmetic_v<PT>) {
+				          // expected values, the naive way over every rowgroup.
+				          using sum_t = aggregate_sum_t<PT>;
+				          sum_t sum {0};
+				          PT    min = std::get<up<TypedCol<PT>>>(decoded->m_rowgroups[0]->internal_rowgroup[0])->data[0];
+				          PT    max = min;
+				          for (const auto& rowgroup : decoded->m_rowgroups) {
+					          const auto& data = std::get<up<TypedCol<PT>>>(rowgroup->internal_rowgroup[0])->data;
+					          for (n_t idx {0}; idx < rowgroup->RowCount(); ++idx) {
+						          if constexpr (std::is_floating_point_v<PT>) {
+							          sum += data[idx];
+						          } else {
+							          sum = static_cast<sum_t>(static_cast<u64_pt>(sum) + static_cast<u64_pt>(data[idx]));
+						          }
+						          min = std::min(min, data[idx]);
+						          max = std::max(max, data[idx]);
+					          }
+				          }
+
+				          ASSERT_EQ(std::get<PT>(fls_reader->aggregate(0, AggregateT::MIN)), min);
+				          ASSERT_EQ(std::get<PT>(fls_reader->aggregate(0, AggregateT::MAX)), max);
+				          const auto result_sum = std::get<sum_t>(fls_reader->aggregate(0, AggregateT::SUM));
+				          if constexpr (std::is_floating_point_v<PT>) {
+					          ASSERT_LE(std::abs(result_sum - sum), 1e-9 * std::max(1.0, std::abs(sum)));
+				          } else {
+					          ASSERT_EQ(result_sum, sum);
+				          }
+			          }
+		          },
+		          [&](const auto&) { FAIL() << "column 0 is not a typed column"; },
+		      },
+		      decoded->m_rowgroups[0]->internal_rowgroup[0]);
+
+		// the encoding decides whether the segments are enough.
+		for (const auto type : {AggregateT::SUM, AggregateT::MIN, AggregateT::MAX}) {
+			Aggregate aggregate {type};
+			ASSERT_EQ(fls_reader->get_rowgroup_reader(0)->aggregate(0, aggregate), is_pushed_down);
+		}
+	}
+
+	// the file holds several rowgroups, each encoded as `expected_token`, and one reader over all of them filters
+	// `col_idx` the way IsMatch selects its values.
+	void TestFilterAcrossRowgroups(const n_t col_idx, const OperatorToken expected_token) const {
+		Connection con;
+		const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+		ASSERT_GT(fls_reader->get_n_rowgroups(), 1);
+
+		auto rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		for (n_t rowgroup_idx {0}; rowgroup_idx < fls_reader->get_n_rowgroups(); ++rowgroup_idx) {
+			rowgroup_reader->reset(rowgroup_idx);
+			const auto& descriptor = rowgroup_reader->get_descriptor();
+			const auto* rpn = descriptor.m_column_descriptors()->Get(static_cast<uint32_t>(col_idx))->encoding_rpn();
+			ASSERT_EQ(rpn->operator_tokens()->Get(0), expected_token) << "rowgroup " << rowgroup_idx;
+
+			const auto  decoded = rowgroup_reader->materialize();
+			const auto& str_col = std::get<up<FLSStrColumn>>(decoded->internal_rowgroup[col_idx]);
+
+			vector<string> values;
+			n_t            offset {0};
+			for (const auto length : str_col->length_arr) {
+				values.emplace_back(reinterpret_cast<const char*>(str_col->byte_arr.data() + offset), length);
+				offset += length;
+			}
+
+			// the padding of the last vector repeats the last value; it must never be selected.
+			const n_t                  n_tuples   = descriptor.m_n_tuples();
+			const string&              last_value = values[n_tuples - 1];
+			const vector<StrPredicate> predicates {
+			    {StrPredicateT::EQUAL, last_value},
+			    {StrPredicateT::EQUAL, last_value + last_value},
+			    {StrPredicateT::PREFIX, last_value.substr(0, 3)},
+			    {StrPredicateT::CONTAINS, last_value.substr(last_value.size() / 2, 2)},
+			};
+
+			const InvalidExpr logical_expr;
+			SelectionDS       selection {logical_expr};
+			for (n_t vec_idx {0}; vec_idx < descriptor.m_n_vec(); ++vec_idx) {
+				for (const auto& predicate : predicates) {
+					ASSERT_TRUE(rowgroup_reader->filter_chunk(vec_idx, col_idx, predicate, selection));
+
+					vector<vec_idx_t> expected;
+					const n_t         n_values = std::min(CFG::VEC_SZ, n_tuples - vec_idx * CFG::VEC_SZ);
+					for (vec_idx_t idx {0}; idx < n_values; ++idx) {
+						if (IsMatch(predicate, values[vec_idx * CFG::VEC_SZ + idx])) {
+							expected.push_back(idx);
+						}
+					}
+
+					const auto indices = selection.Indices();
+					ASSERT_EQ(vector<vec_idx_t>(indices.begin(), indices.end()), expected)
+					    << "rowgroup " << rowgroup_idx << " vector " << vec_idx << " pattern '" << predicate.pattern
+					    << "'";
+				}
+			}
+		}
+	}
+
 	static Status VerifyFastLanesFile(const path& fls_file_path) {
 		Connection con;
 		return con.verify_fls(fls_file_path);
@@ -44,6 +44,15 @@ TEST_F(FastLanesReaderTester, SINGLE_COLUMN_DBLPT) {
 TEST_F(FastLanesReaderTester, SINGLE_COLUMN_U08PT) {
 	TestCorrectness(GENERATED::SINGLE_COLUMN_U08PT);
 }
+TEST_F(FastLanesReaderTester, SINGLE_COLUMN_U16PT) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U16PT);
+}
+TEST_F(FastLanesReaderTester, SINGLE_COLUMN_U32PT) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U32PT);
+}
+TEST_F(FastLanesReaderTester, SINGLE_COLUMN_U64PT) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U64PT);
+}
 TEST_F(FastLanesReaderTester, SINGLE_COLUMN_STRUCT) {
 	TestCorrectness<FileT::JSON>(GENERATED::STRUCT);
 }
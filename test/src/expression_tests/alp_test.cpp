@@ -3,6 +3,8 @@
 // ────────────────────────────────────────────────────────
 // test/src/expression_tests/alp_test.cpp
 // ────────────────────────────────────────────────────────
+#include "fls/footer/rowgroup_descriptor.hpp"
+#include "fls/reader/rowgroup_reader.hpp"
 #include "fls_tester.hpp"
 
 namespace fastlanes {
@@ -15,4 +17,19 @@ TEST_F(FastLanesReaderTester, TEST_ALP_DOUBLE) {
 	TestCorrectness(GENERATED::EXP_ALP_DBL, {OperatorToken::EXP_ALP_DBL});
 }
 
+// full-precision doubles leave ALP with exceptions only, so the free choice, whose candidates are halved on samples of
+// a few vectors, should still end up with ALP_RD.
+TEST_F(FastLanesReaderTester, TEST_ALP_RD_DOUBLE_IS_CHOSEN) {
+	TestCorrectness(GENERATED::EXP_ALP_RD_DBL);
+
+	Connection con;
+	const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+	for (n_t rowgroup_idx {0}; rowgroup_idx < fls_reader->get_n_rowgroups(); ++rowgroup_idx) {
+		const auto  rowgroup_reader   = fls_reader->get_rowgroup_reader(rowgroup_idx);
+		const auto* column_descriptor = rowgroup_reader->get_descriptor().m_column_descriptors()->Get(0);
+		ASSERT_EQ(column_descriptor->encoding_rpn()->operator_tokens()->Get(0), OperatorToken::EXP_ALP_RD_DBL)
+		    << "rowgroup " << rowgroup_idx;
+	}
+}
+
 } // namespace fastlanes
@@ -0,0 +1,66 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/expression_tests/boolean_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+#include <algorithm> // std::min
+
+namespace fastlanes {
+
+class BooleanTester : public FastLanesReaderTester {
+public:
+	void TestBooleanSelect(const string_view table, const vector<OperatorToken>& expressions) const {
+		TestCorrectness(table, expressions);
+
+		Connection  con;
+		const auto  fls_reader      = con.reset().read_fls(fls_file_path_process_specific);
+		auto        rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		const auto  decoded         = rowgroup_reader->materialize();
+		const auto& descriptor      = rowgroup_reader->get_descriptor();
+		const auto& values          = std::get<up<TypedCol<u08_pt>>>(decoded->internal_rowgroup[0])->data;
+
+		// the padding of the last vector repeats the last value; it must never be selected.
+		const n_t         n_tuples = descriptor.m_n_tuples();
+		const InvalidExpr logical_expr;
+		SelectionDS       selection {logical_expr};
+		for (n_t vec_idx {0}; vec_idx < descriptor.m_n_vec(); ++vec_idx) {
+			ASSERT_TRUE(rowgroup_reader->select_chunk(vec_idx, 0, selection));
+
+			vector<vec_idx_t> expected;
+			const n_t         n_values = std::min(CFG::VEC_SZ, n_tuples - vec_idx * CFG::VEC_SZ);
+			for (vec_idx_t idx {0}; idx < n_values; ++idx) {
+				if (values[vec_idx * CFG::VEC_SZ + idx] != 0) {
+					expected.push_back(idx);
+				}
+			}
+
+			ASSERT_EQ(selection.n_selected_values, expected.size()) << "vector " << vec_idx;
+			selection.ToIndices();
+			const auto indices = selection.Indices();
+			ASSERT_EQ(vector<vec_idx_t>(indices.begin(), indices.end()), expected) << "vector " << vec_idx;
+		}
+	}
+};
+
+TEST_F(BooleanTester, TEST_BOOLEAN) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_BOOLEAN, {OperatorToken::EXP_BOOLEAN});
+}
+
+TEST_F(BooleanTester, TEST_BOOLEAN_SELECT) {
+	TestBooleanSelect(GENERATED::SINGLE_COLUMN_BOOLEAN, {OperatorToken::EXP_BOOLEAN});
+}
+
+TEST_F(BooleanTester, TEST_BOOLEAN_SELECT_PARTIAL_LAST_VECTOR) {
+	TestBooleanSelect(GENERATED::PARTIAL_VECTOR_BOOLEAN, {OperatorToken::EXP_BOOLEAN});
+}
+
+TEST_F(BooleanTester, TEST_BOOLEAN_SELECT_ALL_TRUE_PARTIAL_LAST_VECTOR) {
+	TestBooleanSelect(GENERATED::PARTIAL_VECTOR_BOOLEAN_TRUE_TAIL, {OperatorToken::EXP_BOOLEAN});
+}
+
+TEST_F(BooleanTester, TEST_BOOLEAN_AGGREGATE) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_BOOLEAN, {OperatorToken::EXP_BOOLEAN}, true);
+}
+
+} // namespace fastlanes
@@ -0,0 +1,34 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/expression_tests/delta2_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+TEST_F(FastLanesReaderTester, TEST_DELTA2_I64) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_DELTA2_I64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA2_I64_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_I64, {OperatorToken::EXP_DELTA2_I64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA2_I32) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_I32PT, {OperatorToken::EXP_DELTA2_I32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA2_I32_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_I32, {OperatorToken::EXP_DELTA2_I32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA2_I16) {
+	TestCorrectness(GENERATED::EXP_CROSS_RLE_i16, {OperatorToken::EXP_DELTA2_I16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA2_I16_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_I16, {OperatorToken::EXP_DELTA2_I16});
+}
+
+} // namespace fastlanes
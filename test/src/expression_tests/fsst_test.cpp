@@ -4,11 +4,103 @@
 // test/src/expression_tests/fsst_test.cpp
 // ────────────────────────────────────────────────────────
 #include "fls_tester.hpp"
+#include <algorithm> // std::min
 
 namespace fastlanes {
 
-TEST_F(FastLanesReaderTester, TEST_FSST) {
+class FsstTester : public FastLanesReaderTester {
+public:
+	void TestStrFilter(const string_view table, const vector<OperatorToken>& expressions) const {
+		TestCorrectness(table, expressions);
+
+		Connection  con;
+		const auto  fls_reader      = con.reset().read_fls(fls_file_path_process_specific);
+		auto        rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		const auto  decoded         = rowgroup_reader->materialize();
+		const auto& descriptor      = rowgroup_reader->get_descriptor();
+		const auto& str_col         = std::get<up<FLSStrColumn>>(decoded->internal_rowgroup[0]);
+
+		// decoded strings, to evaluate the predicates the naive way.
+		vector<string> values;
+		n_t            offset {0};
+		for (const auto length : str_col->length_arr) {
+			values.emplace_back(reinterpret_cast<const char*>(str_col->byte_arr.data() + offset), length);
+			offset += length;
+		}
+
+		// the padding of the last vector repeats the last value; it must never be selected.
+		const n_t                  n_tuples    = descriptor.m_n_tuples();
+		const string&              first_value = values[0];
+		const vector<StrPredicate> predicates {
+		    {StrPredicateT::EQUAL, first_value},
+		    {StrPredicateT::EQUAL, values[n_tuples - 1]},
+		    {StrPredicateT::EQUAL, first_value + first_value},
+		    {StrPredicateT::PREFIX, first_value.substr(0, 3)},
+		    {StrPredicateT::CONTAINS, first_value.substr(first_value.size() / 2, 2)},
+		    {StrPredicateT::CONTAINS, ""},
+		    {StrPredicateT::CONTAINS, "\x01never stored\x01"},
+		};
+
+		const InvalidExpr logical_expr;
+		SelectionDS       selection {logical_expr};
+		for (n_t vec_idx {0}; vec_idx < descriptor.m_n_vec(); ++vec_idx) {
+			for (const auto& predicate : predicates) {
+				ASSERT_TRUE(rowgroup_reader->filter_chunk(vec_idx, 0, predicate, selection));
+
+				vector<vec_idx_t> expected;
+				const n_t         n_values = std::min(CFG::VEC_SZ, n_tuples - vec_idx * CFG::VEC_SZ);
+				for (vec_idx_t idx {0}; idx < n_values; ++idx) {
+					if (IsMatch(predicate, values[vec_idx * CFG::VEC_SZ + idx])) {
+						expected.push_back(idx);
+					}
+				}
+
+				const auto indices = selection.Indices();
+				ASSERT_EQ(vector<vec_idx_t>(indices.begin(), indices.end()), expected)
+				    << "vector " << vec_idx << " pattern '" << predicate.pattern << "'";
+			}
+		}
+	}
+};
+
+TEST_F(FsstTester, TEST_FSST) {
 	TestCorrectness(GENERATED::SINGLE_COLUMN_STRPT, {OperatorToken::EXP_FSST_DELTA});
 }
 
+TEST_F(FsstTester, TEST_FSST_FILTER) {
+	TestStrFilter(GENERATED::SINGLE_COLUMN_STRPT, {OperatorToken::EXP_FSST_DELTA});
+}
+
+TEST_F(FsstTester, TEST_FSST12_FILTER) {
+	TestStrFilter(GENERATED::SINGLE_COLUMN_STRPT, {OperatorToken::EXP_FSST12_DELTA});
+}
+
+TEST_F(FsstTester, TEST_FSST_DICT_FILTER) {
+	TestStrFilter(GENERATED::FSST_DICT_U16_EXPR, {OperatorToken::EXP_FSST_DICT_STR_FFOR_U16});
+}
+
+TEST_F(FsstTester, TEST_FSST12_DICT_FILTER) {
+	TestStrFilter(GENERATED::FSST_DICT_U16_EXPR, {OperatorToken::EXP_FSST12_DICT_STR_FFOR_U16});
+}
+
+TEST_F(FsstTester, TEST_FSST_FILTER_PARTIAL_LAST_VECTOR) {
+	TestStrFilter(GENERATED::PARTIAL_VECTOR_STR, {OperatorToken::EXP_FSST_DELTA});
+}
+
+TEST_F(FsstTester, TEST_FSST12_FILTER_PARTIAL_LAST_VECTOR) {
+	TestStrFilter(GENERATED::PARTIAL_VECTOR_STR, {OperatorToken::EXP_FSST12_DELTA});
+}
+
+TEST_F(FsstTester, TEST_FSST_DICT_FILTER_PARTIAL_LAST_VECTOR) {
+	TestStrFilter(GENERATED::PARTIAL_VECTOR_STR, {OperatorToken::EXP_FSST_DICT_STR_FFOR_U16});
+}
+
+TEST_F(FsstTester, TEST_FSST12_DICT_FILTER_PARTIAL_LAST_VECTOR) {
+	TestStrFilter(GENERATED::PARTIAL_VECTOR_STR, {OperatorToken::EXP_FSST12_DICT_STR_FFOR_U16});
+}
+
+TEST_F(FsstTester, TEST_DICT_FILTER_PARTIAL_LAST_VECTOR) {
+	TestStrFilter(GENERATED::PARTIAL_VECTOR_STR, {OperatorToken::EXP_DICT_STR_FFOR_U16});
+}
+
 } // namespace fastlanes
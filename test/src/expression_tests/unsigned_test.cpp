@@ -0,0 +1,238 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/expression_tests/unsigned_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class UnsignedTester : public FastLanesReaderTester {
+public:
+	// unsigned columns are narrowed to the smallest unsigned type holding their maximum, never to a signed one.
+	void TestDataType(const string_view table, const DataType expected_data_type) const {
+		TestCorrectness(table);
+
+		Connection  con;
+		const auto  fls_reader            = con.reset().read_fls(fls_file_path_process_specific);
+		auto        first_rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		const auto& footer                = first_rowgroup_reader->get_descriptor();
+
+		ASSERT_EQ(footer.m_column_descriptors()->Get(0)->data_type(), expected_data_type);
+	}
+
+	// column 1 maps column 0 through an 8-bit index, column 3 maps column 2 through a 16-bit one.
+	void TestExternalDictionary(const string_view   table,
+	                            const OperatorToken u08_index_token,
+	                            const OperatorToken u16_index_token) const {
+		TestCorrectness(table);
+		TestMap1To1({1, 3});
+
+		Connection  con;
+		const auto  fls_reader            = con.reset().read_fls(fls_file_path_process_specific);
+		auto        first_rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		const auto& footer                = first_rowgroup_reader->get_descriptor();
+
+		const auto* cols = footer.m_column_descriptors();
+		ASSERT_EQ(cols->Get(1)->encoding_rpn()->operator_tokens()->Get(0), u08_index_token);
+		ASSERT_EQ(cols->Get(3)->encoding_rpn()->operator_tokens()->Get(0), u16_index_token);
+	}
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * Data Type
+\*--------------------------------------------------------------------------------------------------------------------*/
+// a UINT8 column with values above 127 used to widen to INT16; it stays UINT8 now.
+TEST_F(UnsignedTester, TEST_DATA_TYPE_U08) {
+	TestDataType(GENERATED::SINGLE_COLUMN_U08PT, DataType::UINT8);
+}
+
+TEST_F(UnsignedTester, TEST_DATA_TYPE_U16) {
+	TestDataType(GENERATED::SINGLE_COLUMN_U16PT, DataType::UINT16);
+}
+
+TEST_F(UnsignedTester, TEST_DATA_TYPE_U32) {
+	TestDataType(GENERATED::SINGLE_COLUMN_U32PT, DataType::UINT32);
+}
+
+TEST_F(UnsignedTester, TEST_DATA_TYPE_U64) {
+	TestDataType(GENERATED::SINGLE_COLUMN_U64PT, DataType::UINT64);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * U16
+\*--------------------------------------------------------------------------------------------------------------------*/
+TEST_F(FastLanesReaderTester, TEST_UNCOMPRESSED_U16) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U16PT, {OperatorToken::EXP_UNCOMPRESSED_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_UNCOMPRESSED_U16_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_UNCOMPRESSED_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_U16) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U16PT, {OperatorToken::EXP_FFOR_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_U16_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_FFOR_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_SLPATCH_U16) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U16PT, {OperatorToken::EXP_FFOR_SLPATCH_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_SLPATCH_U16_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_FFOR_SLPATCH_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA_U16) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U16PT, {OperatorToken::EXP_DELTA_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA_U16_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_DELTA_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_RLE_U16) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U16PT, {OperatorToken::EXP_RLE_U16_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_RLE_U16_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_RLE_U16_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U16_FFOR_U16) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_DICT_U16_FFOR_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U16_FFOR_U08) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U16, {OperatorToken::EXP_DICT_U16_FFOR_U08});
+}
+
+TEST_F(UnsignedTester, TEST_DICT_U16_MAP) {
+	TestExternalDictionary(
+	    GENERATED::ONE_TO_ONE_U16, OperatorToken::EXP_DICT_U16_U08, OperatorToken::EXP_DICT_U16_U16);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * U32
+\*--------------------------------------------------------------------------------------------------------------------*/
+TEST_F(FastLanesReaderTester, TEST_UNCOMPRESSED_U32) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U32PT, {OperatorToken::EXP_UNCOMPRESSED_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_UNCOMPRESSED_U32_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_UNCOMPRESSED_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_U32) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U32PT, {OperatorToken::EXP_FFOR_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_U32_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_FFOR_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_SLPATCH_U32) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U32PT, {OperatorToken::EXP_FFOR_SLPATCH_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_SLPATCH_U32_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_FFOR_SLPATCH_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA_U32) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U32PT, {OperatorToken::EXP_DELTA_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA_U32_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_DELTA_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_RLE_U32) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U32PT, {OperatorToken::EXP_RLE_U32_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_RLE_U32_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_RLE_U32_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U32_FFOR_U32) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_DICT_U32_FFOR_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U32_FFOR_U16) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_DICT_U32_FFOR_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U32_FFOR_U08) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U32, {OperatorToken::EXP_DICT_U32_FFOR_U08});
+}
+
+TEST_F(UnsignedTester, TEST_DICT_U32_MAP) {
+	TestExternalDictionary(
+	    GENERATED::ONE_TO_ONE_U32, OperatorToken::EXP_DICT_U32_U08, OperatorToken::EXP_DICT_U32_U16);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*\
+ * U64
+\*--------------------------------------------------------------------------------------------------------------------*/
+TEST_F(FastLanesReaderTester, TEST_UNCOMPRESSED_U64) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U64PT, {OperatorToken::EXP_UNCOMPRESSED_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_UNCOMPRESSED_U64_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_UNCOMPRESSED_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_U64) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U64PT, {OperatorToken::EXP_FFOR_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_U64_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_FFOR_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_SLPATCH_U64) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U64PT, {OperatorToken::EXP_FFOR_SLPATCH_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_FFOR_SLPATCH_U64_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_FFOR_SLPATCH_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA_U64) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U64PT, {OperatorToken::EXP_DELTA_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DELTA_U64_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_DELTA_U64});
+}
+
+TEST_F(FastLanesReaderTester, TEST_RLE_U64) {
+	TestCorrectness(GENERATED::SINGLE_COLUMN_U64PT, {OperatorToken::EXP_RLE_U64_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_RLE_U64_PARTIAL_LAST_VECTOR) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_RLE_U64_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U64_FFOR_U32) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_DICT_U64_FFOR_U32});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U64_FFOR_U16) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_DICT_U64_FFOR_U16});
+}
+
+TEST_F(FastLanesReaderTester, TEST_DICT_U64_FFOR_U08) {
+	TestCorrectness(GENERATED::PARTIAL_VECTOR_U64, {OperatorToken::EXP_DICT_U64_FFOR_U08});
+}
+
+TEST_F(UnsignedTester, TEST_DICT_U64_MAP) {
+	TestExternalDictionary(
+	    GENERATED::ONE_TO_ONE_U64, OperatorToken::EXP_DICT_U64_U08, OperatorToken::EXP_DICT_U64_U16);
+}
+
+} // namespace fastlanes
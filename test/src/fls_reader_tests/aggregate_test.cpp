@@ -0,0 +1,42 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/aggregate_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+TEST_F(FastLanesReaderTester, AGGREGATE_UNCOMPRESSED_I64) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_UNCOMPRESSED_I64}, true);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_FFOR_I64) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_FFOR_I64}, true);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_FFOR_I08) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_I08PT, {OperatorToken::EXP_FFOR_I08}, true);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_DICT_I64_FFOR_U16) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_DICT_I64_FFOR_U16}, true);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_RLE_DBL_U16) {
+	TestAggregate(GENERATED::ONE_VEC_DBLPT, {OperatorToken::EXP_RLE_DBL_U16}, true);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_FREQUENCY_DBL) {
+	TestAggregate(GENERATED::FREQUENCY_DBL_EXPR, {OperatorToken::EXP_FREQUENCY_DBL}, true);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_DELTA_I64) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_DELTA_I64}, false);
+}
+
+TEST_F(FastLanesReaderTester, AGGREGATE_DELTA2_I64) {
+	TestAggregate(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_DELTA2_I64}, false);
+}
+
+} // namespace fastlanes
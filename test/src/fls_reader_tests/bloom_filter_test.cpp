@@ -0,0 +1,149 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/bloom_filter_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/filter/bloom_filter.hpp"
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+#include <limits>
+
+namespace fastlanes {
+
+class BloomFilterTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE = FileT::CSV>
+	void TestBloomFilter(const string_view table, const n_t rowgroup_size) const {
+		const path dir_path = fastlanes_repo_data_path / string(table);
+
+		Connection con1;
+		con1.reset().set_n_vectors_per_rowgroup(rowgroup_size).enable_bloom_filter();
+		if constexpr (DATA_TYPE == FileT::CSV) {
+			con1.read_csv(dir_path);
+		} else {
+			con1.read_json(dir_path);
+		}
+		const auto& original_table = con1.get_table();
+		con1.to_fls(fls_file_path_process_specific);
+
+		Connection con2;
+		const auto fls_reader = con2.reset().read_fls(fls_file_path_process_specific);
+		ASSERT_EQ(fls_reader->get_n_rowgroups(), original_table.get_n_rowgroups());
+
+		// no false negatives: every stored value may be contained in its own rowgroup. nulls are not stored.
+		const auto is_null = [](const null_map_arr_t& null_map_arr, const n_t val_idx) {
+			return val_idx < null_map_arr.size() && null_map_arr[val_idx];
+		};
+		for (n_t rowgroup_idx {0}; rowgroup_idx < original_table.get_n_rowgroups(); ++rowgroup_idx) {
+			const auto& rowgroup = *original_table.m_rowgroups[rowgroup_idx];
+			for (n_t col_idx {0}; col_idx < rowgroup.ColCount(); ++col_idx) {
+				visit(overloaded {
+				          [&](const up<FLSStrColumn>& str_col) {
+					          for (n_t val_idx {0}; val_idx < str_col->length_arr.size(); ++val_idx) {
+						          if (is_null(str_col->null_map_arr, val_idx)) {
+							          continue;
+						          }
+						          const string_view val {reinterpret_cast<const char*>(str_col->str_p_arr[val_idx]),
+						                                 str_col->length_arr[val_idx]};
+						          ASSERT_TRUE(fls_reader->may_contain(rowgroup_idx, col_idx, val))
+						              << "column " << col_idx << " rowgroup " << rowgroup_idx << " value " << val;
+					          }
+				          },
+				          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+					          if constexpr (!std::is_same_v<PT, str_pt>) {
+						          for (n_t val_idx {0}; val_idx < typed_col->data.size(); ++val_idx) {
+							          if (is_null(typed_col->null_map_arr, val_idx)) {
+								          continue;
+							          }
+							          const auto& val = typed_col->data[val_idx];
+							          ASSERT_TRUE(fls_reader->may_contain(rowgroup_idx, col_idx, val))
+							              << "column " << col_idx << " rowgroup " << rowgroup_idx << " row " << val_idx;
+						          }
+					          }
+				          },
+				          [&](const auto&) {},
+				      },
+				      rowgroup.internal_rowgroup[col_idx]);
+			}
+		}
+	}
+};
+
+TEST_F(BloomFilterTester, BLOOM_FILTER_SINGLE_COLUMN_I64) {
+	TestBloomFilter(GENERATED::SINGLE_COLUMN_I64PT, 1);
+}
+
+TEST_F(BloomFilterTester, BLOOM_FILTER_SINGLE_COLUMN_STR) {
+	TestBloomFilter(GENERATED::SINGLE_COLUMN_STRPT, 1);
+}
+
+TEST_F(BloomFilterTester, BLOOM_FILTER_ALL_TYPES) {
+	TestBloomFilter<JSON>(GENERATED::ALL_TYPES, 64);
+}
+
+TEST_F(BloomFilterTester, BLOOM_FILTER_MOSTLY_NULL) {
+	TestBloomFilter(GENERATED::MOSTLY_NULL, 64);
+}
+
+TEST_F(BloomFilterTester, BLOOM_FILTER_SINGLE_ROW) {
+	TestBloomFilter(GENERATED::ANY_VALUE_COUNT_I64_1, 1);
+}
+
+// uncompressed strings have no filter path of their own; a value the bloom filter rules out still selects nothing.
+TEST_F(BloomFilterTester, BLOOM_FILTER_SKIPS_STR_FILTER) {
+	Connection con1;
+	con1.reset().enable_bloom_filter().force_schema_pool({OperatorToken::EXP_UNCOMPRESSED_STR});
+	con1.read_csv(fastlanes_repo_data_path / string(GENERATED::SINGLE_COLUMN_STRPT));
+	con1.to_fls(fls_file_path_process_specific);
+	const auto&  str_col = std::get<up<FLSStrColumn>>(con1.get_table().m_rowgroups[0]->internal_rowgroup[0]);
+	const string stored_value {reinterpret_cast<const char*>(str_col->str_p_arr[0]), str_col->length_arr[0]};
+
+	Connection con2;
+	const auto fls_reader      = con2.reset().read_fls(fls_file_path_process_specific);
+	auto       rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+
+	const StrPredicate absent {StrPredicateT::EQUAL, "no language is called like this"};
+	ASSERT_FALSE(rowgroup_reader->may_match(0, absent));
+	ASSERT_TRUE(rowgroup_reader->may_match(0, {StrPredicateT::EQUAL, stored_value}));
+	ASSERT_TRUE(rowgroup_reader->may_match(0, {StrPredicateT::CONTAINS, "no language is called like this"}));
+
+	const InvalidExpr logical_expr;
+	SelectionDS       selection {logical_expr};
+	selection.n_selected_values = 1;
+	ASSERT_TRUE(rowgroup_reader->filter_chunk(0, 0, absent, selection));
+	ASSERT_EQ(selection.n_selected_values, vec_idx_t {0});
+	ASSERT_FALSE(rowgroup_reader->filter_chunk(0, 0, {StrPredicateT::EQUAL, stored_value}, selection));
+}
+
+TEST(BloomFilterTest, EMPTY_STRING_HASH) {
+	ASSERT_EQ(BloomFilter::Hash(nullptr, 0), BloomFilter::Hash(string_view {}));
+	ASSERT_NE(BloomFilter::Hash(string_view {}), BloomFilter::Hash(string_view {"a"}));
+}
+
+TEST(BloomFilterTest, NO_FALSE_NEGATIVES_AND_FEW_FALSE_POSITIVES) {
+	constexpr n_t N_VALUES = 10000;
+
+	BloomFilter bloom_filter {N_VALUES};
+	for (i64_pt val {0}; val < static_cast<i64_pt>(N_VALUES); ++val) {
+		bloom_filter.Insert(BloomFilter::Hash(val));
+	}
+
+	for (i64_pt val {0}; val < static_cast<i64_pt>(N_VALUES); ++val) {
+		ASSERT_TRUE(BloomFilter::MayContain(bloom_filter.words, BloomFilter::Hash(val)));
+	}
+
+	n_t n_false_positives {0};
+	for (i64_pt val {static_cast<i64_pt>(N_VALUES)}; val < static_cast<i64_pt>(2 * N_VALUES); ++val) {
+		n_false_positives += BloomFilter::MayContain(bloom_filter.words, BloomFilter::Hash(val));
+	}
+	ASSERT_LT(n_false_positives, N_VALUES / 20);
+}
+
+TEST(BloomFilterTest, INTEGRAL_DOUBLE_HASHES_AS_INTEGER) {
+	ASSERT_EQ(BloomFilter::Hash(i64_pt {42}), BloomFilter::Hash(dbl_pt {42.0}));
+	ASSERT_EQ(BloomFilter::Hash(i08_pt {-3}), BloomFilter::Hash(i32_pt {-3}));
+	ASSERT_EQ(BloomFilter::Hash(string {"fastlanes"}), BloomFilter::Hash(string_view {"fastlanes"}));
+	ASSERT_TRUE(BloomFilter::MayContain({}, BloomFilter::Hash(i64_pt {42})));
+}
+
+} // namespace fastlanes
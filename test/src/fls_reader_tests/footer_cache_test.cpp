@@ -0,0 +1,58 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/footer_cache_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/footer/footer_cache.hpp"
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class FooterCacheTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE>
+	void TestFooterCache(const string_view table, const n_t rowgroup_size, const bool inlined_footer) const {
+		TestCorrectness<DATA_TYPE>(table, {}, rowgroup_size, inlined_footer);
+
+		Connection uncached_con;
+		const auto expected = uncached_con.reset().read_fls(fls_file_path_process_specific)->materialize();
+
+		auto& footer_cache = FooterCache::Global();
+		footer_cache.Clear();
+
+		// the first reader loads the footer, a reader of another connection finds it cached.
+		for (n_t pass {0}; pass < 2; ++pass) {
+			Connection con;
+			con.reset().enable_footer_cache();
+			ASSERT_EQ(con.get_footer_cache(), &footer_cache);
+
+			const auto table_reader = con.read_fls(fls_file_path_process_specific);
+			ASSERT_EQ(table_reader->get_n_rowgroups(), expected->get_n_rowgroups());
+			const auto decoded = table_reader->materialize();
+			auto       result  = (*expected == *decoded);
+			ASSERT_TRUE(result.is_equal) << "pass " << pass << ": column " << result.first_failed_column_idx
+			                             << " ❌ description: " << result.description;
+			ASSERT_EQ(footer_cache.Misses(), 1);
+			ASSERT_EQ(footer_cache.Hits(), pass);
+		}
+		ASSERT_EQ(footer_cache.CachedBytes(), FooterCache::Load(fls_file_path_process_specific).size());
+
+		// a rewritten file is a new entry.
+		TestCorrectness<DATA_TYPE>(table, {}, rowgroup_size, inlined_footer);
+		Connection con;
+		con.reset().enable_footer_cache().read_fls(fls_file_path_process_specific);
+		ASSERT_EQ(footer_cache.Misses(), 2);
+		footer_cache.Clear();
+	}
+};
+
+TEST_F(FooterCacheTester, FOOTER_CACHE_ALL_TYPES) {
+	TestFooterCache<JSON>(GENERATED::ALL_TYPES, 1, false);
+}
+
+TEST_F(FooterCacheTester, FOOTER_CACHE_ALL_TYPES_INLINED_FOOTER) {
+	TestFooterCache<JSON>(GENERATED::ALL_TYPES, 1, true);
+}
+
+} // namespace fastlanes
@@ -0,0 +1,58 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/forced_schema_pool_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/footer/rowgroup_descriptor.hpp"
+#include "fls/reader/rowgroup_reader.hpp"
+#include "fls_tester.hpp"
+#include <algorithm> // std::ranges::find, std::min_element
+
+namespace fastlanes {
+
+class ForcedSchemaPoolTester : public FastLanesReaderTester {
+public:
+	void TestForcedSchemaPool(const string_view table, const vector<OperatorToken>& pool) const {
+		TestCorrectness(table, pool);
+
+		Connection con;
+		const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+
+		// a forced pool is not halved: every encoding of it is evaluated, and the smallest one is chosen.
+		for (n_t rowgroup_idx {0}; rowgroup_idx < fls_reader->get_n_rowgroups(); ++rowgroup_idx) {
+			const auto  rowgroup_reader = fls_reader->get_rowgroup_reader(rowgroup_idx);
+			const auto& rowgroup        = rowgroup_reader->get_descriptor();
+			for (const auto* column_descriptor : *rowgroup.m_column_descriptors()) {
+				const auto* expr_space = column_descriptor->expr_space();
+				ASSERT_EQ(expr_space->size(), pool.size()) << "rowgroup " << rowgroup_idx;
+
+				vector<OperatorToken> evaluated;
+				for (const auto* expr : *expr_space) {
+					evaluated.push_back(expr->operator_token());
+				}
+				for (const auto token : pool) {
+					ASSERT_NE(std::ranges::find(evaluated, token), evaluated.end())
+					    << "rowgroup " << rowgroup_idx << " did not evaluate token " << static_cast<n_t>(token);
+				}
+
+				const auto* smallest = *std::min_element(
+				    expr_space->begin(), expr_space->end(), [](const auto* left, const auto* right) {
+					    return left->size() < right->size();
+				    });
+				ASSERT_EQ(column_descriptor->encoding_rpn()->operator_tokens()->Get(0), smallest->operator_token())
+				    << "rowgroup " << rowgroup_idx;
+			}
+		}
+	}
+};
+
+TEST_F(ForcedSchemaPoolTester, FORCED_SCHEMA_POOL_IS_EVALUATED_EXHAUSTIVELY) {
+	TestForcedSchemaPool(GENERATED::PARTIAL_VECTOR_I64,
+	                     {OperatorToken::EXP_UNCOMPRESSED_I64,
+	                      OperatorToken::EXP_FFOR_I64,
+	                      OperatorToken::EXP_DELTA_I64,
+	                      OperatorToken::EXP_FFOR_SLPATCH_I64,
+	                      OperatorToken::EXP_DICT_I64_U16});
+}
+
+} // namespace fastlanes
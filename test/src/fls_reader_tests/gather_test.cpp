@@ -0,0 +1,100 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/gather_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+#include <algorithm> // std::min
+#include <cstring>   // std::memcmp
+
+namespace fastlanes {
+
+class GatherTester : public FastLanesReaderTester {
+public:
+	void TestGather(const string_view table, const vector<OperatorToken>& expressions, const n_t step) const {
+		TestCorrectness(table, expressions);
+
+		Connection  con;
+		const auto  fls_reader      = con.reset().read_fls(fls_file_path_process_specific);
+		auto        rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+		const auto  decoded         = rowgroup_reader->materialize();
+		const auto& descriptor      = rowgroup_reader->get_descriptor();
+
+		ASSERT_FALSE(rowgroup_reader->gather_chunk(0, span<const vec_idx_t> {}));
+
+		vector<vec_idx_t> selected_idxs;
+		for (n_t vec_idx {0}; vec_idx < descriptor.m_n_vec(); ++vec_idx) {
+			// a partial last vector only has its own rows selected.
+			const n_t n_values = std::min(CFG::VEC_SZ, decoded->RowCount() - vec_idx * CFG::VEC_SZ);
+			selected_idxs.clear();
+			for (n_t idx {0}; idx < n_values; idx += step) {
+				selected_idxs.push_back(static_cast<vec_idx_t>(idx));
+			}
+			ASSERT_TRUE(rowgroup_reader->gather_chunk(vec_idx, selected_idxs));
+
+			for (n_t col_idx {0}; col_idx < decoded->ColCount(); ++col_idx) {
+				const auto& gathered = rowgroup_reader->get_gathered_column(col_idx);
+
+				visit(overloaded {
+				          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+					          ASSERT_TRUE(gathered.is_gathered) << "column " << col_idx << " has no gather path";
+					          const auto* gathered_p = reinterpret_cast<const PT*>(gathered.data);
+					          for (n_t idx {0}; idx < selected_idxs.size(); ++idx) {
+						          const auto row_idx = vec_idx * CFG::VEC_SZ + selected_idxs[idx];
+						          ASSERT_EQ(std::memcmp(&gathered_p[idx], &typed_col->data[row_idx], sizeof(PT)), 0)
+						              << "column " << col_idx << " row " << row_idx;
+					          }
+				          },
+				          [&](const up<FLSStrColumn>&) {
+					          ASSERT_FALSE(gathered.is_gathered) << "string column " << col_idx << " was gathered";
+				          },
+				          [&](const auto&) { FAIL() << "column " << col_idx << " is not a flat column"; },
+				      },
+				      decoded->internal_rowgroup[col_idx]);
+			}
+		}
+	}
+};
+
+TEST_F(GatherTester, GATHER_UNCOMPRESSED_I64) {
+	TestGather(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_UNCOMPRESSED_I64}, 7);
+}
+
+TEST_F(GatherTester, GATHER_FFOR_I64) {
+	TestGather(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_FFOR_I64}, 7);
+}
+
+TEST_F(GatherTester, GATHER_FFOR_I08) {
+	TestGather(GENERATED::SINGLE_COLUMN_I08PT, {OperatorToken::EXP_FFOR_I08}, 3);
+}
+
+TEST_F(GatherTester, GATHER_DICT_I64_FFOR_U16) {
+	TestGather(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_DICT_I64_FFOR_U16}, 100);
+}
+
+TEST_F(GatherTester, GATHER_FREQUENCY_DBL) {
+	TestGather(GENERATED::FREQUENCY_DBL_EXPR, {OperatorToken::EXP_FREQUENCY_DBL}, 1);
+}
+
+TEST_F(GatherTester, GATHER_FREQUENCY_I64) {
+	TestGather(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_FREQUENCY_I64}, 5);
+}
+
+TEST_F(GatherTester, GATHER_FFOR_I64_PARTIAL_LAST_VECTOR) {
+	TestGather(GENERATED::PARTIAL_VECTOR_I64, {OperatorToken::EXP_FFOR_I64}, 7);
+}
+
+TEST_F(GatherTester, GATHER_DICT_I64_FFOR_U16_PARTIAL_LAST_VECTOR) {
+	TestGather(GENERATED::PARTIAL_VECTOR_I64, {OperatorToken::EXP_DICT_I64_FFOR_U16}, 1);
+}
+
+TEST_F(GatherTester, GATHER_SINGLE_ROW) {
+	TestGather(GENERATED::ANY_VALUE_COUNT_I64_1, {}, 1);
+}
+
+// the wizard encodes every column constant; the string column has no gather path.
+TEST_F(GatherTester, GATHER_CONSTANT) {
+	TestGather(GENERATED::ALL_CONSTANT, {}, 9);
+}
+
+} // namespace fastlanes
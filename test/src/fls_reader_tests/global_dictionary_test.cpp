@@ -0,0 +1,19 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/global_dictionary_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+// one reader over all rowgroups: the dictionary they share is read once and its matches are reused.
+TEST_F(FastLanesReaderTester, GLOBAL_DICTIONARY_DICT_STR_FFOR_U16) {
+	TestCorrectness(GENERATED::FSST_DICT_U16_EXPR, [](Connection& con) {
+		con.set_n_vectors_per_rowgroup(8).enable_global_dictionaries().force_schema_pool(
+		    {OperatorToken::EXP_DICT_STR_FFOR_U16});
+	});
+	TestFilterAcrossRowgroups(1, OperatorToken::EXP_GLOBAL_DICT_STR_FFOR_U16);
+}
+
+} // namespace fastlanes
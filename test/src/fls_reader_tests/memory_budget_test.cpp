@@ -0,0 +1,114 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/memory_budget_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls/reader/rowgroup_cache.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class MemoryBudgetTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE = FileT::CSV>
+	void TestMemoryBudget(const string_view table, const n_t rowgroup_size) const {
+		TestCorrectness<DATA_TYPE>(table, {}, rowgroup_size);
+
+		// the footprint of one rowgroup reader, for the largest rowgroup.
+		n_t rowgroup_footprint {0};
+		{
+			Connection con;
+			const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+			ASSERT_GT(fls_reader->get_n_rowgroups(), 2);
+			for (n_t rowgroup_idx {0}; rowgroup_idx < fls_reader->get_n_rowgroups(); ++rowgroup_idx) {
+				const auto rowgroup_reader = fls_reader->get_rowgroup_reader(rowgroup_idx);
+				ASSERT_GT(con.get_memory_usage(), 0);
+				rowgroup_footprint = std::max(rowgroup_footprint, con.get_memory_usage());
+			}
+		}
+
+		// expected values, read without a budget: every rowgroup stays cached.
+		Connection unlimited_con;
+		const auto unlimited_reader = unlimited_con.reset().read_fls(fls_file_path_process_specific);
+		const n_t  n_tuples         = unlimited_reader->get_n_tuples();
+		const n_t  n_cols           = unlimited_reader->get_rowgroup_reader(0)->get_column_names().size();
+		vector<fls_value_t> expected;
+		for (n_t row_id {0}; row_id < n_tuples; row_id += 97) {
+			for (n_t col_idx {0}; col_idx < n_cols; ++col_idx) {
+				expected.push_back(unlimited_reader->get_value(row_id, col_idx));
+			}
+		}
+		ASSERT_GT(unlimited_con.get_peak_memory_usage(), 2 * rowgroup_footprint);
+
+		// room for two rowgroups: the same values, never more memory.
+		{
+			Connection con;
+			con.reset().set_memory_budget(2 * rowgroup_footprint);
+			{
+				const auto fls_reader = con.read_fls(fls_file_path_process_specific);
+				n_t        idx {0};
+				for (n_t row_id {0}; row_id < n_tuples; row_id += 97) {
+					for (n_t col_idx {0}; col_idx < n_cols; ++col_idx) {
+						ASSERT_EQ(fls_reader->get_value(row_id, col_idx), expected[idx++])
+						    << "row " << row_id << " column " << col_idx;
+					}
+				}
+				ASSERT_LE(con.get_peak_memory_usage(), 2 * rowgroup_footprint);
+			}
+			ASSERT_EQ(con.get_memory_usage(), 0);
+		}
+
+		// a parallel scan under the same budget holds readers back instead of failing.
+		{
+			const auto expected_table = unlimited_reader->materialize();
+
+			Connection con;
+			con.reset().set_memory_budget(2 * rowgroup_footprint).set_n_scan_threads(4);
+			{
+				const auto fls_reader = con.read_fls(fls_file_path_process_specific);
+				const auto decoded    = fls_reader->materialize();
+				auto       result     = (*expected_table == *decoded);
+				ASSERT_TRUE(result.is_equal) << "column " << result.first_failed_column_idx
+				                             << " ❌ description: " << result.description;
+				ASSERT_LE(con.get_peak_memory_usage(), 2 * rowgroup_footprint);
+			}
+			ASSERT_EQ(con.get_memory_usage(), 0);
+		}
+
+		// a rowgroup held from the rowgroup cache counts as much as one the reader reads itself, hit or miss.
+		{
+			Connection uncached_con;
+			const auto uncached_reader          = uncached_con.reset().read_fls(fls_file_path_process_specific);
+			const auto uncached_rowgroup_reader = uncached_reader->get_rowgroup_reader(0);
+
+			RowgroupCache::Global().Clear();
+			for (n_t pass {0}; pass < 2; ++pass) {
+				Connection con;
+				con.reset().enable_rowgroup_cache();
+				{
+					const auto fls_reader      = con.read_fls(fls_file_path_process_specific);
+					const auto rowgroup_reader = fls_reader->get_rowgroup_reader(0);
+					ASSERT_EQ(con.get_memory_usage(), uncached_con.get_memory_usage()) << "pass " << pass;
+				}
+				ASSERT_EQ(con.get_memory_usage(), 0) << "pass " << pass;
+			}
+			RowgroupCache::Global().Clear();
+		}
+
+		// a budget smaller than a single rowgroup is a hard error.
+		{
+			Connection con;
+			con.reset().set_memory_budget(1);
+			const auto fls_reader = con.read_fls(fls_file_path_process_specific);
+			ASSERT_THROW(static_cast<void>(fls_reader->get_value(0, 0)), std::runtime_error);
+			ASSERT_EQ(con.get_memory_usage(), 0);
+		}
+	}
+};
+
+TEST_F(MemoryBudgetTester, MEMORY_BUDGET_ALL_TYPES) {
+	TestMemoryBudget<JSON>(GENERATED::ALL_TYPES, 1);
+}
+
+} // namespace fastlanes
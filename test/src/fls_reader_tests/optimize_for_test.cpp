@@ -0,0 +1,26 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/optimize_for_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+// whatever the encodings were chosen for, they decode to the same table.
+TEST_F(FastLanesReaderTester, OPTIMIZE_FOR_SPEED_ALL_TYPES) {
+	TestCorrectness<JSON>(GENERATED::ALL_TYPES, [](Connection& con) {
+		con.optimize_for(OptimizeFor::SPEED);
+		ASSERT_EQ(con.get_optimize_for(), OptimizeFor::SPEED);
+	});
+}
+
+TEST_F(FastLanesReaderTester, OPTIMIZE_FOR_BALANCED_ALL_TYPES) {
+	TestCorrectness<JSON>(GENERATED::ALL_TYPES, [](Connection& con) {
+		con.optimize_for(OptimizeFor::BALANCED);
+		ASSERT_EQ(con.get_optimize_for(), OptimizeFor::BALANCED);
+	});
+}
+
+} // namespace fastlanes
@@ -0,0 +1,42 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/parallel_scan_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class ParallelScanTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE = FileT::CSV>
+	void TestParallelScan(const string_view table, const n_t rowgroup_size, const n_t n_threads) const {
+		TestCorrectness<DATA_TYPE>(table, {}, rowgroup_size);
+
+		Connection sequential_con;
+		const auto expected = sequential_con.reset().read_fls(fls_file_path_process_specific)->materialize();
+
+		Connection parallel_con;
+		parallel_con.reset().set_n_scan_threads(n_threads);
+		ASSERT_EQ(parallel_con.get_n_scan_threads(), n_threads);
+		const auto decoded = parallel_con.read_fls(fls_file_path_process_specific)->materialize();
+
+		// the rowgroups come back in file order whichever worker read them.
+		ASSERT_EQ(decoded->get_n_rowgroups(), expected->get_n_rowgroups());
+		auto result = (*expected == *decoded);
+		ASSERT_TRUE(result.is_equal) << "column " << result.first_failed_column_idx
+		                             << " ❌ description: " << result.description;
+	}
+};
+
+TEST_F(ParallelScanTester, PARALLEL_SCAN_ALL_TYPES) {
+	TestParallelScan<JSON>(GENERATED::ALL_TYPES, 1, 4);
+}
+
+// more workers than rowgroups, and a last rowgroup that ends in a partial vector.
+TEST_F(ParallelScanTester, PARALLEL_SCAN_MORE_THREADS_THAN_ROWGROUPS) {
+	TestParallelScan(GENERATED::ANY_VALUE_COUNT_I64_52422, 8, 16);
+}
+
+} // namespace fastlanes
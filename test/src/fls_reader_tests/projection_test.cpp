@@ -0,0 +1,64 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/projection_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class ProjectionTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE>
+	void TestProjection(const string_view table, const vector<idx_t>& idxs) const {
+		const path dir_path = fastlanes_repo_data_path / string(table);
+
+		Connection full_con;
+		full_con.reset();
+		Connection projected_con;
+		projected_con.reset();
+		if constexpr (DATA_TYPE == FileT::CSV) {
+			full_con.read_csv(dir_path);
+			projected_con.read_csv(dir_path);
+		} else {
+			full_con.read_json(dir_path);
+			projected_con.read_json(dir_path);
+		}
+		projected_con.project(idxs);
+
+		// the projected columns keep their descriptors and rows, in the order of `idxs`.
+		const auto& full_table      = full_con.get_table();
+		const auto& projected_table = projected_con.get_table();
+		ASSERT_EQ(projected_table.get_n_rowgroups(), full_table.get_n_rowgroups());
+		for (n_t rowgroup_idx {0}; rowgroup_idx < full_table.get_n_rowgroups(); ++rowgroup_idx) {
+			const auto& full_rowgroup      = full_table.GetRowgroup(rowgroup_idx);
+			const auto& projected_rowgroup = projected_table.GetRowgroup(rowgroup_idx);
+			ASSERT_EQ(projected_rowgroup.ColCount(), idxs.size());
+			ASSERT_EQ(projected_rowgroup.n_tup, full_rowgroup.n_tup);
+			for (n_t new_idx {0}; new_idx < idxs.size(); ++new_idx) {
+				const auto& projected_descriptor = *projected_rowgroup.m_descriptor.m_column_descriptors[new_idx];
+				const auto& full_descriptor      = *full_rowgroup.m_descriptor.m_column_descriptors[idxs[new_idx]];
+				ASSERT_EQ(projected_descriptor.name, full_descriptor.name);
+				ASSERT_EQ(projected_descriptor.data_type, full_descriptor.data_type);
+				ASSERT_EQ(projected_descriptor.idx, new_idx);
+			}
+		}
+
+		// and the projected table encodes and decodes like any other.
+		projected_con.to_fls(fls_file_path_process_specific);
+		Connection decode_con;
+		const auto decoded = decode_con.reset().read_fls(fls_file_path_process_specific)->materialize();
+		auto       result  = (projected_table == *decoded);
+		ASSERT_TRUE(result.is_equal) << "column " << result.first_failed_column_idx
+		                             << " ❌ description: " << result.description;
+
+		ASSERT_THROW(full_con.project({0, 0}), std::runtime_error);
+	}
+};
+
+TEST_F(ProjectionTester, PROJECTION_ALL_TYPES) {
+	TestProjection<JSON>(GENERATED::ALL_TYPES, {2, 0, 1});
+}
+
+} // namespace fastlanes
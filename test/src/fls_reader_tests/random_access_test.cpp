@@ -0,0 +1,114 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/random_access_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+#include <algorithm> // std::reverse
+#include <stdexcept> // std::out_of_range
+
+namespace fastlanes {
+
+class RandomAccessTester : public FastLanesReaderTester {
+public:
+	void TestRandomAccess(const string_view table, const vector<OperatorToken>& expressions) const {
+		TestCorrectness(table, expressions);
+
+		Connection con;
+		const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+		const auto decoded    = fls_reader->materialize();
+		const auto n_tuples   = fls_reader->get_n_tuples();
+
+		// expected value of every row, taken from the fully decoded table.
+		vector<fls_value_t> expected;
+		vector<n_t>         col_idxs;
+		for (const auto& rowgroup : decoded->m_rowgroups) {
+			col_idxs.resize(rowgroup->ColCount());
+			visit(overloaded {
+			          [&](const up<FLSStrColumn>& str_col) {
+				          n_t offset {0};
+				          for (const auto length : str_col->length_arr) {
+					          expected.emplace_back(
+					              string(reinterpret_cast<const char*>(str_col->byte_arr.data() + offset), length));
+					          offset += length;
+				          }
+			          },
+			          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+				          if constexpr (!std::is_same_v<PT, str_pt>) {
+					          for (const auto& value : typed_col->data) {
+						          expected.emplace_back(value);
+					          }
+				          }
+			          },
+			          [&](const auto&) {},
+			      },
+			      rowgroup->internal_rowgroup[0]);
+		}
+		ASSERT_EQ(expected.size(), n_tuples);
+		for (n_t col_idx {0}; col_idx < col_idxs.size(); ++col_idx) {
+			col_idxs[col_idx] = col_idx;
+		}
+
+		// single rows, spread over vectors and rowgroups.
+		vector<n_t> row_ids;
+		for (n_t row_id {0}; row_id < n_tuples; row_id += 97) {
+			ASSERT_EQ(fls_reader->get_value(row_id, 0), expected[row_id]) << "row " << row_id;
+			row_ids.push_back(row_id);
+		}
+		ASSERT_EQ(fls_reader->get_value(n_tuples - 1, 0), expected[n_tuples - 1]);
+		ASSERT_THROW(static_cast<void>(fls_reader->get_value(n_tuples, 0)), std::out_of_range);
+
+		// a batch in descending order with duplicates.
+		row_ids.push_back(0);
+		std::reverse(row_ids.begin(), row_ids.end());
+		const span<const n_t> first_col {col_idxs.data(), 1};
+		const auto            rows = fls_reader->get_rows(row_ids, first_col);
+		ASSERT_EQ(rows.size(), row_ids.size());
+		for (n_t idx {0}; idx < row_ids.size(); ++idx) {
+			ASSERT_EQ(rows[idx], expected[row_ids[idx]]) << "row " << row_ids[idx];
+		}
+
+		// all columns at once agree with one column at a time.
+		const auto all_cols = fls_reader->get_rows(row_ids, col_idxs);
+		ASSERT_EQ(all_cols.size(), row_ids.size() * col_idxs.size());
+		for (n_t idx {0}; idx < row_ids.size(); ++idx) {
+			for (n_t col_idx {0}; col_idx < col_idxs.size(); ++col_idx) {
+				ASSERT_EQ(all_cols[idx * col_idxs.size() + col_idx], fls_reader->get_value(row_ids[idx], col_idx));
+			}
+		}
+	}
+};
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_UNCOMPRESSED_I64) {
+	TestRandomAccess(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_UNCOMPRESSED_I64});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_FFOR_I64) {
+	TestRandomAccess(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_FFOR_I64});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_FFOR_I64_PARTIAL_LAST_VECTOR) {
+	TestRandomAccess(GENERATED::PARTIAL_VECTOR_I64, {OperatorToken::EXP_FFOR_I64});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_SINGLE_ROW) {
+	TestRandomAccess(GENERATED::ANY_VALUE_COUNT_I64_1, {});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_DICT_I64_FFOR_U16) {
+	TestRandomAccess(GENERATED::SINGLE_COLUMN_I64PT, {OperatorToken::EXP_DICT_I64_FFOR_U16});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_RLE_DBL_U16) {
+	TestRandomAccess(GENERATED::ONE_VEC_DBLPT, {OperatorToken::EXP_RLE_DBL_U16});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_FSST_DICT_STR_FFOR_U16) {
+	TestRandomAccess(GENERATED::FSST_DICT_U16_EXPR, {OperatorToken::EXP_FSST_DICT_STR_FFOR_U16});
+}
+
+TEST_F(RandomAccessTester, RANDOM_ACCESS_FSST_DELTA) {
+	TestRandomAccess(GENERATED::SINGLE_COLUMN_STRPT, {OperatorToken::EXP_FSST_DELTA});
+}
+
+} // namespace fastlanes
@@ -0,0 +1,55 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/rowgroup_cache_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls/reader/rowgroup_cache.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class RowgroupCacheTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE = FileT::CSV>
+	void TestRowgroupCache(const string_view table, const n_t rowgroup_size) const {
+		TestCorrectness<DATA_TYPE>(table, {}, rowgroup_size);
+
+		Connection uncached_con;
+		const auto expected = uncached_con.reset().read_fls(fls_file_path_process_specific)->materialize();
+		const n_t  n_rgs    = expected->get_n_rowgroups();
+
+		auto& rowgroup_cache = RowgroupCache::Global();
+		rowgroup_cache.Clear();
+
+		// the first reader misses every rowgroup, a reader of another connection hits them all.
+		for (n_t pass {0}; pass < 2; ++pass) {
+			Connection con;
+			con.reset().enable_rowgroup_cache();
+			ASSERT_EQ(con.get_rowgroup_cache(), &rowgroup_cache);
+
+			const auto decoded = con.read_fls(fls_file_path_process_specific)->materialize();
+			auto       result  = (*expected == *decoded);
+			ASSERT_TRUE(result.is_equal) << "pass " << pass << ": column " << result.first_failed_column_idx
+			                             << " ❌ description: " << result.description;
+			ASSERT_EQ(rowgroup_cache.Misses(), n_rgs);
+			ASSERT_EQ(rowgroup_cache.Hits(), pass * n_rgs);
+		}
+		ASSERT_GT(rowgroup_cache.CachedBytes(), 0);
+		rowgroup_cache.Clear();
+	}
+};
+
+TEST_F(RowgroupCacheTester, ROWGROUP_CACHE_ALL_TYPES) {
+	TestRowgroupCache<JSON>(GENERATED::ALL_TYPES, 1);
+}
+
+TEST_F(RowgroupCacheTester, ROWGROUP_CACHE_PARTIAL_LAST_VECTOR) {
+	TestRowgroupCache(GENERATED::ANY_VALUE_COUNT_I64_52422, 4);
+}
+
+TEST_F(RowgroupCacheTester, ROWGROUP_CACHE_MOSTLY_NULL) {
+	TestRowgroupCache(GENERATED::MOSTLY_NULL, 1);
+}
+
+} // namespace fastlanes
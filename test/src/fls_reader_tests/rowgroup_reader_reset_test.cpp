@@ -0,0 +1,53 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/rowgroup_reader_reset_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+#include <stdexcept> // std::out_of_range
+
+namespace fastlanes {
+
+class RowgroupReaderResetTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE = FileT::CSV>
+	void TestRowgroupReaderReset(const string_view table, const n_t rowgroup_size) const {
+		TestCorrectness<DATA_TYPE>(table, {}, rowgroup_size);
+
+		Connection con;
+		const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+		const n_t  n_rgs      = fls_reader->get_n_rowgroups();
+		ASSERT_GT(n_rgs, 1);
+
+		// backwards and then back to the last rowgroup, so the reader jumps in both directions.
+		vector<n_t> rowgroup_idxs;
+		for (n_t rowgroup_idx {n_rgs}; rowgroup_idx > 0; --rowgroup_idx) {
+			rowgroup_idxs.push_back(rowgroup_idx - 1);
+		}
+		rowgroup_idxs.push_back(n_rgs - 1);
+
+		const auto reused_reader = fls_reader->get_rowgroup_reader(0);
+		for (const auto rowgroup_idx : rowgroup_idxs) {
+			reused_reader->reset(rowgroup_idx);
+			const auto reused   = reused_reader->materialize();
+			const auto expected = fls_reader->get_rowgroup_reader(rowgroup_idx)->materialize();
+
+			auto result = (*expected == *reused);
+			ASSERT_TRUE(result.is_equal) << "rowgroup " << rowgroup_idx << " differs after reset. column "
+			                             << result.first_failed_column_idx << " ❌ description: " << result.description;
+		}
+
+		ASSERT_THROW(reused_reader->reset(n_rgs), std::out_of_range);
+	}
+};
+
+TEST_F(RowgroupReaderResetTester, ROWGROUP_READER_RESET_ALL_TYPES) {
+	TestRowgroupReaderReset<JSON>(GENERATED::ALL_TYPES, 1);
+}
+
+TEST_F(RowgroupReaderResetTester, ROWGROUP_READER_RESET_PARTIAL_LAST_VECTOR) {
+	TestRowgroupReaderReset(GENERATED::ANY_VALUE_COUNT_I64_52422, 4);
+}
+
+} // namespace fastlanes
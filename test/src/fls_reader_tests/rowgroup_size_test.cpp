@@ -3,11 +3,39 @@
 // ────────────────────────────────────────────────────────
 // test/src/fls_reader_tests/rowgroup_size_test.cpp
 // ────────────────────────────────────────────────────────
+#include "fls/footer/rowgroup_descriptor.hpp"
 #include "fls/json/fls_json.hpp"
+#include "fls/reader/rowgroup_reader.hpp"
 #include "fls_tester.hpp"
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::runtime_error
 
 namespace fastlanes {
 
+class RowgroupSizeTester : public FastLanesReaderTester {
+public:
+	void TestRowgroupByteBudget(const string_view table, const n_t small_budget, const n_t large_budget) const {
+		TestCorrectness(table, [&](Connection& con) { con.set_rowgroup_byte_budget(small_budget); });
+
+		const path dir_path = fastlanes_repo_data_path / string(table);
+		Connection large_con;
+		large_con.reset().set_rowgroup_byte_budget(large_budget).read_csv(dir_path);
+
+		Connection con;
+		const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+		const n_t  n_rgs      = fls_reader->get_n_rowgroups();
+		ASSERT_GT(n_rgs, large_con.get_table().get_n_rowgroups());
+
+		// every rowgroup but the last holds whole vectors, within the bounds of a rowgroup sized by its budget.
+		for (n_t rowgroup_idx {0}; rowgroup_idx + 1 < n_rgs; ++rowgroup_idx) {
+			const auto& descriptor = fls_reader->get_rowgroup_reader(rowgroup_idx)->get_descriptor();
+			ASSERT_EQ(descriptor.m_n_tuples(), descriptor.m_n_vec() * CFG::VEC_SZ) << "rowgroup " << rowgroup_idx;
+			ASSERT_GE(descriptor.m_n_vec(), CFG::RowGroup::MIN_N_VECTORS) << "rowgroup " << rowgroup_idx;
+			ASSERT_LE(descriptor.m_n_vec(), CFG::RowGroup::MAX_N_VECTORS) << "rowgroup " << rowgroup_idx;
+		}
+	}
+};
+
 // Equalities
 TEST_F(FastLanesReaderTester, ALL_TYPES_1) {
 	TestCorrectness<JSON>(GENERATED::ALL_TYPES, //
@@ -27,4 +55,47 @@ TEST_F(FastLanesReaderTester, ALL_TYPES_32) {
 	                      32);
 }
 
+// Byte budgets
+TEST_F(RowgroupSizeTester, ROWGROUP_BYTE_BUDGET) {
+	TestRowgroupByteBudget(GENERATED::FSST_DICT_U16_EXPR, 256 * 1024, 64 * 1024 * 1024);
+}
+
+// the smallest budget gives one vector per rowgroup.
+TEST_F(RowgroupSizeTester, ROWGROUP_BYTE_BUDGET_BOUNDS) {
+	TestRowgroupByteBudget(
+	    GENERATED::FSST_DICT_U16_EXPR, CFG::RowGroup::MIN_BYTE_BUDGET, std::numeric_limits<n_t>::max());
+
+	Connection con;
+	const auto fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+	for (n_t rowgroup_idx {0}; rowgroup_idx < fls_reader->get_n_rowgroups(); ++rowgroup_idx) {
+		ASSERT_EQ(fls_reader->get_rowgroup_reader(rowgroup_idx)->get_descriptor().m_n_vec(), n_t {1})
+		    << "rowgroup " << rowgroup_idx;
+	}
+}
+
+// the largest budget is capped at CFG::RowGroup::MAX_N_VECTORS, whose rowgroup holds more distinct values than a 16-bit
+// dictionary index addresses, so column 1 maps column 0 through a 32-bit one.
+TEST_F(RowgroupSizeTester, ROWGROUP_BYTE_BUDGET_MAX_N_VECTORS) {
+	TestCorrectness(GENERATED::ONE_TO_ONE_U32_INDEX, [](Connection& con) {
+		con.set_rowgroup_byte_budget(std::numeric_limits<n_t>::max());
+	});
+	TestMap1To1({1});
+
+	Connection  con;
+	const auto  fls_reader = con.reset().read_fls(fls_file_path_process_specific);
+	const auto& descriptor = fls_reader->get_rowgroup_reader(0)->get_descriptor();
+	ASSERT_EQ(fls_reader->get_n_rowgroups(), n_t {2});
+	ASSERT_EQ(descriptor.m_n_vec(), CFG::RowGroup::MAX_N_VECTORS);
+	ASSERT_EQ(descriptor.m_column_descriptors()->Get(1)->encoding_rpn()->operator_tokens()->Get(0),
+	          OperatorToken::EXP_DICT_U32_U32);
+}
+
+TEST_F(RowgroupSizeTester, ROWGROUP_BYTE_BUDGET_TOO_SMALL) {
+	Connection con;
+	ASSERT_THROW(con.reset().set_rowgroup_byte_budget(CFG::RowGroup::MIN_BYTE_BUDGET - 1), std::runtime_error);
+	ASSERT_THROW(con.set_rowgroup_byte_budget(1), std::runtime_error);
+	ASSERT_NO_THROW(con.set_rowgroup_byte_budget(0));
+	ASSERT_NO_THROW(con.set_rowgroup_byte_budget(CFG::RowGroup::MIN_BYTE_BUDGET));
+}
+
 } // namespace fastlanes
@@ -0,0 +1,51 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/schema_cache_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/json/fls_json.hpp"
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+class SchemaCacheTester : public FastLanesReaderTester {
+public:
+	template <FileT DATA_TYPE>
+	void TestSchemaCache(const string_view table, const n_t rowgroup_size) const {
+		// every rowgroup after the first is decided through the cache of the previous ones.
+		TestCorrectness<DATA_TYPE>(table, [&](Connection& con) {
+			con.set_n_vectors_per_rowgroup(rowgroup_size).enable_schema_cache();
+			ASSERT_NE(con.get_schema_cache(), nullptr);
+		});
+
+		// a second file starts from the decisions of the first, and decodes to the same table.
+		const path dir_path         = fastlanes_repo_data_path / string(table);
+		const path reused_file_path = fls_dir_path_process_specific / "reused.fls";
+		Connection reuse_con;
+		reuse_con.reset().set_n_vectors_per_rowgroup(rowgroup_size).reuse_schema(fls_file_path_process_specific);
+		ASSERT_GT(reuse_con.get_schema_cache()->Size(), 0);
+		if constexpr (DATA_TYPE == FileT::CSV) {
+			reuse_con.read_csv(dir_path);
+		} else {
+			reuse_con.read_json(dir_path);
+		}
+		reuse_con.to_fls(reused_file_path);
+		ASSERT_GT(reuse_con.get_schema_cache()->Hits(), 0);
+
+		Connection decode_con;
+		const auto decoded = decode_con.reset().read_fls(reused_file_path)->materialize();
+		auto       result  = (reuse_con.get_table() == *decoded);
+		ASSERT_TRUE(result.is_equal) << "column " << result.first_failed_column_idx
+		                             << " ❌ description: " << result.description;
+	}
+};
+
+TEST_F(SchemaCacheTester, SCHEMA_CACHE_ALL_TYPES_1) {
+	TestSchemaCache<JSON>(GENERATED::ALL_TYPES, 1);
+}
+
+TEST_F(SchemaCacheTester, SCHEMA_CACHE_ALL_TYPES_32) {
+	TestSchemaCache<JSON>(GENERATED::ALL_TYPES, 32);
+}
+
+} // namespace fastlanes
@@ -0,0 +1,27 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/shared_symbol_table_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+
+namespace fastlanes {
+
+// one reader over all rowgroups: the symbol table they share is imported once and its matcher is reused.
+TEST_F(FastLanesReaderTester, SHARED_SYMBOL_TABLE_FSST_DELTA) {
+	TestCorrectness(GENERATED::FSST_DICT_U16_EXPR, [](Connection& con) {
+		con.set_n_vectors_per_rowgroup(8).enable_shared_symbol_tables().force_schema_pool(
+		    {OperatorToken::EXP_FSST_DELTA});
+	});
+	TestFilterAcrossRowgroups(1, OperatorToken::EXP_SHARED_FSST_DELTA);
+}
+
+TEST_F(FastLanesReaderTester, SHARED_SYMBOL_TABLE_FSST12_DELTA) {
+	TestCorrectness(GENERATED::FSST_DICT_U16_EXPR, [](Connection& con) {
+		con.set_n_vectors_per_rowgroup(8).enable_shared_symbol_tables().force_schema_pool(
+		    {OperatorToken::EXP_FSST12_DELTA});
+	});
+	TestFilterAcrossRowgroups(1, OperatorToken::EXP_SHARED_FSST12_DELTA);
+}
+
+} // namespace fastlanes
@@ -0,0 +1,146 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/fls_reader_tests/sort_by_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls_tester.hpp"
+#include <algorithm> // std::ranges::sort
+#include <stdexcept> // std::runtime_error
+
+namespace fastlanes {
+
+class SortByTester : public FastLanesReaderTester {
+public:
+	void TestSortBy(const string_view    table,
+	                const vector<idx_t>& key_idxs,
+	                const SortOrder      order,
+	                const n_t            rowgroup_size) const {
+		const path dir_path = fastlanes_repo_data_path / string(table);
+
+		Connection unsorted_con;
+		unsorted_con.reset().set_n_vectors_per_rowgroup(rowgroup_size).read_csv(dir_path);
+		const auto& unsorted_table = unsorted_con.get_table();
+
+		Connection con;
+		con.reset().set_n_vectors_per_rowgroup(rowgroup_size).sort_by(key_idxs, order);
+		con.read_csv(dir_path);
+		con.to_fls(fls_file_path_process_specific);
+		const auto& sorted_table = con.get_table();
+		ASSERT_EQ(sorted_table.get_n_rowgroups(), unsorted_table.get_n_rowgroups());
+
+		// the sorted table is what the file holds.
+		{
+			Connection decode_con;
+			const auto fls_reader = decode_con.reset().read_fls(fls_file_path_process_specific);
+			const auto decoded    = fls_reader->materialize();
+			auto       result     = (sorted_table == *decoded);
+			ASSERT_TRUE(result.is_equal) << "column " << result.first_failed_column_idx
+			                             << " ❌ description: " << result.description;
+		}
+
+		for (n_t rowgroup_idx {0}; rowgroup_idx < sorted_table.get_n_rowgroups(); ++rowgroup_idx) {
+			const auto& rowgroup = *sorted_table.m_rowgroups[rowgroup_idx];
+
+			// the rows only moved within their rowgroup.
+			auto sorted_rows   = RowsOf(rowgroup);
+			auto unsorted_rows = RowsOf(*unsorted_table.m_rowgroups[rowgroup_idx]);
+			std::ranges::sort(sorted_rows);
+			std::ranges::sort(unsorted_rows);
+			ASSERT_EQ(sorted_rows, unsorted_rows) << "rowgroup " << rowgroup_idx;
+
+			if (order != SortOrder::LEXICOGRAPHIC) {
+				continue;
+			}
+
+			// nulls first, then the values of the first key in ascending order.
+			visit(overloaded {
+			          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+				          const auto& data = typed_col->data;
+				          for (n_t row_idx {1}; row_idx < rowgroup.n_tup; ++row_idx) {
+					          if (typed_col->null_map_arr[row_idx - 1]) {
+						          continue;
+					          }
+					          ASSERT_FALSE(typed_col->null_map_arr[row_idx]) << "row " << row_idx;
+					          ASSERT_FALSE(data[row_idx] < data[row_idx - 1]) << "row " << row_idx;
+				          }
+			          },
+			          [&](const up<FLSStrColumn>& str_col) {
+				          for (n_t row_idx {1}; row_idx < rowgroup.n_tup; ++row_idx) {
+					          if (str_col->null_map_arr[row_idx - 1]) {
+						          continue;
+					          }
+					          const auto*       strings = str_col->str_p_arr.data();
+					          const auto*       lengths = str_col->length_arr.data();
+					          const string_view previous {reinterpret_cast<const char*>(strings[row_idx - 1]),
+					                                      lengths[row_idx - 1]};
+					          const string_view current {reinterpret_cast<const char*>(strings[row_idx]),
+					                                     lengths[row_idx]};
+					          ASSERT_FALSE(str_col->null_map_arr[row_idx]) << "row " << row_idx;
+					          ASSERT_FALSE(current < previous) << "row " << row_idx;
+				          }
+			          },
+			          [&](const auto&) { FAIL() << "column " << key_idxs[0] << " is not a flat column"; },
+			      },
+			      rowgroup.internal_rowgroup[key_idxs[0]]);
+		}
+	}
+
+	// the rows of a rowgroup of flat columns, as the bytes of their values, to compare rowgroups whose rows moved.
+	static vector<string> RowsOf(const Rowgroup& rowgroup) {
+		vector<string> rows(rowgroup.n_tup);
+		for (const auto& column : rowgroup.internal_rowgroup) {
+			visit(overloaded {
+			          [&]<typename PT>(const up<TypedCol<PT>>& typed_col) {
+				          if constexpr (std::is_arithmetic_v<PT>) {
+					          const auto* bytes = reinterpret_cast<const char*>(typed_col->data.data());
+					          for (n_t row_idx {0}; row_idx < rows.size(); ++row_idx) {
+						          rows[row_idx].append(bytes + row_idx * sizeof(PT), sizeof(PT));
+					          }
+				          } else {
+					          FAIL() << "only flat columns are compared";
+				          }
+			          },
+			          [&](const up<FLSStrColumn>& str_col) {
+				          n_t offset {0};
+				          for (n_t row_idx {0}; row_idx < rows.size(); ++row_idx) {
+					          rows[row_idx].append(reinterpret_cast<const char*>(str_col->byte_arr.data() + offset),
+					                               str_col->length_arr[row_idx]);
+					          rows[row_idx].push_back('|');
+					          offset += str_col->length_arr[row_idx];
+				          }
+			          },
+			          [&](const auto&) { FAIL() << "only flat columns are compared"; },
+			      },
+			      column);
+		}
+		return rows;
+	}
+};
+
+TEST_F(SortByTester, SORT_BY_DOUBLE) {
+	TestSortBy(GENERATED::FSST_DICT_U16_EXPR, {0}, SortOrder::LEXICOGRAPHIC, 16);
+}
+
+TEST_F(SortByTester, SORT_BY_STRING_THEN_DOUBLE) {
+	TestSortBy(GENERATED::FSST_DICT_U16_EXPR, {1, 0}, SortOrder::LEXICOGRAPHIC, 16);
+}
+
+TEST_F(SortByTester, SORT_BY_Z_ORDER) {
+	TestSortBy(GENERATED::FSST_DICT_U16_EXPR, {0, 1}, SortOrder::Z_ORDER, 16);
+}
+
+TEST_F(SortByTester, SORT_BY_MOSTLY_NULL) {
+	TestSortBy(GENERATED::MOSTLY_NULL, {0}, SortOrder::LEXICOGRAPHIC, 16);
+}
+
+TEST_F(SortByTester, SORT_BY_PARTIAL_LAST_VECTOR) {
+	TestSortBy(GENERATED::ANY_VALUE_COUNT_I64_52422, {0}, SortOrder::Z_ORDER, 8);
+}
+
+TEST_F(SortByTester, SORT_BY_KEY_OUT_OF_RANGE) {
+	Connection con;
+	con.reset().sort_by({2}).read_csv(fastlanes_repo_data_path / string(GENERATED::FSST_DICT_U16_EXPR));
+	ASSERT_THROW(con.to_fls(fls_file_path_process_specific), std::runtime_error);
+}
+
+} // namespace fastlanes
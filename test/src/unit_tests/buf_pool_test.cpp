@@ -0,0 +1,109 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/unit_tests/buf_pool_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cor/lyt/buf.hpp"
+#include "fls/cor/lyt/buf_pool.hpp"
+#include "gtest/gtest.h"
+#include <cstring>
+
+using namespace fastlanes; // NOLINT
+
+class BufPoolTest : public ::testing::Test {};
+
+TEST_F(BufPoolTest, SizeClasses) {
+	EXPECT_EQ(BufPool::SizeClass(1), BufPool::MIN_BLOCK_SIZE);
+	EXPECT_EQ(BufPool::SizeClass(BufPool::MIN_BLOCK_SIZE), BufPool::MIN_BLOCK_SIZE);
+	EXPECT_EQ(BufPool::SizeClass(BufPool::MIN_BLOCK_SIZE + 1), 2 * BufPool::MIN_BLOCK_SIZE);
+	EXPECT_EQ(BufPool::SizeClass(1000 * 1000), 1024 * 1024);
+}
+
+TEST_F(BufPoolTest, ReleasedBlocksAreReused) {
+	BufPool pool {1024 * 1024};
+
+	n_t      capacity {5000};
+	uint8_t* block = pool.Acquire(capacity);
+	EXPECT_EQ(capacity, 8 * 1024);
+	pool.Release(block, capacity);
+	EXPECT_EQ(pool.RetainedBytes(), 8 * 1024);
+
+	// same size class: the same block comes back.
+	n_t other_capacity {6000};
+	EXPECT_EQ(pool.Acquire(other_capacity), block);
+	EXPECT_EQ(pool.RetainedBytes(), 0);
+	pool.Release(block, other_capacity);
+
+	pool.Trim();
+	EXPECT_EQ(pool.RetainedBytes(), 0);
+}
+
+TEST_F(BufPoolTest, RetainsAtMostItsLimit) {
+	BufPool pool {16 * 1024};
+
+	n_t      capacity {16 * 1024};
+	uint8_t* first  = pool.Acquire(capacity);
+	uint8_t* second = pool.Acquire(capacity);
+	pool.Release(first, capacity);
+	pool.Release(second, capacity);
+	EXPECT_EQ(pool.RetainedBytes(), 16 * 1024);
+}
+
+TEST_F(BufPoolTest, BufResizeKeepsData) {
+	Buf buf {BufPool::MIN_BLOCK_SIZE};
+	const char data[] = "fastlanes";
+	buf.Append(data, sizeof(data));
+
+	buf.Resize(4 * BufPool::MIN_BLOCK_SIZE);
+	EXPECT_EQ(buf.Capacity(), 4 * BufPool::MIN_BLOCK_SIZE);
+	EXPECT_EQ(buf.Size(), sizeof(data));
+	EXPECT_EQ(std::memcmp(buf.data(), data, sizeof(data)), 0);
+}
+
+TEST_F(BufPoolTest, AppendGrowsTheBuf) {
+	Buf buf {BufPool::MIN_BLOCK_SIZE};
+	for (uint32_t value {0}; value < 3 * BufPool::MIN_BLOCK_SIZE / sizeof(uint32_t); ++value) {
+		buf.Append(&value, sizeof(value));
+	}
+
+	EXPECT_EQ(buf.Capacity(), 4 * BufPool::MIN_BLOCK_SIZE);
+	EXPECT_EQ(buf.Size(), 3 * BufPool::MIN_BLOCK_SIZE);
+	const auto* values = reinterpret_cast<const uint32_t*>(buf.data());
+	for (uint32_t value {0}; value < 3 * BufPool::MIN_BLOCK_SIZE / sizeof(uint32_t); ++value) {
+		ASSERT_EQ(values[value], value);
+	}
+}
+
+TEST_F(BufPoolTest, HugePageBlocksArePooledApart) {
+	BufPool pool {64 * 1024 * 1024};
+
+	n_t      capacity {BufPool::HUGE_PAGE_SIZE};
+	uint8_t* huge_block = pool.Acquire(capacity, true);
+	EXPECT_EQ(capacity, BufPool::HUGE_PAGE_SIZE);
+	std::memset(huge_block, 0xFF, capacity);
+	pool.Release(huge_block, capacity, true);
+
+	// a regular block of the same size class does not get the huge block, a huge one does.
+	n_t      regular_capacity {BufPool::HUGE_PAGE_SIZE};
+	uint8_t* regular_block = pool.Acquire(regular_capacity);
+	EXPECT_NE(regular_block, huge_block);
+	pool.Release(regular_block, regular_capacity);
+
+	n_t other_capacity {BufPool::HUGE_PAGE_SIZE - 1};
+	EXPECT_EQ(pool.Acquire(other_capacity, true), huge_block);
+	pool.Release(huge_block, other_capacity, true);
+
+	pool.Trim();
+	EXPECT_EQ(pool.RetainedBytes(), 0);
+}
+
+TEST_F(BufPoolTest, HugePageBufResizeKeepsData) {
+	Buf buf {BufPool::MIN_BLOCK_SIZE, true};
+	const char data[] = "fastlanes";
+	buf.Append(data, sizeof(data));
+
+	buf.Resize(2 * BufPool::HUGE_PAGE_SIZE);
+	EXPECT_EQ(buf.Capacity(), 2 * BufPool::HUGE_PAGE_SIZE);
+	EXPECT_EQ(std::memcmp(buf.data(), data, sizeof(data)), 0);
+	buf.data()[buf.Capacity() - 1] = 1;
+}
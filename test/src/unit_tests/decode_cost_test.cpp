@@ -0,0 +1,43 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/unit_tests/decode_cost_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cfg/cfg.hpp"
+#include "fls/footer/operator_token_generated.h"
+#include "fls/wizard/decode_cost.hpp"
+#include "gtest/gtest.h"
+
+using namespace fastlanes; // NOLINT
+
+class DecodeCostTest : public ::testing::Test {};
+
+TEST_F(DecodeCostTest, RanksEncodingFamiliesByDecodeSpeed) {
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_UNCOMPRESSED_I64),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_FFOR_I64));
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_FFOR_I64),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_RLE_I64_U16));
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_ALP_DBL),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_ALP_RD_DBL));
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_FSST_DELTA),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_FSST12_DELTA));
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_UNCOMPRESSED_STR),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_FSST_DELTA));
+}
+
+TEST_F(DecodeCostTest, PatchesAddToTheDecodeCost) {
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_FFOR_I32),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_FFOR_SLPATCH_I32));
+	EXPECT_LT(DecodeCost::CyclesPerValue(OperatorToken::EXP_RLE_STR_U16),
+	          DecodeCost::CyclesPerValue(OperatorToken::EXP_RLE_STR_SLPATCH_U16));
+}
+
+TEST_F(DecodeCostTest, ScanCyclesAddReadAndDecode) {
+	constexpr n_t n_values {1024};
+	constexpr n_t size {4096};
+	EXPECT_DOUBLE_EQ(DecodeCost::ScanCycles(OperatorToken::EXP_FFOR_I64, size, n_values),
+	                 size / CFG::CostModel::BYTES_PER_CYCLE +
+	                     n_values * DecodeCost::CyclesPerValue(OperatorToken::EXP_FFOR_I64));
+	EXPECT_LT(DecodeCost::ScanCycles(OperatorToken::EXP_FFOR_I64, size, n_values),
+	          DecodeCost::ScanCycles(OperatorToken::EXP_FFOR_I64, 2 * size, n_values));
+}
@@ -0,0 +1,61 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/unit_tests/hyperloglog_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/common/hyperloglog.hpp"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <string>
+
+using namespace fastlanes; // NOLINT
+
+class HyperLogLogTest : public ::testing::Test {};
+
+TEST_F(HyperLogLogTest, EmptySketchEstimatesZero) {
+	const HyperLogLog sketch;
+	EXPECT_TRUE(sketch.IsEmpty());
+	EXPECT_EQ(sketch.Estimate(), 0);
+}
+
+TEST_F(HyperLogLogTest, SmallCardinalitiesAreNearlyExact) {
+	HyperLogLog sketch;
+	for (int64_t repetition {0}; repetition < 100; ++repetition) {
+		for (int64_t value {0}; value < 10; ++value) {
+			sketch.Add(HyperLogLog::Hash(value));
+		}
+	}
+	EXPECT_FALSE(sketch.IsEmpty());
+	EXPECT_NEAR(static_cast<double>(sketch.Estimate()), 10.0, 1.0);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinalitiesAreWithinFivePercent) {
+	constexpr n_t n_distinct {200000};
+	HyperLogLog   sketch;
+	for (uint32_t value {0}; value < n_distinct; ++value) {
+		sketch.Add(HyperLogLog::Hash(value));
+		sketch.Add(HyperLogLog::Hash(value));
+	}
+	EXPECT_NEAR(static_cast<double>(sketch.Estimate()), static_cast<double>(n_distinct), 0.05 * n_distinct);
+}
+
+TEST_F(HyperLogLogTest, HashesStrings) {
+	HyperLogLog sketch;
+	for (n_t idx {0}; idx < 5000; ++idx) {
+		sketch.Add(HyperLogLog::Hash("value_" + std::to_string(idx % 1000)));
+	}
+	EXPECT_NEAR(static_cast<double>(sketch.Estimate()), 1000.0, 50.0);
+	EXPECT_EQ(HyperLogLog::Hash(string("abc")), HyperLogLog::Hash(reinterpret_cast<const uint8_t*>("abc"), 3));
+	EXPECT_NE(HyperLogLog::Hash(string("")), HyperLogLog::Hash(string("a")));
+}
+
+TEST_F(HyperLogLogTest, MergeEstimatesTheUnion) {
+	HyperLogLog left;
+	HyperLogLog right;
+	for (int32_t value {0}; value < 30000; ++value) {
+		left.Add(HyperLogLog::Hash(value));
+		right.Add(HyperLogLog::Hash(value + 20000));
+	}
+	left.Merge(right);
+	EXPECT_NEAR(static_cast<double>(left.Estimate()), 50000.0, 2500.0);
+}
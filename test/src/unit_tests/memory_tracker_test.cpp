@@ -0,0 +1,61 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/unit_tests/memory_tracker_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cor/lyt/buf.hpp"
+#include "fls/cor/lyt/buf_pool.hpp"
+#include "fls/cor/lyt/memory_tracker.hpp"
+#include "gtest/gtest.h"
+
+using namespace fastlanes; // NOLINT
+
+class MemoryTrackerTest : public ::testing::Test {};
+
+TEST_F(MemoryTrackerTest, Unlimited) {
+	MemoryTracker tracker;
+
+	tracker.Reserve(1000);
+	tracker.Reserve(500);
+	EXPECT_EQ(tracker.Used(), 1500);
+	tracker.Release(1500);
+	EXPECT_EQ(tracker.Used(), 0);
+	EXPECT_EQ(tracker.Peak(), 1500);
+}
+
+TEST_F(MemoryTrackerTest, BudgetIsAHardCap) {
+	MemoryTracker tracker {1000};
+
+	EXPECT_TRUE(tracker.TryReserve(600));
+	EXPECT_FALSE(tracker.Fits(500));
+	EXPECT_FALSE(tracker.TryReserve(500));
+	EXPECT_THROW(tracker.Reserve(500), MemoryBudgetException);
+	EXPECT_EQ(tracker.Used(), 600);
+
+	EXPECT_TRUE(tracker.TryReserve(400));
+	EXPECT_EQ(tracker.Peak(), 1000);
+	tracker.Release(1000);
+
+	// a lower budget applies to the next reservation.
+	tracker.SetBudget(100);
+	EXPECT_FALSE(tracker.TryReserve(101));
+	tracker.SetBudget(0);
+	EXPECT_TRUE(tracker.TryReserve(101));
+	tracker.Release(101);
+}
+
+TEST_F(MemoryTrackerTest, BufIsAccounted) {
+	MemoryTracker tracker;
+	{
+		Buf buf {5000, tracker};
+		EXPECT_EQ(tracker.Used(), BufPool::SizeClass(5000));
+		buf.Resize(100 * 1000);
+		EXPECT_EQ(tracker.Used(), BufPool::SizeClass(100 * 1000));
+		EXPECT_EQ(tracker.Peak(), BufPool::SizeClass(5000) + BufPool::SizeClass(100 * 1000));
+	}
+	EXPECT_EQ(tracker.Used(), 0);
+
+	MemoryTracker small_tracker {BufPool::SizeClass(5000)};
+	EXPECT_THROW(Buf(5001 * 2, small_tracker), MemoryBudgetException);
+	EXPECT_EQ(small_tracker.Used(), 0);
+}
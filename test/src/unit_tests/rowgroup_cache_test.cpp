@@ -0,0 +1,54 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/unit_tests/rowgroup_cache_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cor/lyt/buf.hpp"
+#include "fls/reader/rowgroup_cache.hpp"
+#include "gtest/gtest.h"
+
+using namespace fastlanes; // NOLINT
+
+class RowgroupCacheTest : public ::testing::Test {};
+
+TEST_F(RowgroupCacheTest, HitsAndMisses) {
+	RowgroupCache cache {1024 * 1024};
+
+	EXPECT_EQ(cache.Get("file", 0), nullptr);
+	const auto buf = make_shared<Buf>(4096);
+	cache.Put("file", 0, buf, 4096);
+
+	EXPECT_EQ(cache.Get("file", 0), buf);
+	EXPECT_EQ(cache.Get("file", 4096), nullptr);
+	EXPECT_EQ(cache.Get("other_file", 0), nullptr);
+	EXPECT_EQ(cache.Hits(), 1);
+	EXPECT_EQ(cache.Misses(), 3);
+	EXPECT_EQ(cache.CachedBytes(), 4096);
+}
+
+TEST_F(RowgroupCacheTest, EvictsLeastRecentlyUsed) {
+	RowgroupCache cache {2 * 4096};
+
+	const auto first  = make_shared<Buf>(4096);
+	const auto second = make_shared<Buf>(4096);
+	const auto third  = make_shared<Buf>(4096);
+	cache.Put("file", 0, first, 4096);
+	cache.Put("file", 1, second, 4096);
+
+	// touching the first makes the second the least recently used.
+	EXPECT_EQ(cache.Get("file", 0), first);
+	cache.Put("file", 2, third, 4096);
+	EXPECT_EQ(cache.Get("file", 1), nullptr);
+	EXPECT_EQ(cache.Get("file", 0), first);
+	EXPECT_EQ(cache.Get("file", 2), third);
+	EXPECT_EQ(cache.CachedBytes(), 2 * 4096);
+
+	// larger than the whole budget: not cached.
+	cache.Put("file", 3, make_shared<Buf>(4 * 4096), 4 * 4096);
+	EXPECT_EQ(cache.Get("file", 3), nullptr);
+
+	cache.SetBudget(4096);
+	EXPECT_EQ(cache.CachedBytes(), 4096);
+	cache.Clear();
+	EXPECT_EQ(cache.CachedBytes(), 0);
+}
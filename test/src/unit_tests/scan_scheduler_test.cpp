@@ -0,0 +1,83 @@
+// ────────────────────────────────────────────────────────
+// |                      FastLanes                       |
+// ────────────────────────────────────────────────────────
+// test/src/unit_tests/scan_scheduler_test.cpp
+// ────────────────────────────────────────────────────────
+#include "fls/cor/lyt/buf.hpp"
+#include "fls/cor/lyt/buf_pool.hpp"
+#include "fls/reader/scan_scheduler.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <stdexcept>
+
+using namespace fastlanes; // NOLINT
+
+class ScanSchedulerTest : public ::testing::Test {};
+
+TEST_F(ScanSchedulerTest, ParsesCpuLists) {
+	EXPECT_EQ(NumaTopology::ParseCpuList("0-3,8,10-11\n"), (vector<int> {0, 1, 2, 3, 8, 10, 11}));
+	EXPECT_EQ(NumaTopology::ParseCpuList("5"), (vector<int> {5}));
+	EXPECT_TRUE(NumaTopology::ParseCpuList("").empty());
+	EXPECT_GE(NumaTopology::Get().NodeCount(), 1);
+}
+
+TEST_F(ScanSchedulerTest, RunsEveryMorselOnce) {
+	constexpr n_t n_morsels {1000};
+	ScanScheduler scan_scheduler {4};
+
+	vector<std::atomic<n_t>> n_runs(n_morsels);
+	vector<n_t>              morsels_per_worker(scan_scheduler.WorkerCount(), 0);
+	scan_scheduler.Run(n_morsels, [&](const n_t worker_idx, const n_t morsel_idx) {
+		n_runs[morsel_idx]++;
+		morsels_per_worker[worker_idx]++;
+	});
+
+	n_t n_total {0};
+	for (const auto& n_run : n_runs) {
+		EXPECT_EQ(n_run, 1);
+	}
+	for (const auto n_worker_morsels : morsels_per_worker) {
+		n_total += n_worker_morsels;
+	}
+	EXPECT_EQ(n_total, n_morsels);
+}
+
+TEST_F(ScanSchedulerTest, MorselsAreSplitIntoOneRangePerNode) {
+	constexpr n_t       n_morsels {64};
+	const ScanScheduler scan_scheduler {8};
+
+	n_t previous_node {0};
+	for (n_t morsel_idx {0}; morsel_idx < n_morsels; ++morsel_idx) {
+		const n_t node = scan_scheduler.MorselNode(morsel_idx, n_morsels);
+		EXPECT_GE(node, previous_node);
+		EXPECT_LT(node, NumaTopology::Get().NodeCount());
+		previous_node = node;
+	}
+	EXPECT_EQ(scan_scheduler.MorselNode(0, n_morsels), 0);
+}
+
+TEST_F(ScanSchedulerTest, WorkersAllocateFromTheirNodePool) {
+	ScanScheduler scan_scheduler {2};
+
+	scan_scheduler.Run(2, [&](const n_t worker_idx, const n_t) {
+		EXPECT_EQ(&BufPool::Local(), &BufPool::ForNode(scan_scheduler.WorkerNode(worker_idx)));
+		Buf buf {BufPool::MIN_BLOCK_SIZE};
+		buf.Append("fastlanes", 9);
+	});
+	EXPECT_EQ(&BufPool::Local(), &BufPool::Global());
+}
+
+TEST_F(ScanSchedulerTest, RethrowsTheFirstException) {
+	ScanScheduler scan_scheduler {3};
+
+	std::atomic<n_t> n_runs {0};
+	EXPECT_THROW(scan_scheduler.Run(100,
+	                                [&](const n_t, const n_t morsel_idx) {
+		                                n_runs++;
+		                                if (morsel_idx == 0) {
+			                                throw std::runtime_error("morsel 0 failed");
+		                                }
+	                                }),
+	             std::runtime_error);
+	EXPECT_LE(n_runs, 100);
+}